@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Barry Wardell
+ ******************************************************************************/
+
+/* Kernels shared by kerr-circular.c and kerr-equatorial.c. AVX-512 or AVX2
+   versions of some kernels are used when the compiler targets those
+   instruction sets (e.g. with -march=native); otherwise portable scalar
+   versions are used. */
+
+#include <float.h>
+#include <math.h>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/* Evaluate the polynomial sum_{k=k0}^{k1} a[k-k0] x^k using Horner's scheme */
+static inline double effsource_poly(const double * a, int k0, int k1, double x)
+{
+  double p = a[k1-k0];
+  for(int k=k1-1; k>=k0; k--)
+    p = p*x + a[k-k0];
+  for(int k=0; k<k0; k++)
+    p *= x;
+  return p;
+}
+
+/* Evaluate the polynomial sum_{k=k0}^{k1} a[k-k0] x^k and its first and second
+   derivatives with respect to x, storing them in P[0], P[1] and P[2]. The
+   derivatives are carried along in the Horner recurrence so no separate
+   tables of derivative coefficients are needed. */
+static inline void effsource_poly_d2(const double * a, int k0, int k1, double x,
+  double * P)
+{
+  double p0 = a[k1-k0], p1 = 0, p2 = 0;
+  for(int k=k1-1; k>=k0; k--)
+  {
+    p2 = p2*x + p1;
+    p1 = p1*x + p0;
+    p0 = p0*x + a[k-k0];
+  }
+  for(int k=0; k<k0; k++)
+  {
+    p2 = p2*x + p1;
+    p1 = p1*x + p0;
+    p0 = p0*x;
+  }
+  P[0] = p0;
+  P[1] = p1;
+  P[2] = 2.0*p2;
+}
+
+/* Truncated Taylor jets. A jet in nd directions holds a value in component 0
+   and the first and second derivatives along direction d in components 2*d+1
+   and 2*d+2; mixed derivatives are not carried. */
+#define EFFSOURCE_JET_SIZE(nd) (2*(nd)+1)
+
+/* z += x*y for jets x, y and z in nd directions */
+static inline void effsource_jet_mul_add(int nd, const double * x, const double * y,
+  double * z)
+{
+  z[0] += x[0]*y[0];
+  for(int d=0; d<nd; d++)
+  {
+    const int d1 = 2*d+1, d2 = 2*d+2;
+    z[d1] += x[d1]*y[0] + x[0]*y[d1];
+    z[d2] += x[d2]*y[0] + 2.0*x[d1]*y[d1] + x[0]*y[d2];
+  }
+}
+
+/* Jet y of f(x) for a function f with value and first and second derivatives
+   F[0], F[1] and F[2] at x[0], where x is a jet in nd directions */
+static inline void effsource_jet_compose(int nd, const double * F, const double * x,
+  double * y)
+{
+  y[0] = F[0];
+  for(int d=0; d<nd; d++)
+  {
+    const int d1 = 2*d+1, d2 = 2*d+2;
+    y[d1] = F[1]*x[d1];
+    y[d2] = F[2]*x[d1]*x[d1] + F[1]*x[d2];
+  }
+}
+
+/* y[i] = sqrt(x[i]) for i = 0, ..., n-1. Unlike calls to sqrt, this does not
+   prevent the compiler from vectorising the loops around it. */
+static inline void effsource_sqrt(int n, const double * x, double * y)
+{
+  int i = 0;
+
+#if defined(__AVX512F__)
+  for(; i+8<=n; i+=8)
+    _mm512_storeu_pd(y+i, _mm512_sqrt_pd(_mm512_loadu_pd(x+i)));
+#elif defined(__AVX2__)
+  for(; i+4<=n; i+=4)
+    _mm256_storeu_pd(y+i, _mm256_sqrt_pd(_mm256_loadu_pd(x+i)));
+#endif
+  for(; i<n; i++)
+    y[i] = sqrt(x[i]);
+}
+
+/* s[i] = sin(x[i]) and c[i] = cos(x[i]) for i = 0, ..., n-1, |x[i]| < 2^29.
+   The argument is reduced by multiples of pi/2 in three parts (Cody-Waite) and
+   the Cephes minimax polynomials are used on [-pi/4, pi/4], giving results
+   within 2 ulp. The loop has no calls or branches so it vectorises. */
+static inline void effsource_sincos(int n, const double * restrict x, double * restrict s,
+  double * restrict c)
+{
+  static const double S[6] = {-1.66666666666666307295E-1, 8.33333333332211858878E-3,
+    -1.98412698295895385996E-4, 2.75573136213857245213E-6, -2.50507477628578072866E-8,
+    1.58962301576546568060E-10};
+  static const double C[6] = {4.16666666666665929218E-2, -1.38888888888730564116E-3,
+    2.48015872888517045348E-5, -2.75573141792967388112E-7, 2.08757008419747316778E-9,
+    -1.13585365213876817300E-11};
+  const double P1 = 1.57079625129699707031E0, P2 = 7.54978941586159635335E-8,
+               P3 = 5.39030285815811905290E-15;
+  const double round = 0x1.8p52;
+
+  for(int i=0; i<n; i++)
+  {
+    /* q = nearest integer to 2x/pi, computed without a call to rint */
+    const double q = (x[i]*M_2_PI + round) - round;
+    const int k = (int)q;
+    const double y = ((x[i] - q*P1) - q*P2) - q*P3;
+    const double z = y*y;
+    const double sy = y + y*z*(S[0] + z*(S[1] + z*(S[2] + z*(S[3] + z*(S[4] + z*S[5])))));
+    const double cy = 1.0 - 0.5*z + z*z*(C[0] + z*(C[1] + z*(C[2] + z*(C[3] + z*(C[4] + z*C[5])))));
+    const double sk = (k & 1) ? cy : sy;
+    const double ck = (k & 1) ? sy : cy;
+    s[i] = (k & 2) ? -sk : sk;
+    c[i] = ((k+1) & 2) ? -ck : ck;
+  }
+}
+
+/* Generate s[k] = sin(h0+k*dh) and c2[k] = cos(h0+k*dh)/2 for k = 0, ..., n-1
+   by rotation.
+   The increments are applied in the form of Numerical Recipes (5.4.6), which
+   keeps the rounding error growing only linearly in k. */
+static inline void effsource_angles(int n, double h0, double dh, double * restrict s,
+  double * restrict c2)
+{
+  const double alpha = 2.0*sin(0.5*dh)*sin(0.5*dh), beta = sin(dh);
+  double ck = cos(h0), sk = sin(h0);
+
+  for(int k=0; k<n; k++)
+  {
+    s[k]  = sk;
+    c2[k] = 0.5*ck;
+
+    const double c_next = ck - (alpha*ck + beta*sk);
+    sk = sk - (alpha*sk - beta*ck);
+    ck = c_next;
+  }
+}
+
+/* Maximum number of iterations of the arithmetic-geometric mean */
+#define EFFSOURCE_AGM_MAX 40
+
+/* Complete elliptic integrals K(k) and E(k) with modulus k = 1/sqrt(1+C1) for
+   the n values C1[0], ..., C1[n-1], C1 > 0. K = pi/(2 AGM(1,k')) with the
+   complementary modulus k' = sqrt(C1/(1+C1)) computed directly from C1, and
+   by the Legendre relation E = AGM(1,k) + K T', where T' = sum 2^(j-1) c_j^2
+   is accumulated in the arithmetic-geometric mean for K(k'). Both AGMs are run
+   together and all terms are positive, so there is no cancellation as k -> 1.
+   Iteration stops independently for each value once both AGMs have converged,
+   so the result for a given C1 does not depend on the other values in the
+   batch. */
+static inline void effsource_ellint_KE(int n, const double * C1, double * K, double * E)
+{
+  int i = 0;
+
+#if defined(__AVX512F__)
+  const __m512d one = _mm512_set1_pd(1.0), half = _mm512_set1_pd(0.5);
+  const __m512d tol = _mm512_set1_pd(4.0*DBL_EPSILON), pi_2 = _mm512_set1_pd(M_PI_2);
+
+  for(; i<n; i+=8)
+  {
+    const __mmask8 lanes = n-i >= 8 ? 0xff : (__mmask8)((1u << (n-i)) - 1);
+    const __m512d x   = _mm512_mask_loadu_pd(one, lanes, C1+i);
+    const __m512d inv = _mm512_div_pd(one, _mm512_add_pd(one, x));
+    const __m512d kp2 = _mm512_mul_pd(x, inv);
+    __m512d a = one, b = _mm512_sqrt_pd(kp2), ac = one, bc = _mm512_sqrt_pd(inv);
+    __m512d t = _mm512_mul_pd(half, kp2), p = half;
+
+    __mmask8 active = lanes;
+    for(int it=0; it<EFFSOURCE_AGM_MAX && active; it++)
+    {
+      const __m512d c  = _mm512_mul_pd(half, _mm512_sub_pd(a, b));
+      const __m512d cc = _mm512_mul_pd(half, _mm512_sub_pd(ac, bc));
+      b  = _mm512_mask_sqrt_pd(b, active, _mm512_mul_pd(a, b));
+      a  = _mm512_mask_sub_pd(a, active, a, c);
+      bc = _mm512_mask_sqrt_pd(bc, active, _mm512_mul_pd(ac, bc));
+      ac = _mm512_mask_sub_pd(ac, active, ac, cc);
+      p  = _mm512_mask_add_pd(p, active, p, p);
+      t  = _mm512_mask_add_pd(t, active, t, _mm512_mul_pd(p, _mm512_mul_pd(cc, cc)));
+      active &= _mm512_cmp_pd_mask(_mm512_sub_pd(a, b), _mm512_mul_pd(tol, a), _CMP_GT_OQ) |
+                _mm512_cmp_pd_mask(_mm512_sub_pd(ac, bc), _mm512_mul_pd(tol, ac), _CMP_GT_OQ);
+    }
+
+    const __m512d k = _mm512_div_pd(pi_2, a);
+    _mm512_mask_storeu_pd(K+i, lanes, k);
+    _mm512_mask_storeu_pd(E+i, lanes, _mm512_add_pd(ac, _mm512_mul_pd(k, t)));
+  }
+#elif defined(__AVX2__)
+  const __m256d one = _mm256_set1_pd(1.0), half = _mm256_set1_pd(0.5);
+  const __m256d tol = _mm256_set1_pd(4.0*DBL_EPSILON), pi_2 = _mm256_set1_pd(M_PI_2);
+
+  for(; i<n; i+=4)
+  {
+    const __m256i lanes = _mm256_cmpgt_epi64(_mm256_set1_epi64x(n-i),
+                                             _mm256_set_epi64x(3, 2, 1, 0));
+    const __m256d x   = _mm256_blendv_pd(one, _mm256_maskload_pd(C1+i, lanes),
+                                         _mm256_castsi256_pd(lanes));
+    const __m256d inv = _mm256_div_pd(one, _mm256_add_pd(one, x));
+    const __m256d kp2 = _mm256_mul_pd(x, inv);
+    __m256d a = one, b = _mm256_sqrt_pd(kp2), ac = one, bc = _mm256_sqrt_pd(inv);
+    __m256d t = _mm256_mul_pd(half, kp2), p = half;
+
+    __m256d active = _mm256_castsi256_pd(lanes);
+    for(int it=0; it<EFFSOURCE_AGM_MAX && _mm256_movemask_pd(active); it++)
+    {
+      const __m256d c  = _mm256_mul_pd(half, _mm256_sub_pd(a, b));
+      const __m256d cc = _mm256_mul_pd(half, _mm256_sub_pd(ac, bc));
+      b  = _mm256_blendv_pd(b, _mm256_sqrt_pd(_mm256_mul_pd(a, b)), active);
+      a  = _mm256_blendv_pd(a, _mm256_sub_pd(a, c), active);
+      bc = _mm256_blendv_pd(bc, _mm256_sqrt_pd(_mm256_mul_pd(ac, bc)), active);
+      ac = _mm256_blendv_pd(ac, _mm256_sub_pd(ac, cc), active);
+      p  = _mm256_blendv_pd(p, _mm256_add_pd(p, p), active);
+      t  = _mm256_blendv_pd(t, _mm256_add_pd(t, _mm256_mul_pd(p, _mm256_mul_pd(cc, cc))), active);
+      active = _mm256_and_pd(active, _mm256_or_pd(
+        _mm256_cmp_pd(_mm256_sub_pd(a, b), _mm256_mul_pd(tol, a), _CMP_GT_OQ),
+        _mm256_cmp_pd(_mm256_sub_pd(ac, bc), _mm256_mul_pd(tol, ac), _CMP_GT_OQ)));
+    }
+
+    const __m256d k = _mm256_div_pd(pi_2, a);
+    _mm256_maskstore_pd(K+i, lanes, k);
+    _mm256_maskstore_pd(E+i, lanes, _mm256_add_pd(ac, _mm256_mul_pd(k, t)));
+  }
+#else
+  for(; i<n; i++)
+  {
+    const double inv = 1.0/(1.0+C1[i]);
+    const double kp2 = C1[i]*inv;
+    double a = 1.0, b = sqrt(kp2), ac = 1.0, bc = sqrt(inv);
+    double t = 0.5*kp2, p = 0.5;
+
+    for(int it=0; it<EFFSOURCE_AGM_MAX && (a-b > 4.0*DBL_EPSILON*a || ac-bc > 4.0*DBL_EPSILON*ac); it++)
+    {
+      const double c  = 0.5*(a-b);
+      const double cc = 0.5*(ac-bc);
+      b   = sqrt(a*b);
+      a  -= c;
+      bc  = sqrt(ac*bc);
+      ac -= cc;
+      p  += p;
+      t  += p*(cc*cc);
+    }
+
+    K[i] = M_PI_2/a;
+    E[i] = ac + K[i]*t;
+  }
+#endif
+}
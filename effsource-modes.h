@@ -0,0 +1,451 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Barry Wardell
+ ******************************************************************************/
+
+/* Generation of the coefficients of the m-mode elliptic integral expressions
+   for arbitrary m. kerr-circular.c and kerr-equatorial.c include tables of
+   these for m <= 20 and use the routines here to generate the coefficients for
+   higher modes in the same packed layout, as they are requested.
+
+   With C = alpha/beta and x = sin^2(phi/2), the coefficients for mode m are
+   those of the polynomials in C multiplying K and E in the integrals of
+   cos(m phi) x^j (C+x)^(-7/2) and sin(m phi) sin(phi) x^j (C+x)^(-7/2) over
+   0 <= phi <= 2 pi. Writing x^j = sum_l binomial(j,l) (-C)^(j-l) (C+x)^l,
+   these follow from the integrals
+
+     Q_l(m) = int_0^{2 pi} cos(m phi) (C+x)^(l-7/2) dphi,   0 <= l <= 5,
+
+   the second set after an integration by parts. For fixed l, integrating
+   sin(m phi) (C+x)^(l-5/2) by parts gives the three-term recurrence
+
+     (2m+2l-5) Q_l(m+1) = 4m(1+2C) Q_l(m) - (2m-2l+5) Q_l(m-1).
+
+   The coefficients for modes 0 and 1 are given below and the recurrence is run
+   on the coefficients of the polynomials in C. The low order coefficients then
+   lose roughly 6 log10(m) digits to rounding, so the recurrence is run in
+   double-double arithmetic and the results rounded to double at the end.
+
+   The polynomials themselves are only useful for small m and C. Q_l(m)
+   decays like exp(-eta m) with eta = 2 asinh(sqrt(C)), from the singularity
+   of the integrand at Im(phi) = eta, while the terms multiplying K and E do
+   not, so evaluating them loses about 2 eta m / log(10) digits. Beyond
+   eta m = EFFSOURCE_MODE_ETA_M the values are instead computed at C by
+   running the recurrence backwards from well above m, which converges to the
+   decaying solution (Miller's algorithm), normalized by the values for m = 0
+   from the coefficients below. */
+
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Highest mode for which the coefficients are generated when a mode m > 20 is
+   first requested; requests for higher modes grow the tables. It also sets the
+   blocks of EFFSOURCE_M_INIT+1 modes that effsource_mode_values computes
+   together, from a start above the block, so that the values for a mode do not
+   depend on the range they are computed in. */
+#ifndef EFFSOURCE_M_INIT
+#define EFFSOURCE_M_INIT 60
+#endif
+
+#if EFFSOURCE_M_INIT <= 20
+#error "EFFSOURCE_M_INIT must be greater than 20"
+#endif
+
+/* Largest eta m = 2 asinh(sqrt(C)) m for which the polynomials in C are
+   evaluated directly, losing at most about 2 digits */
+#define EFFSOURCE_MODE_ETA_M 2.0
+
+/* Number of coefficients stored for modes 0 <= m' <= m in the packed layouts
+   of the real and imaginary parts */
+#define EFFSOURCE_RE_COEFFS(m) (((size_t)(m)+1)*(5*(size_t)(m)+34))
+#define EFFSOURCE_IM_COEFFS(m) (((size_t)(m)+1)*(5*(size_t)(m)+31))
+
+/* Double-double numbers hi+lo with |lo| <= ulp(hi)/2 */
+struct effsource_dd {
+  double hi;
+  double lo;
+};
+
+static inline struct effsource_dd effsource_dd_norm(double s, double e)
+{
+  const double hi = s + e;
+  return (struct effsource_dd){hi, e - (hi - s)};
+}
+
+static inline struct effsource_dd effsource_dd_add(struct effsource_dd a, struct effsource_dd b)
+{
+  const double s = a.hi + b.hi;
+  const double v = s - a.hi;
+  const double e = (a.hi - (s - v)) + (b.hi - v);
+  return effsource_dd_norm(s, e + a.lo + b.lo);
+}
+
+static inline struct effsource_dd effsource_dd_mul(struct effsource_dd a, double b)
+{
+  const double p = a.hi*b;
+  return effsource_dd_norm(p, fma(a.hi, b, -p) + a.lo*b);
+}
+
+static inline struct effsource_dd effsource_dd_div(struct effsource_dd a, double b)
+{
+  const double q = a.hi/b;
+  const double r = fma(-q, b, a.hi) + a.lo;
+  return effsource_dd_norm(q, r/b);
+}
+
+/* 15 times the coefficients of C^k in Q_l(m), l = 0, and in Q_l(m)/(C(1+C)),
+   l > 0, for K (i=0) and E (i=1) and modes m = 0 and 1. */
+#define EFFSOURCE_MODE_SEED_LEN 7
+static const double effsource_mode_seed[6][2][2][EFFSOURCE_MODE_SEED_LEN] =
+ {
+  {{{0,-4,-8,0,0,0,0},{0,-4,-6,-6,0,0,0}},
+   {{8,23,23,0,0,0,0},{8,19,9,6,0,0,0}}},
+  {{{0,-5,0,0,0,0,0},{0,-5,-10,0,0,0,0}},
+   {{10,20,0,0,0,0,0},{10,10,10,0,0,0,0}}},
+  {{{0,0,0,0,0,0,0},{0,0,-30,-30,0,0,0}},
+   {{0,15,15,0,0,0,0},{0,15,45,30,0,0,0}}},
+  {{{0,0,15,15,0,0,0},{0,0,15,45,30,0,0}},
+   {{0,0,0,0,0,0,0},{0,0,-30,-60,-30,0,0}}},
+  {{{0,0,0,0,0,0,0},{0,0,0,10,20,10,0}},
+   {{0,0,15,30,15,0,0},{0,0,-5,-20,-25,-10,0}}},
+  {{{0,0,0,-5,-10,-5,0},{0,0,0,3,12,15,6}},
+   {{0,0,10,40,50,20,0},{0,0,-6,-18,-24,-18,-6}}}
+ };
+
+/* Generate the coefficients for modes m0 <= m <= m1, m0 >= 1, in the packed
+   layouts of ReEI and ImEI. The coefficients for mode m, elliptic integral i
+   and order j are stored starting at Re+ReOffset[m-m0][i][j] and
+   Im+ImOffset[m-m0][i][j]; Re and Im must have room for
+   EFFSOURCE_RE_COEFFS(m1)-EFFSOURCE_RE_COEFFS(m0-1) and
+   EFFSOURCE_IM_COEFFS(m1)-EFFSOURCE_IM_COEFFS(m0-1) values. If Im is NULL only
+   the real parts are generated. Returns 0 on success and -1 if the work space
+   cannot be allocated. */
+static int effsource_mode_coeffs(int m0, int m1, double * Re, int (*ReOffset)[2][5],
+  double * Im, int (*ImOffset)[2][5])
+{
+  static const double binomial[5][5] =
+    {{1,0,0,0,0}, {1,1,0,0,0}, {1,2,1,0,0}, {1,3,3,1,0}, {1,4,6,4,1}};
+
+  /* Q_l(m-1), Q_l(m) and Q_l(m+1) for each l and i. The degree in C is at most
+     m+5, with two more terms needed in the rows below. */
+  const int len = m1+8;
+  struct effsource_dd * q = calloc(6*2*3*(size_t)len, sizeof(struct effsource_dd));
+  if(q == NULL)
+    return -1;
+#define Q(l, i, s, k) q[(((l)*2+(i))*3+(s))*len+(k)]
+
+  for(int l=0; l<6; l++)
+    for(int i=0; i<2; i++)
+      for(int k=0; k<EFFSOURCE_MODE_SEED_LEN; k++)
+      {
+        Q(l,i,0,k).hi = effsource_mode_seed[l][i][0][k];
+        Q(l,i,1,k).hi = effsource_mode_seed[l][i][1][k];
+      }
+
+  int re = 0, im = 0;
+  for(int m=1; m<=m1; m++)
+  {
+    const int cur = m%3, prev = (m+2)%3, next = (m+1)%3;
+
+    if(m >= m0)
+    {
+      for(int i=0; i<2; i++)
+        for(int j=0; j<5; j++)
+        {
+          /* Real part: (-C)^j Q_0 + C(1+C) sum_{l=1}^{j} binomial(j,l) (-C)^(j-l) Q_l/(C(1+C)) */
+          ReOffset[m-m0][i][j] = re;
+          for(int k=(j-i > 0 ? j-i : 0); k<=m+2+j; k++)
+          {
+            struct effsource_dd c = {0, 0};
+            if(k >= j)
+              c = effsource_dd_mul(Q(0,i,cur,k-j), j%2 ? -1 : 1);
+            for(int l=1; l<=j; l++)
+            {
+              const double b = (j-l)%2 ? -binomial[j][l] : binomial[j][l];
+              for(int s=1; s<=2; s++)
+                if(k-(j-l)-s >= 0)
+                  c = effsource_dd_add(c, effsource_dd_mul(Q(l,i,cur,k-(j-l)-s), b));
+            }
+            Re[re++] = effsource_dd_div(c, 15).hi;
+          }
+
+          /* Imaginary part: sum_{l=0}^{j} binomial(j,l) (-C)^(j-l) m/(10-4l) Q_{l+1}/(C(1+C)) */
+          if(Im == NULL)
+            continue;
+          ImOffset[m-m0][i][j] = im;
+          for(int k=(j-i-1 > 0 ? j-i-1 : 0); k<=m+1+j; k++)
+          {
+            struct effsource_dd c = {0, 0};
+            for(int l=0; l<=j; l++)
+            {
+              const double b = (j-l)%2 ? -binomial[j][l] : binomial[j][l];
+              if(k-(j-l) >= 0)
+                c = effsource_dd_add(c,
+                  effsource_dd_div(effsource_dd_mul(Q(l+1,i,cur,k-(j-l)), b*m), 10-4*l));
+            }
+            Im[im++] = effsource_dd_div(c, 15).hi;
+          }
+        }
+    }
+
+    /* Advance the recurrence to mode m+1 */
+    for(int l=0; l<6; l++)
+      for(int i=0; i<2; i++)
+        for(int k=0; k<=m+6 && k<len; k++)
+        {
+          struct effsource_dd z = Q(l,i,cur,k);
+          if(k>0)
+            z = effsource_dd_add(z, effsource_dd_mul(Q(l,i,cur,k-1), 2));
+          Q(l,i,next,k) = effsource_dd_div(effsource_dd_add(effsource_dd_mul(z, 4*m),
+            effsource_dd_mul(Q(l,i,prev,k), -(2*m-2*l+5))), 2*m+2*l-5);
+        }
+  }
+
+#undef Q
+  free(q);
+  return 0;
+}
+
+/* Generated coefficients for modes 20 < m <= m_max, as stored by
+   effsource_mode_coeffs for m0 = 21. A table is replaced by a larger one when
+   a higher mode is requested, but is kept in prev of its replacement since
+   evaluations running at the time may still be reading it. */
+struct effsource_mode_table {
+  int m_max;
+  double * Re, * Im;
+  int (*ReOffset)[2][5], (*ImOffset)[2][5];
+  struct effsource_mode_table * prev;
+};
+
+static void effsource_mode_table_free(struct effsource_mode_table * t)
+{
+  free(t->Re);
+  free(t->Im);
+  free(t->ReOffset);
+  free(t->ImOffset);
+  free(t);
+}
+
+/* Allocate and generate the table for modes up to m_max, with the imaginary
+   parts if im is non-zero. Returns NULL if the table cannot be allocated or
+   its offsets would not fit in an int. */
+static struct effsource_mode_table * effsource_mode_table_alloc(int m_max, int im)
+{
+  const size_t n_re = EFFSOURCE_RE_COEFFS(m_max)-EFFSOURCE_RE_COEFFS(20);
+  const size_t n_im = EFFSOURCE_IM_COEFFS(m_max)-EFFSOURCE_IM_COEFFS(20);
+  if(m_max <= 20 || n_re > INT_MAX)
+    return NULL;
+
+  struct effsource_mode_table * t = calloc(1, sizeof(struct effsource_mode_table));
+  if(t == NULL)
+    return NULL;
+  t->m_max = m_max;
+  t->Re = malloc(n_re*sizeof(double));
+  t->ReOffset = malloc((m_max-20)*sizeof(*t->ReOffset));
+  if(im)
+  {
+    t->Im = malloc(n_im*sizeof(double));
+    t->ImOffset = malloc((m_max-20)*sizeof(*t->ImOffset));
+  }
+
+  if(t->Re == NULL || t->ReOffset == NULL || (im && (t->Im == NULL || t->ImOffset == NULL)) ||
+     effsource_mode_coeffs(21, m_max, t->Re, t->ReOffset, t->Im, t->ImOffset) != 0)
+  {
+    effsource_mode_table_free(t);
+    return NULL;
+  }
+  return t;
+}
+
+/* Make *table cover mode m, replacing it with a table for modes up to at
+   least twice its current size if needed. Returns 0 on success and -1 if the
+   larger table cannot be allocated. The caller serializes calls for the same
+   table. */
+static int effsource_mode_table_grow(struct effsource_mode_table ** table, int m, int im)
+{
+  struct effsource_mode_table * t = *table;
+  if(t != NULL && t->m_max >= m)
+    return 0;
+
+  int m_max = t == NULL ? EFFSOURCE_M_INIT : 2*t->m_max;
+  if(m_max < m)
+    m_max = m;
+  struct effsource_mode_table * grown = effsource_mode_table_alloc(m_max, im);
+  if(grown == NULL && m_max > m)
+    grown = effsource_mode_table_alloc(m, im);
+  if(grown == NULL)
+    return -1;
+
+  grown->prev = t;
+  __atomic_store_n(table, grown, __ATOMIC_RELEASE);
+  return 0;
+}
+
+/* Whether mode m at C is evaluated from the polynomials in C rather than by
+   effsource_mode_values */
+static inline int effsource_mode_poly(int m, double C)
+{
+  return 2.0*asinh(sqrt(C))*m <= EFFSOURCE_MODE_ETA_M;
+}
+
+/* c = a*b for a value and its first and second derivatives with respect to C */
+static inline void effsource_mode_jet_mul(const double a[3], const double b[3], double c[3])
+{
+  const double c0 = a[0]*b[0];
+  const double c1 = a[1]*b[0] + a[0]*b[1];
+  const double c2 = a[2]*b[0] + 2.0*a[1]*b[1] + a[0]*b[2];
+  c[0] = c0;
+  c[1] = c1;
+  c[2] = c2;
+}
+
+/* Compute the values at C of sum_i ellip[i] times the polynomials of ReEI and
+   ImEI for modes m0 <= m <= m1, with ellip = {K, E} the elliptic integrals at
+   C, together with their first and second derivatives with respect to C. The
+   values for mode m, order j are stored in Re[m-m0][j][0..2] and
+   Im[m-m0][j][0..2]; if Im is NULL only the real parts are computed.
+   Requires C > 0 and m0 and m1 in the same block of EFFSOURCE_M_INIT+1 modes,
+   m0/(EFFSOURCE_M_INIT+1) == m1/(EFFSOURCE_M_INIT+1). */
+static void effsource_mode_values(int m0, int m1, double C, double K, double E,
+  double (*Re)[5][3], double (*Im)[5][3])
+{
+  static const double binomial[5][5] =
+    {{1,0,0,0,0}, {1,1,0,0,0}, {1,2,1,0,0}, {1,3,3,1,0}, {1,4,6,4,1}};
+
+  /* K and E with their derivatives with respect to C */
+  const double ellip[2][3] = {
+    {K, (C*K - (1+C)*E)/(2.*C*(1+C)),
+     -(C*(1+2*C)*K - 2*(1+C)*(1+C)*E)/(4.*C*C*(1+C)*(1+C))},
+    {E, (K - E)/(2.*(1+C)), -(2*C*K - (2*C-1)*E)/(4.*C*(1+C)*(1+C))}};
+
+  /* The error of the backward recurrence decays like exp(-2 eta (top - m)).
+     Starting from the same top for all modes of a block gives the same values
+     for a mode whichever range it is computed in. */
+  const double eta = 2.0*asinh(sqrt(C));
+  const int block_end = (m1/(EFFSOURCE_M_INIT+1) + 1)*(EFFSOURCE_M_INIT+1) - 1;
+  const int top = block_end + 2 + (int) ceil(20.0/eta);
+
+  /* 15 Q_l(m) for l = 0, and 15 Q_l(m)/(C(1+C)) for l > 0, from the
+     coefficients for m = 0 */
+  double q0[6][3];
+  for(int l=0; l<6; l++)
+  {
+    q0[l][0] = q0[l][1] = q0[l][2] = 0;
+    for(int i=0; i<2; i++)
+    {
+      const double * a = effsource_mode_seed[l][i][0];
+      double P[3] = {a[EFFSOURCE_MODE_SEED_LEN-1], 0, 0}, t[3];
+      for(int k=EFFSOURCE_MODE_SEED_LEN-2; k>=0; k--)
+      {
+        P[2] = P[2]*C + 2.0*P[1];
+        P[1] = P[1]*C + P[0];
+        P[0] = P[0]*C + a[k];
+      }
+      effsource_mode_jet_mul(ellip[i], P, t);
+      for(int d=0; d<3; d++)
+        q0[l][d] += t[d];
+    }
+  }
+
+  /* Run the recurrence for all l down to m = 0 from y(top+1) = 0,
+     y(top) = 1, rescaling to avoid overflow */
+  double q[EFFSOURCE_M_INIT+1][6][3];
+  double y[6][3], y_next[6][3];
+  for(int l=0; l<6; l++)
+    for(int d=0; d<3; d++)
+    {
+      y[l][d] = d == 0;
+      y_next[l][d] = 0;
+    }
+
+  for(int m=top; m>=1; m--)
+  {
+    const double f0 = 4.0*m*(1+2*C), f1 = 8.0*m;
+    double y_max = 0;
+    for(int l=0; l<6; l++)
+    {
+      const double b = 2*m+2*l-5, inv = 1.0/(2*m-2*l+5);
+      const double y0 = (f0*y[l][0] - b*y_next[l][0])*inv;
+      const double y1 = (f1*y[l][0] + f0*y[l][1] - b*y_next[l][1])*inv;
+      const double y2 = (2.0*f1*y[l][1] + f0*y[l][2] - b*y_next[l][2])*inv;
+      y_next[l][0] = y[l][0];
+      y_next[l][1] = y[l][1];
+      y_next[l][2] = y[l][2];
+      y[l][0] = y0;
+      y[l][1] = y1;
+      y[l][2] = y2;
+      if(fabs(y0) > y_max)
+        y_max = fabs(y0);
+    }
+
+    if(m-1 >= m0 && m-1 <= m1)
+      memcpy(q[m-1-m0], y, sizeof(y));
+
+    if(y_max > 1e200)
+    {
+      for(int l=0; l<6; l++)
+        for(int d=0; d<3; d++)
+        {
+          y[l][d] *= 1e-200;
+          y_next[l][d] *= 1e-200;
+        }
+      for(int k=(m-1 > m0 ? m-1 : m0); k<=m1; k++)
+        for(int l=0; l<6; l++)
+          for(int d=0; d<3; d++)
+            q[k-m0][l][d] *= 1e-200;
+    }
+  }
+
+  /* Normalize: q0 y/y(0) */
+  for(int l=0; l<6; l++)
+  {
+    const double inv0 = 1.0/y[l][0];
+    for(int m=m0; m<=m1; m++)
+    {
+      double * r = q[m-m0][l];
+      const double r0 = r[0]*inv0;
+      const double r1 = (r[1] - r0*y[l][1])*inv0;
+      const double r2 = (r[2] - 2.0*r1*y[l][1] - r0*y[l][2])*inv0;
+      const double ratio[3] = {r0, r1, r2};
+      effsource_mode_jet_mul(q0[l], ratio, r);
+    }
+  }
+
+  /* Combine as in effsource_mode_coeffs, with (-C)^n and C(1+C) */
+  double mC[5][3] = {{1, 0, 0}};
+  const double minus_C[3] = {-C, -1, 0}, C_1C[3] = {C*(1+C), 1+2*C, 2};
+  for(int n=1; n<5; n++)
+    effsource_mode_jet_mul(mC[n-1], minus_C, mC[n]);
+
+  for(int m=m0; m<=m1; m++)
+  {
+    double (*ql)[3] = q[m-m0];
+    for(int j=0; j<5; j++)
+    {
+      double re[3], t[3], u[3];
+      effsource_mode_jet_mul(mC[j], ql[0], re);
+      for(int l=1; l<=j; l++)
+      {
+        effsource_mode_jet_mul(mC[j-l], ql[l], t);
+        effsource_mode_jet_mul(t, C_1C, u);
+        for(int d=0; d<3; d++)
+          re[d] += binomial[j][l]*u[d];
+      }
+      for(int d=0; d<3; d++)
+        Re[m-m0][j][d] = re[d]/15;
+
+      if(Im == NULL)
+        continue;
+      double im[3] = {0, 0, 0};
+      for(int l=0; l<=j; l++)
+      {
+        effsource_mode_jet_mul(mC[j-l], ql[l+1], t);
+        for(int d=0; d<3; d++)
+          im[d] += binomial[j][l]*m/(10-4*l)*t[d];
+      }
+      for(int d=0; d<3; d++)
+        Im[m-m0][j][d] = im[d]/15;
+    }
+  }
+}
@@ -0,0 +1,422 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Barry Wardell
+ ******************************************************************************/
+
+/* Parallel evaluation on lists of grid patches, shared by kerr-circular.c and
+   kerr-equatorial.c. Each patch is split into tiles, tiles outside the
+   support of the caller's window are dropped and the rest are evaluated with
+   effsource_calc_grid_ctx or effsource_calc_m_grid_ctx by a persistent pool of
+   threads. The threads take tiles from a shared counter, so a thread which
+   finishes early simply takes the next tile. Each tile is computed into a
+   per-thread buffer and then copied to the patch's outputs. Jobs wait in a
+   queue, so asynchronous jobs may run while the caller does something else. */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Number of points along each direction of a tile, for the full field and for
+   m-modes. The outputs for a tile, 16 and 32 components per point, then take
+   EFFSOURCE_TILE_BUF doubles either way. */
+enum { EFFSOURCE_TILE_3D = 8, EFFSOURCE_TILE_2D = 16, EFFSOURCE_TILE_BUF = 8192 };
+
+struct effsource_tile {
+  const struct effsource_patch * patch;
+  int i0, j0, l0, ni, nj, nl;
+};
+
+struct effsource_job {
+  effsource_ctx * ctx;
+  int m;              /* the mode, or -1 for the full field */
+  int ntiles;
+  struct effsource_tile * tiles;
+  struct effsource_patch * patches;  /* copies of the caller's patches, if any */
+  int owns_ctx;       /* whether ctx is a snapshot to be freed with the job */
+  int next;           /* the next tile to be evaluated */
+  int finished;       /* the number of tiles evaluated */
+  int nthreads;       /* the number of threads of the pool it may use */
+  int workers;        /* the number of threads of the pool working on it */
+  int failed;
+  int done;
+  struct effsource_job * queue_next;
+};
+
+/* Threads of the pool take jobs with tiles left from the queue. The lock
+   protects the queue and the workers and done fields of the jobs. */
+static struct {
+  pthread_mutex_t lock;
+  pthread_cond_t wake, done;
+  pthread_t * threads;
+  int nthreads;
+  struct effsource_job * queue;
+  int quit;
+} effsource_pool = {.lock = PTHREAD_MUTEX_INITIALIZER,
+                    .wake = PTHREAD_COND_INITIALIZER,
+                    .done = PTHREAD_COND_INITIALIZER};
+
+static inline int effsource_imin(int a, int b)
+{
+  return a < b ? a : b;
+}
+
+/* Whether the tile lies outside the support of the window of radius W */
+static int effsource_tile_culled(effsource_ctx * ctx, const struct effsource_tile * t,
+  int m, double W)
+{
+  const struct effsource_patch * p = t->patch;
+  struct effsource_box box;
+  const int i0[3] = {t->i0, t->j0, t->l0}, n[3] = {t->ni, t->nj, t->nl};
+  for(int d = 0; d < 3; d++)
+  {
+    const double a = p->origin[d] + i0[d]*p->spacing[d];
+    const double b = p->origin[d] + (i0[d] + n[d] - 1)*p->spacing[d];
+    box.lo[d] = fmin(a, b);
+    box.hi[d] = fmax(a, b);
+  }
+
+  /* m-modes cover all phi */
+  if(m >= 0)
+  {
+    box.lo[2] = 0.0;
+    box.hi[2] = 2.0*M_PI;
+  }
+
+  return !effsource_box_intersects_ctx(ctx, W, &box);
+}
+
+/* Copy the n components of a tile's output, stored with stride ntile, to the
+   patch */
+static void effsource_tile_scatter(const struct effsource_tile * t, int nlt, int n,
+  const double * src, int ntile, double * dst)
+{
+  if(dst == NULL)
+    return;
+  const long * s = t->patch->stride;
+  for(int k = 0; k < n; k++)
+    for(int i = 0; i < t->ni; i++)
+      for(int j = 0; j < t->nj; j++)
+        for(int l = 0; l < nlt; l++)
+          dst[k*s[3] + (t->i0+i)*s[0] + (t->j0+j)*s[1] + (t->l0+l)*s[2]] =
+            src[k*ntile + (i*t->nj + j)*nlt + l];
+}
+
+static void effsource_tile_eval(const struct effsource_job * job,
+  const struct effsource_tile * t, double * buf)
+{
+  const struct effsource_patch * p = t->patch;
+  double r[EFFSOURCE_TILE_2D], theta[EFFSOURCE_TILE_2D];
+  for(int i = 0; i < t->ni; i++)
+    r[i] = p->origin[0] + (t->i0 + i)*p->spacing[0];
+  for(int j = 0; j < t->nj; j++)
+    theta[j] = p->origin[1] + (t->j0 + j)*p->spacing[1];
+
+  if(job->m < 0)
+  {
+    const int n = t->ni*t->nj*t->nl;
+    double * PhiS = buf, * dPhiS_dx = PhiS + n, * d2PhiS_dx2 = dPhiS_dx + 4*n,
+           * src = d2PhiS_dx2 + 10*n;
+    effsource_calc_grid_ctx(job->ctx, t->ni, r, t->nj, theta, t->nl,
+      p->origin[2] + t->l0*p->spacing[2], p->spacing[2], n,
+      PhiS, dPhiS_dx, d2PhiS_dx2, src);
+    effsource_tile_scatter(t, t->nl, 1, PhiS, n, p->PhiS);
+    effsource_tile_scatter(t, t->nl, 4, dPhiS_dx, n, p->dPhiS_dx);
+    effsource_tile_scatter(t, t->nl, 10, d2PhiS_dx2, n, p->d2PhiS_dx2);
+    effsource_tile_scatter(t, t->nl, 1, src, n, p->src);
+  }
+  else
+  {
+    const int n = t->ni*t->nj;
+    double * PhiS = buf, * dPhiS_dx = PhiS + 2*n, * d2PhiS_dx2 = dPhiS_dx + 8*n,
+           * src = d2PhiS_dx2 + 20*n;
+    effsource_calc_m_grid_ctx(job->ctx, job->m, t->ni, r, t->nj, theta, n,
+      PhiS, dPhiS_dx, d2PhiS_dx2, src);
+    effsource_tile_scatter(t, 1, 2, PhiS, n, p->PhiS);
+    effsource_tile_scatter(t, 1, 8, dPhiS_dx, n, p->dPhiS_dx);
+    effsource_tile_scatter(t, 1, 20, d2PhiS_dx2, n, p->d2PhiS_dx2);
+    effsource_tile_scatter(t, 1, 2, src, n, p->src);
+  }
+}
+
+/* Evaluate tiles of the job until there are none left to take. Whoever
+   evaluates the last tile marks the job done. */
+static void effsource_job_work(struct effsource_job * job)
+{
+  double * buf = malloc(EFFSOURCE_TILE_BUF*sizeof(double));
+  if(buf == NULL)
+    __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+
+  int i, n = 0;
+  while((i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < job->ntiles)
+  {
+    if(buf != NULL)
+      effsource_tile_eval(job, &job->tiles[i], buf);
+    n++;
+  }
+  free(buf);
+
+  if(n > 0 && __atomic_add_fetch(&job->finished, n, __ATOMIC_ACQ_REL) == job->ntiles)
+  {
+    pthread_mutex_lock(&effsource_pool.lock);
+    job->done = 1;
+    pthread_cond_broadcast(&effsource_pool.done);
+    pthread_mutex_unlock(&effsource_pool.lock);
+  }
+}
+
+/* Remove the job from the queue. Called with lock held. */
+static void effsource_queue_remove(struct effsource_job * job)
+{
+  for(struct effsource_job ** q = &effsource_pool.queue; *q != NULL; q = &(*q)->queue_next)
+    if(*q == job)
+    {
+      *q = job->queue_next;
+      return;
+    }
+}
+
+/* The first job in the queue with tiles left and room for another thread.
+   Jobs without tiles left are removed. Called with lock held. */
+static struct effsource_job * effsource_queue_take(void)
+{
+  struct effsource_job ** q = &effsource_pool.queue;
+  while(*q != NULL)
+  {
+    struct effsource_job * job = *q;
+    if(__atomic_load_n(&job->next, __ATOMIC_RELAXED) >= job->ntiles)
+      *q = job->queue_next;
+    else if(job->workers < job->nthreads)
+      return job;
+    else
+      q = &job->queue_next;
+  }
+  return NULL;
+}
+
+static void * effsource_pool_main(void * arg)
+{
+  (void) arg;
+
+  pthread_mutex_lock(&effsource_pool.lock);
+  for(;;)
+  {
+    struct effsource_job * job = NULL;
+    while(!effsource_pool.quit && (job = effsource_queue_take()) == NULL)
+      pthread_cond_wait(&effsource_pool.wake, &effsource_pool.lock);
+    if(effsource_pool.quit)
+      break;
+    job->workers++;
+    pthread_mutex_unlock(&effsource_pool.lock);
+
+    effsource_job_work(job);
+
+    pthread_mutex_lock(&effsource_pool.lock);
+    if(--job->workers == 0 && job->done)
+      pthread_cond_broadcast(&effsource_pool.done);
+  }
+  pthread_mutex_unlock(&effsource_pool.lock);
+
+  return NULL;
+}
+
+/* Start threads until the pool has n of them. Called with lock held. */
+static void effsource_pool_grow(int n)
+{
+  if(n <= effsource_pool.nthreads)
+    return;
+  pthread_t * threads = realloc(effsource_pool.threads, n*sizeof(pthread_t));
+  if(threads == NULL)
+    return;
+  effsource_pool.threads = threads;
+
+  while(effsource_pool.nthreads < n)
+  {
+    if(pthread_create(&threads[effsource_pool.nthreads], NULL, effsource_pool_main, NULL) != 0)
+      return;
+    effsource_pool.nthreads++;
+  }
+}
+
+/* Stop the threads of the pool. There must be no jobs outstanding. */
+static void effsource_pool_free_threads(void)
+{
+  pthread_mutex_lock(&effsource_pool.lock);
+  effsource_pool.quit = 1;
+  pthread_cond_broadcast(&effsource_pool.wake);
+  pthread_mutex_unlock(&effsource_pool.lock);
+
+  for(int i = 0; i < effsource_pool.nthreads; i++)
+    pthread_join(effsource_pool.threads[i], NULL);
+
+  pthread_mutex_lock(&effsource_pool.lock);
+  free(effsource_pool.threads);
+  effsource_pool.threads = NULL;
+  effsource_pool.nthreads = 0;
+  effsource_pool.quit = 0;
+  pthread_mutex_unlock(&effsource_pool.lock);
+}
+
+/* Queue the job for up to job->nthreads threads of the pool. If no threads
+   can be started it is evaluated by the caller. */
+static void effsource_job_submit(struct effsource_job * job)
+{
+  pthread_mutex_lock(&effsource_pool.lock);
+  effsource_pool_grow(job->nthreads);
+  if(job->nthreads > effsource_pool.nthreads)
+    job->nthreads = effsource_pool.nthreads;
+  if(job->nthreads > 0)
+  {
+    struct effsource_job ** q = &effsource_pool.queue;
+    while(*q != NULL)
+      q = &(*q)->queue_next;
+    *q = job;
+    pthread_cond_broadcast(&effsource_pool.wake);
+  }
+  pthread_mutex_unlock(&effsource_pool.lock);
+
+  if(job->nthreads == 0)
+    effsource_job_work(job);
+}
+
+/* Whether the job is done and no thread of the pool still refers to it */
+static int effsource_job_finished(struct effsource_job * job)
+{
+  pthread_mutex_lock(&effsource_pool.lock);
+  const int finished = job->done && job->workers == 0;
+  pthread_mutex_unlock(&effsource_pool.lock);
+  return finished;
+}
+
+/* Wait for the job to finish and free it. Returns 0 on success and -1 if
+   memory could not be allocated. */
+static int effsource_job_complete(struct effsource_job * job)
+{
+  pthread_mutex_lock(&effsource_pool.lock);
+  while(!job->done || job->workers > 0)
+    pthread_cond_wait(&effsource_pool.done, &effsource_pool.lock);
+  effsource_queue_remove(job);
+  pthread_mutex_unlock(&effsource_pool.lock);
+
+  const int failed = job->failed;
+  if(job->owns_ctx)
+    effsource_ctx_free(job->ctx);
+  free(job->patches);
+  free(job->tiles);
+  free(job);
+  return failed ? -1 : 0;
+}
+
+/* Tiles of finer patches are started first */
+static int effsource_tile_cmp(const void * a, const void * b)
+{
+  const struct effsource_tile * s = a, * t = b;
+  return (t->patch->level > s->patch->level) - (t->patch->level < s->patch->level);
+}
+
+/* Split the patches into tiles for evaluating mode m, or the full field if
+   m < 0, with nthreads threads. If copy is set the job keeps its own copy of
+   the patches. */
+static struct effsource_job * effsource_job_create(effsource_ctx * ctx, int m,
+  int npatches, const struct effsource_patch * patches, double window, int nthreads,
+  int copy)
+{
+  const int tile[3] = {m < 0 ? EFFSOURCE_TILE_3D : EFFSOURCE_TILE_2D,
+                       m < 0 ? EFFSOURCE_TILE_3D : EFFSOURCE_TILE_2D,
+                       m < 0 ? EFFSOURCE_TILE_3D : 1};
+
+  long ntiles = 0;
+  for(int p = 0; p < npatches; p++)
+  {
+    long n = 1;
+    for(int d = 0; d < (m < 0 ? 3 : 2); d++)
+      n *= patches[p].extent[d] > 0 ? (patches[p].extent[d] + tile[d] - 1)/tile[d] : 0;
+    ntiles += n;
+  }
+
+  struct effsource_job * job = calloc(1, sizeof(struct effsource_job));
+  if(job == NULL)
+    return NULL;
+  job->ctx = ctx;
+  job->m = m;
+  job->tiles = malloc((ntiles > 0 ? ntiles : 1)*sizeof(struct effsource_tile));
+  if(copy)
+  {
+    job->patches = malloc((npatches > 0 ? npatches : 1)*sizeof(struct effsource_patch));
+    if(job->patches != NULL)
+      memcpy(job->patches, patches, npatches*sizeof(struct effsource_patch));
+    patches = job->patches;
+  }
+  if(job->tiles == NULL || patches == NULL)
+  {
+    free(job->tiles);
+    free(job->patches);
+    free(job);
+    return NULL;
+  }
+
+  for(int p = 0; p < npatches; p++)
+  {
+    const struct effsource_patch * patch = &patches[p];
+    const int nl = m < 0 ? patch->extent[2] : 1;
+    for(int i = 0; i < patch->extent[0]; i += tile[0])
+      for(int j = 0; j < patch->extent[1]; j += tile[1])
+        for(int l = 0; l < nl; l += tile[2])
+        {
+          struct effsource_tile t = {patch, i, j, l,
+            effsource_imin(tile[0], patch->extent[0] - i),
+            effsource_imin(tile[1], patch->extent[1] - j), effsource_imin(tile[2], nl - l)};
+          if(window <= 0.0 || !effsource_tile_culled(ctx, &t, m, window))
+            job->tiles[job->ntiles++] = t;
+        }
+  }
+  qsort(job->tiles, job->ntiles, sizeof(struct effsource_tile), effsource_tile_cmp);
+
+  if(nthreads <= 0)
+    nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+  job->nthreads = effsource_imin(nthreads, job->ntiles);
+  job->done = job->ntiles == 0;
+
+  return job;
+}
+
+/* Evaluate mode m, or the full field if m < 0, on the patches. The caller is
+   one of the nthreads threads. */
+static int effsource_patches_eval(effsource_ctx * ctx, int m, int npatches,
+  const struct effsource_patch * patches, double window, int nthreads)
+{
+  struct effsource_job * job = effsource_job_create(ctx, m, npatches, patches,
+    window, nthreads, 0);
+  if(job == NULL)
+    return -1;
+
+  if(job->nthreads > 1)
+  {
+    job->nthreads--;
+    effsource_job_submit(job);
+  }
+  effsource_job_work(job);
+
+  return effsource_job_complete(job);
+}
+
+/* Queue the evaluation of mode m, or the full field if m < 0, on the patches
+   for nthreads threads of the pool. The job owns snapshot, a copy of the
+   particle's state, and frees it when it completes. */
+static struct effsource_job * effsource_patches_submit(effsource_ctx * snapshot, int m,
+  int npatches, const struct effsource_patch * patches, double window, int nthreads)
+{
+  struct effsource_job * job = effsource_job_create(snapshot, m, npatches, patches,
+    window, nthreads, 1);
+  if(job == NULL)
+  {
+    effsource_ctx_free(snapshot);
+    return NULL;
+  }
+  job->owns_ctx = 1;
+
+  if(!job->done)
+    effsource_job_submit(job);
+
+  return job;
+}
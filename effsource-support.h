@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Barry Wardell
+ ******************************************************************************/
+
+/* The support of the effective source for a window of radius W, shared by
+   kerr-circular.c and kerr-equatorial.c. The expansions are in powers of
+     s^2 = alpha20 dr^2 + alpha02 dtheta^2 + beta sin^2(dphib/2),
+   with dphib = dphi - c dr (c = 0 for circular orbits), and the support is
+   the region s^2 <= W^2. */
+
+#include <math.h>
+
+/* Bounding box of the support in (r, theta, phi) */
+static void effsource_support_box(const struct coordinate * xp, double alpha20,
+  double alpha02, double beta, double c, double W, struct effsource_box * box)
+{
+  const double hr = W/sqrt(alpha20);
+  const double htheta = W/sqrt(alpha02);
+  const double hphib = W*W >= beta ? M_PI : 2.0*asin(W/sqrt(beta));
+  const double hphi = fmin(hphib + fabs(c)*hr, M_PI);
+
+  box->lo[0] = xp->r - hr;
+  box->hi[0] = xp->r + hr;
+  box->lo[1] = fmax(xp->theta - htheta, 0.0);
+  box->hi[1] = fmin(xp->theta + htheta, M_PI);
+  box->lo[2] = xp->phi - hphi;
+  box->hi[2] = xp->phi + hphi;
+}
+
+/* Range of cos(x) for x0 <= x <= x1 */
+static void effsource_cos_range(double x0, double x1, double * lo, double * hi)
+{
+  *lo = fmin(cos(x0), cos(x1));
+  *hi = fmax(cos(x0), cos(x1));
+  if(floor(x1/(2.0*M_PI)) > floor(x0/(2.0*M_PI)))
+    *hi = 1.0;
+  if(floor((x1 - M_PI)/(2.0*M_PI)) > floor((x0 - M_PI)/(2.0*M_PI)))
+    *lo = -1.0;
+}
+
+/* Bounding box in the Cartesian coordinates
+     (x, y, z) = (sqrt(r^2+a^2) sin(theta) cos(phi),
+                  sqrt(r^2+a^2) sin(theta) sin(phi), r cos(theta))
+   of the box sph in (r, theta, phi) */
+static void effsource_box_cartesian(double a, const struct effsource_box * sph,
+  struct effsource_box * box)
+{
+  const double r0 = fmax(sph->lo[0], 0.0), r1 = fmax(sph->hi[0], 0.0);
+
+  /* sin(theta) and cos(theta) for 0 <= theta <= pi */
+  double sin0 = fmin(sin(sph->lo[1]), sin(sph->hi[1]));
+  double sin1 = fmax(sin(sph->lo[1]), sin(sph->hi[1]));
+  if(sph->lo[1] <= M_PI_2 && sph->hi[1] >= M_PI_2)
+    sin1 = 1.0;
+  const double cos0 = cos(sph->hi[1]), cos1 = cos(sph->lo[1]);
+
+  /* Cylindrical radius */
+  const double rho0 = sqrt(r0*r0 + a*a)*sin0, rho1 = sqrt(r1*r1 + a*a)*sin1;
+
+  double c0, c1, s0, s1;
+  effsource_cos_range(sph->lo[2], sph->hi[2], &c0, &c1);
+  effsource_cos_range(sph->lo[2] - M_PI_2, sph->hi[2] - M_PI_2, &s0, &s1);
+
+  box->lo[0] = fmin(rho0*c0, rho1*c0);
+  box->hi[0] = fmax(rho0*c1, rho1*c1);
+  box->lo[1] = fmin(rho0*s0, rho1*s0);
+  box->hi[1] = fmax(rho0*s1, rho1*s1);
+  box->lo[2] = fmin(r0*cos0, r1*cos0);
+  box->hi[2] = fmax(r0*cos1, r1*cos1);
+}
+
+/* Whether the box in (r, theta, phi) may intersect the support. The minimum of
+   s^2 over the box is bounded below by the sum of the minima of its three
+   terms, the last over the range of dphib spanned by the box. */
+static int effsource_support_intersects(const struct coordinate * xp, double alpha20,
+  double alpha02, double beta, double c, double W, const struct effsource_box * box)
+{
+  const double dr0 = box->lo[0] - xp->r, dr1 = box->hi[0] - xp->r;
+  const double dtheta0 = box->lo[1] - xp->theta, dtheta1 = box->hi[1] - xp->theta;
+  const double dr = dr0 > 0.0 ? dr0 : (dr1 < 0.0 ? -dr1 : 0.0);
+  const double dtheta = dtheta0 > 0.0 ? dtheta0 : (dtheta1 < 0.0 ? -dtheta1 : 0.0);
+
+  const double dphib0 = box->lo[2] - xp->phi - fmax(c*dr0, c*dr1);
+  const double dphib1 = box->hi[2] - xp->phi - fmin(c*dr0, c*dr1);
+  double Q2 = 0.0;
+  if(ceil(dphib0/(2.0*M_PI)) > floor(dphib1/(2.0*M_PI)))
+  {
+    const double Q0 = sin(0.5*dphib0), Q1 = sin(0.5*dphib1);
+    Q2 = fmin(Q0*Q0, Q1*Q1);
+  }
+
+  return alpha20*dr*dr + alpha02*dtheta*dtheta + beta*Q2 <= W*W;
+}
@@ -12,6 +12,26 @@ struct coordinate {
 void effsource_init(double M, double a);
 void effsource_set_particle(struct coordinate * x_p, double e, double l, double ur_p);
 
+/* The particle's state is double-buffered: effsource_set_particle_next
+   prepares the next state, e.g. on a helper thread while other threads are
+   still evaluating with the current one, and effsource_swap atomically makes
+   it current. effsource_swap does nothing unless a state has been prepared
+   since the last swap. After a swap the next state is prepared in the slot
+   that was current before it, so it must not be prepared again while
+   evaluations that started before the swap may still be reading it. */
+void effsource_set_particle_next(struct coordinate * x_p, double e, double l, double ur_p);
+void effsource_swap(void);
+
+/* Both states use one orbit fit and one shared memory object, so a leader may
+   publish from effsource_set_particle_next and effsource_advance at once */
+int effsource_fit_orbit(double e, double l, double r_min, double r_max, double tol);
+int effsource_fit_save(const char * filename);
+int effsource_fit_load(const char * filename);
+int effsource_advance(double dt, double tol);
+int effsource_share(const char * name, int leader, double timeout);
+void effsource_unshare(void);
+int effsource_share_served(void);
+
 void effsource_PhiS(struct coordinate * x, double * PhiS);
 void effsource_calc(struct coordinate * x,
   double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
@@ -19,3 +39,228 @@ void effsource_calc(struct coordinate * x,
 void effsource_PhiS_m(int m, struct coordinate * x, double * PhiS);
 void effsource_calc_m(int m, struct coordinate * x,
   double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+void effsource_calc_allm(int m_max, struct coordinate * x,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+void effsource_calc_m_batch(int m, int n, const double * r, const double * theta,
+  int stride, double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+void effsource_calc_m_grid(int m, int nr, const double * r, int ntheta,
+  const double * theta, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+void effsource_calc_batch(int n, const double * r, const double * theta,
+  const double * phi, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+void effsource_calc_grid(int nr, const double * r, int ntheta, const double * theta,
+  int nphi, double phi0, double dphi, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+
+/* A block of up to EFFSOURCE_LANES points passed to the kernel of
+   effsource_calc_m_batch_fn and effsource_calc_m_grid_fn. Component k of each
+   output for lane b is at index k*EFFSOURCE_LANES+b, and index[b] is the
+   point's index in the batch or its index i*ntheta+j in the grid. */
+#define EFFSOURCE_LANES 16
+
+struct effsource_m_lanes {
+  int n;
+  int index[EFFSOURCE_LANES];
+  double r[EFFSOURCE_LANES], theta[EFFSOURCE_LANES];
+  double PhiS[2*EFFSOURCE_LANES], dPhiS_dx[8*EFFSOURCE_LANES],
+         d2PhiS_dx2[20*EFFSOURCE_LANES], src[2*EFFSOURCE_LANES];
+};
+
+typedef void (* effsource_m_kernel)(const struct effsource_m_lanes * lanes, void * data);
+
+void effsource_calc_m_batch_fn(int m, int n, const double * r, const double * theta,
+  effsource_m_kernel kernel, void * data);
+void effsource_calc_m_grid_fn(int m, int nr, const double * r, int ntheta,
+  const double * theta, effsource_m_kernel kernel, void * data);
+
+/* A box lo[d] <= x[d] <= hi[d], either in (r, theta, phi) or in the Cartesian
+   coordinates (x, y, z) = (sqrt(r^2+a^2) sin(theta) cos(phi),
+   sqrt(r^2+a^2) sin(theta) sin(phi), r cos(theta)). */
+struct effsource_box {
+  double lo[3], hi[3];
+};
+
+void effsource_support(double W, struct effsource_box * box);
+void effsource_support_cartesian(double W, struct effsource_box * box);
+int effsource_box_intersects(double W, const struct effsource_box * box);
+
+/* A patch of grid points (origin[0]+i*spacing[0], origin[1]+j*spacing[1],
+   origin[2]+l*spacing[2]) in (r, theta, phi) with 0 <= i < extent[0],
+   0 <= j < extent[1] and 0 <= l < extent[2]. Component k of each output for
+   point (i, j, l) is stored at index
+   k*stride[3]+i*stride[0]+j*stride[1]+l*stride[2]. Outputs which are NULL are
+   not stored. For m-modes the phi direction is ignored. Tiles of patches with
+   higher refinement levels are evaluated first. */
+struct effsource_patch {
+  double origin[3], spacing[3];
+  int extent[3];
+  int level;
+  long stride[4];
+  double * PhiS, * dPhiS_dx, * d2PhiS_dx2, * src;
+};
+
+int effsource_calc_patches(int npatches, const struct effsource_patch * patches,
+  double window, int nthreads);
+int effsource_calc_m_patches(int m, int npatches, const struct effsource_patch * patches,
+  double window, int nthreads);
+typedef struct effsource_job effsource_job;
+
+effsource_job * effsource_calc_patches_async(int npatches,
+  const struct effsource_patch * patches, double window, int nthreads);
+effsource_job * effsource_calc_m_patches_async(int m, int npatches,
+  const struct effsource_patch * patches, double window, int nthreads);
+int effsource_job_test(effsource_job * job);
+int effsource_job_wait(effsource_job * job);
+void effsource_pool_free(void);
+
+/* Reentrant interface. A context owns the black hole parameters, the
+   particle's state and all coefficients derived from them. Distinct contexts
+   are independent and may be used concurrently from different threads; the
+   functions above operate on built-in contexts. */
+typedef struct effsource_ctx effsource_ctx;
+
+effsource_ctx * effsource_ctx_alloc(void);
+void effsource_ctx_free(effsource_ctx * ctx);
+
+void effsource_init_ctx(effsource_ctx * ctx, double M, double a);
+void effsource_set_particle_ctx(effsource_ctx * ctx, struct coordinate * x_p,
+  double e, double l, double ur_p);
+
+/* Fit the coefficients computed by effsource_set_particle_ctx along the orbit
+   with constants of motion e and l to piecewise Chebyshev series in r_p over
+   r_min <= r_p <= r_max, with a relative error of about tol. Subsequent calls
+   to effsource_set_particle_ctx for this orbit and range evaluate the fits.
+   Returns 0 on success and -1 if the fit could not be constructed, e.g. if the
+   range extends beyond the turning points of the orbit. */
+int effsource_fit_orbit_ctx(effsource_ctx * ctx, double e, double l,
+  double r_min, double r_max, double tol);
+
+/* Save the fits to a file, or replace them with those in a file written with
+   the same black hole parameters. Loaded fits are mapped read-only, so
+   processes loading the same file share one copy in the page cache. Both
+   return 0 on success and -1 on failure. */
+int effsource_fit_save_ctx(effsource_ctx * ctx, const char * filename);
+int effsource_fit_load_ctx(effsource_ctx * ctx, const char * filename);
+
+/* Share the coefficients between processes, e.g. the MPI ranks on a node,
+   which call effsource_set_particle_ctx with the same arguments. The leader
+   (leader non-zero) creates the POSIX shared memory object name and publishes
+   the coefficients it computes; the other processes copy them from there
+   instead of computing them, or compute them themselves if the object is not
+   created and the coefficients published within timeout seconds. If
+   timeout < 0 they wait until the coefficients are published. There must be exactly one leader per name.
+   Returns 0 on success and -1 on failure. effsource_unshare_ctx stops sharing
+   and the leader removes the object. effsource_share_served_ctx returns 1 if
+   the last call to effsource_set_particle_ctx copied the coefficients from the
+   leader and 0 otherwise. */
+int effsource_share_ctx(effsource_ctx * ctx, const char * name, int leader,
+  double timeout);
+void effsource_unshare_ctx(effsource_ctx * ctx);
+int effsource_share_served_ctx(effsource_ctx * ctx);
+
+/* Move the particle along its orbit from t to t+dt, e.g. between the substeps
+   of a Runge-Kutta integrator, by extrapolating the coefficients with their
+   time derivatives. tol bounds the error of the effective source relative to
+   its magnitude a distance M from the particle, accumulated since the
+   coefficients were last computed; if the estimated error exceeds it the
+   coefficients are recomputed at the new position instead. Returns 0 if they
+   were extrapolated and 1 if they were recomputed. */
+int effsource_advance_ctx(effsource_ctx * ctx, double dt, double tol);
+
+/* The source is only needed near the particle, within a window of radius W
+   in s = sqrt(alpha20 dr^2 + alpha02 dtheta^2 + beta sin^2(dphi/2)), the
+   distance in which the coefficients are expanded (with dphi shifted by c dr
+   for eccentric orbits). effsource_support_ctx returns a conservative
+   bounding box of the region s <= W in (r, theta, phi), with phi within pi of
+   the particle's, and effsource_support_cartesian_ctx one in Cartesian
+   coordinates. effsource_box_intersects_ctx returns zero if the box in
+   (r, theta, phi) certainly lies outside that region and non-zero otherwise;
+   phi is periodic. */
+void effsource_support_ctx(effsource_ctx * ctx, double W, struct effsource_box * box);
+void effsource_support_cartesian_ctx(effsource_ctx * ctx, double W,
+  struct effsource_box * box);
+int effsource_box_intersects_ctx(effsource_ctx * ctx, double W,
+  const struct effsource_box * box);
+
+void effsource_PhiS_ctx(effsource_ctx * ctx, struct coordinate * x, double * PhiS);
+void effsource_calc_ctx(effsource_ctx * ctx, struct coordinate * x,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+
+/* The m-mode functions accept any m >= 0. The coefficients for m > 20 are
+   generated the first time a mode higher than any before is requested. If
+   m < 0 or they cannot be allocated, the functions below return without
+   writing their outputs, and the patch functions return -1 or NULL. */
+void effsource_PhiS_m_ctx(effsource_ctx * ctx, int m, struct coordinate * x, double * PhiS);
+void effsource_calc_m_ctx(effsource_ctx * ctx, int m, struct coordinate * x,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+
+/* Compute all modes 0 <= m <= m_max at once. The outputs for mode m start at
+   PhiS+2*m, dPhiS_dx+8*m, d2PhiS_dx2+20*m and src+2*m. */
+void effsource_calc_allm_ctx(effsource_ctx * ctx, int m_max, struct coordinate * x,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+
+/* Compute the m-mode at n points (r[i], theta[i]). Component k of each output
+   for point i is stored at index k*stride+i, where stride >= n. */
+void effsource_calc_m_batch_ctx(effsource_ctx * ctx, int m, int n,
+  const double * r, const double * theta, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+
+/* Compute the m-mode on the nr x ntheta grid of points (r[i], theta[j]).
+   Component k of each output for point (i, j) is stored at index
+   k*stride+i*ntheta+j, where stride >= nr*ntheta. */
+void effsource_calc_m_grid_ctx(effsource_ctx * ctx, int m, int nr,
+  const double * r, int ntheta, const double * theta, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+
+/* Fused versions of effsource_calc_m_batch_ctx and effsource_calc_m_grid_ctx
+   which, instead of storing the outputs, call kernel(lanes, data) for each
+   block of up to EFFSOURCE_LANES points (see struct effsource_m_lanes). The
+   block is only valid during the call, so the kernel can e.g. add src straight
+   into a right-hand side. */
+void effsource_calc_m_batch_fn_ctx(effsource_ctx * ctx, int m, int n,
+  const double * r, const double * theta, effsource_m_kernel kernel, void * data);
+void effsource_calc_m_grid_fn_ctx(effsource_ctx * ctx, int m, int nr,
+  const double * r, int ntheta, const double * theta, effsource_m_kernel kernel,
+  void * data);
+
+/* Compute the singular field and effective source at the n points
+   (r[i], theta[i], phi[i]). Component k of each output for point i is stored at
+   index k*stride+i, where stride >= n. */
+void effsource_calc_batch_ctx(effsource_ctx * ctx, int n, const double * r,
+  const double * theta, const double * phi, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+
+/* Compute the singular field and effective source on the nr x ntheta x nphi
+   grid of points (r[i], theta[j], phi0+l*dphi). Component k of each output for
+   point (i, j, l) is stored at index k*stride+(i*ntheta+j)*nphi+l, where
+   stride >= nr*ntheta*nphi. */
+void effsource_calc_grid_ctx(effsource_ctx * ctx, int nr, const double * r,
+  int ntheta, const double * theta, int nphi, double phi0, double dphi, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src);
+
+/* Compute the singular field and effective source, or mode m, on a list of
+   patches in parallel. The patches are split into tiles which are evaluated by
+   nthreads threads, including the caller, taken from a persistent pool; if
+   nthreads <= 0 one thread per processor is used. If window > 0, tiles which
+   do not intersect the support of a window of that radius are skipped and
+   their outputs left unchanged. Returns 0 on success and -1 if memory could
+   not be allocated. effsource_pool_free stops the threads of the pool; no
+   jobs may be outstanding. */
+int effsource_calc_patches_ctx(effsource_ctx * ctx, int npatches,
+  const struct effsource_patch * patches, double window, int nthreads);
+int effsource_calc_m_patches_ctx(effsource_ctx * ctx, int m, int npatches,
+  const struct effsource_patch * patches, double window, int nthreads);
+
+/* Asynchronous versions of the above. The evaluation is queued for nthreads
+   threads of the pool, not including the caller, against a snapshot of the
+   particle's state, so the context may be changed while it runs. The output
+   arrays must stay valid until the job completes. effsource_job_test returns
+   non-zero once the job has finished and effsource_job_wait waits for it,
+   frees it and returns 0 on success or -1 if memory could not be allocated.
+   Every job must be passed to effsource_job_wait. Returns NULL if the job
+   could not be created. */
+effsource_job * effsource_calc_patches_async_ctx(effsource_ctx * ctx, int npatches,
+  const struct effsource_patch * patches, double window, int nthreads);
+effsource_job * effsource_calc_m_patches_async_ctx(effsource_ctx * ctx, int m,
+  int npatches, const struct effsource_patch * patches, double window, int nthreads);
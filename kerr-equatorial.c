@@ -3,97 +3,345 @@
  ******************************************************************************/
 
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include "effsource.h"
 #include <stdio.h>
-#include <gsl/gsl_sf_ellint.h>
-
-/* The particle's coordinate location and 4-velocity */
-extern struct coordinate xp;
-
-/* Mass and spin of the Kerr black hole */
-extern double M, a;
-
-/* Static variables used to store the coefficients of the series expansions */
-extern double A0060, A0061, A0080, A0081, A0240, A0241, A0260, A0261, A0420, A0421, A0440, A0441, A0600, A0601, A0620, A0621, A0800, A0801, A1060, A1061, A1080, A1240, A1241, A1260, A1420, A1421, A1440, A1600, A1601, A1620, A1800, A2040, A2041, A2060, A2061, A2220, A2221, A2240, A2241, A2400, A2401, A2420, A2421, A2600, A2601, A3040, A3041, A3060, A3220, A3221, A3240, A3400, A3401, A3420, A3600, A4020, A4021, A4040, A4041, A4200, A4201, A4220, A4221, A4400, A4401, A5020, A5021, A5040, A5200, A5201, A5220, A5400, A6000, A6001, A6020, A6021, A6200, A6201, A7000, A7001, A7020, A7200, A8000, A8001, A9000;
-extern double dAdt0060, dAdt0061, dAdt0080, dAdt0081, dAdt0240, dAdt0241, dAdt0260, dAdt0261, dAdt0420, dAdt0421, dAdt0440, dAdt0441, dAdt0600, dAdt0601, dAdt0620, dAdt0621, dAdt0800, dAdt0801, dAdt1060, dAdt1061, dAdt1080, dAdt1240, dAdt1241, dAdt1260, dAdt1420, dAdt1421, dAdt1440, dAdt1600, dAdt1601, dAdt1620, dAdt1800, dAdt2040, dAdt2041, dAdt2060, dAdt2061, dAdt2220, dAdt2221, dAdt2240, dAdt2241, dAdt2400, dAdt2401, dAdt2420, dAdt2421, dAdt2600, dAdt2601, dAdt3040, dAdt3041, dAdt3060, dAdt3220, dAdt3221, dAdt3240, dAdt3400, dAdt3401, dAdt3420, dAdt3600, dAdt4020, dAdt4021, dAdt4040, dAdt4041, dAdt4200, dAdt4201, dAdt4220, dAdt4221, dAdt4400, dAdt4401, dAdt5020, dAdt5021, dAdt5040, dAdt5200, dAdt5201, dAdt5220, dAdt5400, dAdt6000, dAdt6001, dAdt6020, dAdt6021, dAdt6200, dAdt6201, dAdt7000, dAdt7001, dAdt7020, dAdt7200, dAdt8000, dAdt8001, dAdt9000;
-extern double d2Adt20060, d2Adt20061, d2Adt20080, d2Adt20081, d2Adt20240, d2Adt20241, d2Adt20260, d2Adt20261, d2Adt20420, d2Adt20421, d2Adt20440, d2Adt20441, d2Adt20600, d2Adt20601, d2Adt20620, d2Adt20621, d2Adt20800, d2Adt20801, d2Adt21060, d2Adt21061, d2Adt21080, d2Adt21240, d2Adt21241, d2Adt21260, d2Adt21420, d2Adt21421, d2Adt21440, d2Adt21600, d2Adt21601, d2Adt21620, d2Adt21800, d2Adt22040, d2Adt22041, d2Adt22060, d2Adt22061, d2Adt22220, d2Adt22221, d2Adt22240, d2Adt22241, d2Adt22400, d2Adt22401, d2Adt22420, d2Adt22421, d2Adt22600, d2Adt22601, d2Adt23040, d2Adt23041, d2Adt23060, d2Adt23220, d2Adt23221, d2Adt23240, d2Adt23400, d2Adt23401, d2Adt23420, d2Adt23600, d2Adt24020, d2Adt24021, d2Adt24040, d2Adt24041, d2Adt24200, d2Adt24201, d2Adt24220, d2Adt24221, d2Adt24400, d2Adt24401, d2Adt25020, d2Adt25021, d2Adt25040, d2Adt25200, d2Adt25201, d2Adt25220, d2Adt25400, d2Adt26000, d2Adt26001, d2Adt26020, d2Adt26021, d2Adt26200, d2Adt26201, d2Adt27000, d2Adt27001, d2Adt27020, d2Adt27200, d2Adt28000, d2Adt28001, d2Adt29000;
-extern double alpha20, alpha02, beta, c;
-extern double dalphadt20, dalphadt02, dbetadt, dcdt;
-extern double d2alphadt220, d2alphadt202, d2betadt2, d2cdt2;
-extern double rt, urt, rtt, urtt, phit, phitt;
-extern double dC1_dt02, dC1_dt10, dC1_dt20;
-extern double d2C1_dt200, d2C1_dt202, d2C1_dt210, d2C1_dt220;
-
-/* Numerical coefficients appearing in the elliptic integrals expressions. The
-   indices here correspond to mode m, EllipticK/EllipticE, order in Sin[dphi]/Sin[dphi/2],
-   term in polynomial in alpha/beta. */
-static const double ReEI[21][2][5][27] =
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "kerr-equatorial.h"
+#include "effsource-kernels.h"
+#include "effsource-modes.h"
+#include "effsource-patches.h"
+#include "effsource-support.h"
+
+/* Numerical coefficients appearing in the elliptic integrals expressions. For
+   mode m, EllipticK/EllipticE i and order j in Sin[dphi]/Sin[dphi/2] the
+   coefficients of the polynomial in alpha/beta are stored contiguously starting
+   at ReEI[ReEIOffset[m][i][j]] (ImEI[ImEIOffset[m][i][j]]), from the term in
+   (alpha/beta)^max(j-i,0) (max(j-i-1,0)) up to (alpha/beta)^(m+2+j) (m+1+j).
+   All other terms vanish and are not stored. The coefficients for m > 20 are
+   generated at run time in the same layout, see effsource-modes.h. */
+static const double ReEI[2814] __attribute__ ((aligned (64))) =
  {
-  {{{0,-0.26666666666666666,-0.5333333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,0.2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.4,0.13333333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,1.2666666666666666,0.5333333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-4,-6.933333333333334,-3.2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,1.5333333333333334,1.5333333333333334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,0.4666666666666667,-0.2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,-0.4666666666666667,-0.13333333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-1.5333333333333334,-1.5333333333333334,-0.5333333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,6.866666666666666,8.533333333333333,3.2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,-0.4,-0.4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,-0.6,-0.26666666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-1.6,-2.4,-1.0666666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,9.266666666666667,14.4,6.4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.3333333333333335,-24.933333333333334,-38.4,-17.066666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,1.2666666666666666,0.6,0.4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,0.06666666666666667,0.7333333333333333,0.26666666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,2.6,2.933333333333333,1.0666666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-3.533333333333333,-15.266666666666667,-17.6,-6.4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.3333333333333333,10.2,40.93333333333333,46.93333333333333,17.066666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,0,1.6,1.0666666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,5,9.066666666666666,4.266666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-7.6,-42,-59.733333333333334,-25.6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,30.6,128,166.4,68.26666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.466666666666667,-73.6,-275.2,-341.3333333333333,-136.53333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,0.4666666666666667,-0.6,-2.1333333333333333,-1.0666666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-1.1333333333333333,-8.733333333333333,-11.2,-4.266666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,19.8,67.06666666666666,72.53333333333333,25.6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-4.2,-69.8,-198.4,-200.53333333333333,-68.26666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.06666666666666667,13.266666666666667,160,420.26666666666665,409.6,136.53333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,0.6666666666666666,-16.4,-34.13333333333333,-17.066666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,41,186.4,247.46666666666667,102.4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-17.6,-204,-630.4,-716.8,-273.06666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,65.8,536,1427.2,1501.8666666666666,546.1333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.4857142857142858,-153.0857142857143,-1073.3714285714286,-2640.457142857143,-2652.647619047619,-936.2285714285714,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-0.8666666666666667,2.7333333333333334,30.266666666666666,42.666666666666664,17.066666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-3.1333333333333333,-97.4,-290.93333333333334,-298.6666666666667,-102.4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,53.8,410.4,937.6,853.3333333333334,273.06666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-4.6,-177.4,-1019.2,-2075.733333333333,-1774.9333333333334,-546.1333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.02857142857142857,14.771428571428572,392.62857142857143,1984,3791.2380952380954,3120.7619047619046,936.2285714285714,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,1.6,-198.4,-814.9333333333333,-1024,-409.6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,147.4,1179.7333333333333,3012.266666666667,3072,1092.2666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-31.6,-629.2,-3345.0666666666666,-7116.8,-6553.6,-2184.5333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,114.94285714285714,1556.3428571428572,6981.4857142857145,13497.295238095237,11702.857142857143,3744.9142857142856,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.492063492063492,-263.84761904761905,-3017.295238095238,-12327.009523809524,-22469.485714285714,-18724.571428571428,-5825.422222222222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-2.7333333333333334,18.6,452.26666666666665,1250.1333333333334,1228.8,409.6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-5.933333333333334,-401.26666666666665,-2212.266666666667,-4343.466666666666,-3618.133333333333,-1092.2666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,106.2,1463.3333333333333,5879.466666666666,9984,7645.866666666667,2184.5333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-4.885714285714286,-344.0857142857143,-3410.5142857142855,-11886.933333333332,-18646.55238095238,-13575.314285714287,-3744.9142857142856,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.015873015873015872,15.806349206349207,753.3714285714286,6407.466666666666,20597.02857142857,30739.504761904762,21637.28253968254,5825.422222222222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,2.8,-970,-6314.666666666667,-14080,-13107.2,-4369.066666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,380.2,4689.866666666667,19157.333333333332,34508.8,28398.933333333334,8738.133333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-49.6,-1514.1714285714286,-12285.104761904762,-41442.74285714285,-66823.31428571428,-51180.49523809524,-14979.657142857142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,178.05396825396826,3632.0761904761903,24604.95238095238,74800.76190476191,112737.52380952382,82388.11428571428,23301.68888888889,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.494949494949495,-405.9919191919192,-6920.145454545454,-42364.121212121216,-120645.81818181818,-173769.69696969696,-122863.45050505051,-33893.36565656566,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-5.133333333333334,58.2,2479.3333333333335,11306.666666666666,19814.4,15291.733333333334,4369.066666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-9.533333333333333,-1129.9333333333334,-9986.933333333332,-31906.133333333335,-47069.86666666667,-32768,-8738.133333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,178.14285714285714,3892.609523809524,24463.390476190478,66662.4,89604.87619047619,58670.32380952381,14979.657142857142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-5.1079365079365076,-573.9968253968254,-8815.314285714287,-47328,-117906.28571428571,-149562.51428571428,-94038.95873015873,-23301.68888888889,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.010101010101010102,16.6,1251.761616161616,16279.660606060606,79786.66666666667,187671.27272727274,228846.41616161616,139810.13333333333,33893.36565656566,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,4.266666666666667,-3262.4,-30573.866666666665,-103765.33333333333,-163840,-122333.86666666667,-34952.53333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,811.4,14256.685714285713,84442.81904761905,231716.57142857142,322998.85714285716,222198.24761904762,59918.62857142857,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-71.6,-3111.35873015873,-35753.44761904762,-174188.49523809523,-426296.0761904762,-551126.5523809524,-359511.77142857143,-93206.75555555556,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,255.14487734487736,7331.7772005772,69909.00086580086,305560.71341991343,696355.4632034632,856110.1021645021,538057.1797979798,135573.46262626263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.4965034965034967,-579.5630147630147,-13824.999533799533,-118555.33053613054,-483592.47365967365,-1.0497981165501166e6,-1.2450923412587412e6,-761297.1362859363,-187717.1020979021,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-8.066666666666666,135.93333333333334,9026.133333333333,61310.933333333334,166024.53333333333,218453.33333333334,139810.13333333333,34952.53333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-13.933333333333334,-2571.1714285714284,-33332.038095238095,-157322.3619047619,-357171.2,-422863.2380952381,-252157.5619047619,-59918.62857142857,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,270.5174603174603,8617.873015873016,78308.57142857143,312652.8,643189.0285714286,713406.1714285715,406115.1492063492,93206.75555555556,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-5.28975468975469,-870.3079365079365,-19227.160750360752,-147887.70909090908,-536312.6857142857,-1.0362348051948051e6,-1.0997186678210679e6,-605843.911111111,-135573.46262626263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.006993006993006993,17.244910644910647,1895.0315462315461,35180.35244755245,245442.05874125875,836234.2041958042,1.5471995524475526e6,1.5905439527583527e6,855155.6873348873,187717.1020979021,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,6,-8800.4,-111859.80952380953,-531221.9428571429,-1.2414390857142857e6,-1.5322940952380951e6,-958698.0571428571,-239674.51428571428,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,1529,36268.93968253968,292742.09523809527,1.1256783238095238e6,2.3227830857142857e6,2.6401645714285714e6,1.557884342857143e6,372827.02222222224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-97.6,-5729.1255411255415,-88548.89927849927,-586570.2510822511,-2.0080116917748917e6,-3.8364944623376625e6,-4.1284842943722946e6,-2.3386422303030305e6,-542293.8505050505,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,346.2218004218004,13349.73026973027,170513.0474858475,1.0105419870795871e6,3.214343297236097e6,5.829024556243756e6,6.033182035742036e6,3.3163354703962705e6,750868.4083916084,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.4974358974358974,-784.5839937839938,-25005.26247086247,-286327.7053613054,-1.5797995114219114e6,-4.77710082983683e6,-8.342656417715617e6,-8.387304409013209e6,-4.50521045034965e6,-1.0011578778554779e6,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-11.533333333333333,269.4,25857.619047619046,244643.3523809524,941524.1142857143,1.8502997333333334e6,1.9667041523809524e6,1.0785353142857142e6,239674.51428571428,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-19.133333333333333,-5094.479365079365,-91148.63492063493,-595972.8761904762,-1.9178837333333334e6,-3.3857145904761907e6,-3.3492016761904764e6,-1.744297853968254e6,-372827.02222222224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,384.0510822510823,16824.368253968252,209062.3953823954,1.1501940363636364e6,3.3420239238095237e6,5.513081239826839e6,5.196125312554113e6,2.6097891555555556e6,542293.8505050505,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-5.443600843600843,-1235.5986901986903,-37219.1333999334,-389168.827972028,-1.9364873206793207e6,-5.267843912887113e6,-8.294196586702187e6,-7.550561944366745e6,-3.6917696745920745e6,-750868.4083916084,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.005128205128205128,17.78850038850039,2689.031546231546,67733.57202797203,639727.53006993,2.9806964363636365e6,7.743910966899767e6,1.1785440213830614e7,1.0452192532090131e7,5.005789389277389e6,1.0011578778554779e6,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,8,-20454.4,-338221.5111111111,-2.129646933333333e6,-6.821751466666667e6,-1.2233386666666666e7,-1.2443101866666667e7,-6.7108864e6,-1.491308088888889e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,2637,81197.69581529581,855236.9685425685,4.365921080519481e6,1.2354614081385281e7,2.0404108744588744e7,1.9569787234632034e7,1.0100222965656566e7,2.169175402020202e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-127.6,-9731.779553779554,-194743.272016872,-1.6810041968697968e6,-7.631895255677655e6,-1.9979235561238762e7,-3.121355504229104e7,-2.8716805848018646e7,-1.4349929582595183e7,-3.0034736335664336e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,451.2884670884671,22506.019314019315,371138.143989344,2.8608340821844824e6,1.2051529176956376e7,2.991034232967033e7,4.489893256254856e7,4.0046315114219114e7,1.9522578618181817e7,4.0046315114219114e6,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.4980392156862745,-1021.0684583390466,-41964.88205128205,-619011.4680926916,-4.434788679994515e6,-1.7736541547237076e7,-4.234410989606472e7,-6.1679177494547285e7,-5.3709175564952694e7,-2.5676754984999314e7,-5.182464308898944e6,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-15.533333333333333,479.4,63067.02222222222,792570.3111111111,4.1009152e6,1.1153681066666666e7,1.7336456533333335e7,1.55189248e7,7.456540444444444e6,1.491308088888889e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-25.133333333333333,-9153.99163059163,-216262.70476190475,-1.870872972005772e6,-8.079372412121212e6,-1.9716661638095237e7,-2.849857074978355e7,-2.421317832958153e7,-1.1184810666666666e7,-2.169175402020202e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,519.3591075591075,29973.258252858253,488692.7529359529,3.5444105846153847e6,1.3786808101764902e7,3.138413195977356e7,4.3162921822710626e7,3.5328619333022535e7,1.58516663993784e7,3.0034736335664336e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-5.576934176934177,-1672.0434454434455,-65967.23223443223,-901384.234965035,-5.895572075924076e6,-2.1422238766033966e7,-4.646431837318237e7,-6.163704083294483e7,-4.905673601491842e7,-2.1524894373892773e7,-4.0046315114219114e6,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.00392156862745098,18.25848530554413,3638.6809634809633,119650.73401892226,1.4725623786096256e6,8.997631810448375e6,3.1165726124667488e7,6.523953848801134e7,8.420522974629554e7,6.55758409995338e7,2.8267987139448788e7,5.182464308898944e6,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,10.266666666666667,-42656.4,-889373.995959596,-7.149019797979798e6,-2.9865748169696968e7,-7.235293556363636e7,-1.0554394065454546e8,-9.146124722424242e7,-4.3383508040404044e7,-8.676701608080808e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,4255.4,165053.57016317017,2.19670492991453e6,1.4330180624708625e7,5.29140260997669e7,1.1808499516270396e8,1.624359102955711e8,1.346948423011655e8,6.173806913442113e7,1.2013894534265734e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-161.6,-15539.587434787434,-390961.72201132204,-4.259990718614719e6,-2.4699115148318347e7,-8.432809336796537e7,-1.779399951088911e8,-2.3469069971592852e8,-1.8834282577156177e8,-8.409726173986015e7,-1.6018526045687646e7,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,570.3472906178788,35746.582191664544,739622.7686979687,7.187172049660143e6,3.862786977665472e7,1.249378262920452e8,2.5314112267361397e8,3.234930047362311e8,2.531309910877828e8,1.1071628296284108e8,2.0729857235595778e7,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.498452012383901,-1289.0251146857959,-66438.47422257825,-1.227617738434115e6,-1.107397992473244e7,-5.645272137256345e7,-1.7550347663965014e8,-3.4482027794523466e8,-4.29947715579034e8,-3.2974049077368206e8,-1.4183586529618162e8,-2.6185082823910456e7,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-20.066666666666666,789.9333333333333,136892.39191919193,2.2055480888888887e6,1.4743798173737373e7,5.277455204848485e7,1.1157285546666667e8,1.4395359728484848e8,1.115261196929293e8,4.7721858844444446e7,8.676701608080808e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-31.933333333333334,-15290.940326340326,-461269.8076146076,-5.10054407956488e6,-2.841850342937063e7,-9.11948410927739e7,-1.7918446766247088e8,-2.193337460960373e8,-1.6331127164320123e8,-6.7745016401554e7,-1.2013894534265734e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,676.9748695748696,49810.32203352203,1.0321920394272394e6,9.544164072727272e6,4.781388058341658e7,1.4294413774385613e8,2.6698699182559663e8,3.145956128422688e8,2.2738798300792542e8,9.210652476270397e7,1.6018526045687646e7,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-5.694581235757706,-2181.5221419103773,-109270.05492285492,-1.892202578033731e6,-1.5744906345607335e7,-7.356716086097433e7,-2.0929734465833253e8,-3.7668167367356825e8,-4.312426213404269e8,-3.046022843375291e8,-1.2108121158063897e8,-2.0729857235595778e7,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.0030959752321981426,18.672520393263426,4748.226915980476,197766.84242568578,3.0782871159107145e6,2.3888763615371626e7,1.062565981512135e8,2.914255876520172e8,5.098456950542433e8,5.706785877375826e8,3.9574872039228964e8,1.5492840670813686e8,2.6185082823910456e7,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,12.8,-81880,-2.1007407614607615e6,-2.095521238228438e7,-1.1023046737156177e8,-3.441285888596737e8,-6.709847600932401e8,-8.259552492307693e8,-6.240550771965812e8,-2.6430567975384617e8,-4.805557813706294e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,6520.2,311067.7942501943,5.102019779331779e6,4.133440304335664e7,1.922698987114219e8,5.530782550526806e8,1.0170620137920746e9,1.1980522605003884e9,8.746782659530692e8,3.6041683602797204e8,6.407410418275058e7,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-199.6,-23628.784478266833,-730166.5007724302,-9.797468315151514e6,-7.051502323959962e7,-3.0318843028131086e8,-8.24417740343672e8,-1.4532290842782943e9,-1.6563077409054527e9,-1.1777150141972852e9,-4.749021839427396e8,-8.291942894238311e7,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,703.3999221968262,54143.24552805296,1.3738612902969064e6,1.6423980970872264e7,1.0950013007528281e8,4.457761957446739e8,1.1633972193432798e9,1.9862208061391819e9,2.20653026587352e9,1.5363898975089884e9,6.088031756559181e8,1.0474033129564182e8,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.49874686716792,-1588.4598780648316,-100391.40281967774,-2.2721153274630425e6,-2.5192147588914696e7,-1.5919834323671788e8,-6.225945846062396e8,-1.5748847121862333e9,-2.622330288934644e9,-2.854181112514796e9,-1.9537500785578425e9,-7.631081280111047e8,-1.2967850541365178e8,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-25.133333333333333,1228.2,271881.5229215229,5.463605097125097e6,4.5788857465734266e7,2.0806943674778554e8,5.705886187710955e8,9.891261404195805e8,1.0929306833255634e9,7.47197496172805e8,2.883334688223776e8,4.805557813706294e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-39.53333333333333,-24135.788500388502,-905518.1986013986,-1.2458983344832946e7,-8.693429073752914e7,-3.539285428811189e8,-9.016469155505828e8,-1.4824022811648796e9,-1.5738201839888113e9,-1.0428727894327894e9,-3.9245388811934733e8,-6.407410418275058e7,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,857.3689565336624,78373.47438182733,2.0127715456099457e6,2.3112727872974087e7,1.448205784474976e8,5.48772786971836e8,1.3280004404618127e9,2.1005893010457883e9,2.16389478497818e9,1.3996187132419581e9,5.163618984139312e8,8.291942894238311e7,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-5.799844393652443,-2765.6909199503625,-171565.7852751995,-3.67408829080517e6,-3.790738907893345e7,-2.2126713741740116e8,-7.971567635483366e8,-1.8574286571222606e9,-2.852811286882909e9,-2.870394025251496e9,-1.8211526732190146e9,-6.61173341303739e8,-1.0474033129564182e8,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.002506265664160401,19.04256314720711,6021.407418450143,310071.7180627422,5.959559314048181e6,5.72743914936333e7,3.179286576710175e8,1.1032734622114787e9,2.4971591341437187e9,3.7476056187814e9,3.700130737674165e9,2.310989422798335e9,8.279473807179306e8,1.2967850541365178e8,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,15.6,-147184.4,-4.556378703962704e6,-5.516948408391608e7,-3.559327987468532e8,-1.3849838370013986e9,-3.448738599742657e9,-5.628697306405595e9,-5.996935688354312e9,-4.0186477217118883e9,-1.537778500386014e9,-2.5629641673100233e8,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,9583.4,551597.1562502857,1.092800063183875e7,1.0752849872261073e8,6.136858642814754e8,2.2008252360679007e9,5.169359078663266e9,8.074326015812789e9,8.312849426393528e9,5.419679834310819e9,2.0277569441364596e9,3.3167771576953244e8,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-241.6,-34531.581210533535,-1.2859442616457501e6,-2.0830391072875936e7,-1.8202685521436995e8,-9.600492874957876e8,-3.2540002685571485e9,-7.325356346213779e9,-1.1069155880596071e10,-1.1097453830148788e10,-7.079345431875746e9,-2.6010515605084386e9,-4.189613251825673e8,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,850.4475412444452,78893.74837670069,2.409665423174555e6,3.474925120193656e7,2.8114098072956973e8,1.403407938144174e9,4.564031654437904e9,9.948487456287066e9,1.4649250696397833e10,1.4378787962114319e10,9.011876808307611e9,3.2619131746357026e9,5.187140216546071e8,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.4989648033126293,-1919.3769533617697,-146019.8335099459,-3.9742071741968985e6,-5.311713496745179e7,-4.071180069944188e8,-1.951471853701304e9,-6.149049338477993e9,-1.3068470999123806e10,-1.8848566822377876e10,-1.8183385037681484e10,-1.1230798287201794e10,-4.014395471935655e9,-6.314779394056087e8,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-30.733333333333334,1824.6,503413.80792540795,1.23437348997669e7,1.2666985013706294e8,7.111014843972028e8,2.4453185536e9,5.440886345756643e9,8.003944371617716e9,7.74195386945641e9,4.739481393767832e9,1.6659267087515152e9,2.5629641673100233e8,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-47.93333333333333,-36410.112500571326,-1.6632604871154989e6,-2.7868508792540792e7,-2.3790098953758398e8,-1.1959445584594543e9,-3.819200511326039e9,-8.057472578080973e9,-1.1386686300517574e10,-1.0673579702376745e10,-6.371368734672261e9,-2.193595802021226e9,-3.3167771576953244e8,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,1060.962421067065,117999.39040993406,3.6796141928934497e6,5.137764483644158e7,3.934568326273124e8,1.8396699858694205e9,5.577640943291375e9,1.131629761773835e10,1.5511646734480068e10,1.4188707002727196e10,8.301315963658234e9,2.8105322230997224e9,4.189613251825673e8,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-5.895082488890538,-3426.029950579177,-257947.1453013447,-6.696260875827578e6,-8.390810906845228e7,-5.980646799483613e8,-2.656730813122411e9,-7.751269489416868e9,-1.5263016489000265e10,-2.042660824129106e10,-1.832174708555405e10,-1.0545574516565224e10,-3.521270185463006e9,-5.187140216546071e8,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.002070393374741201,19.377095129336347,7461.561160324547,465737.4659903026,1.0838682409513706e7,1.2638856718220124e8,8.560311134982536e8,3.660454950424734e9,1.0368589915334404e10,1.9940417844891014e10,2.6176608626888607e10,2.310528608711372e10,1.3119593909531069e10,4.330134441638459e9,6.314779394056087e8,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,18.666666666666668,-250822.4,-9.21840527146579e6,-1.3309575831290278e8,-1.0317491250125874e9,-4.880582542269025e9,-1.5029793383663677e10,-3.1108875678233482e10,-4.36671203627632e10,-4.102438746924404e10,-2.470622075987824e10,-8.623620610007843e9,-1.3267108630781298e9,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,13613,930252.8430925112,2.189775853092872e7,2.5704415869336855e8,1.7632092507090087e9,7.688769367066271e9,2.233765721776305e10,4.425202515598031e10,6.002764410921827e10,5.486875815318882e10,3.230882151159315e10,1.1067561673572819e10,1.6758453007302692e9,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-287.6,-48836.168107778016,-2.157297016025873e6,-4.150197552329858e7,-4.325356919968865e8,-2.7414740676285434e9,-1.129721454934732e10,-3.1453610225900883e10,-6.027595384543495e10,-7.961419543169162e10,-7.119894052826602e10,-4.116669092530494e10,-1.3885575348907944e10,-2.0748560866184285e9,0,0,0,0,0,0,0,0,0,0},{0,0,0,1,1011.4910195053149,111321.75903879551,4.0295488900919873e6,6.897135012978844e7,6.652503712536638e8,3.9895117085213494e9,1.5770553504337744e10,4.2506951460346924e10,7.936585512341737e10,1.0261545331623116e11,9.014849059168524e10,5.1342279166782936e10,1.7095009931051834e10,2.5259117576224346e9,0,0,0,0,0,0,0,0,0},{0,0,0,0,-3.4991304347826087,-2281.7794378338194,-205750.77203382071,-6.631606823604064e6,-1.0514449275916624e8,-9.603493437127837e8,-5.528469326922443e9,-2.116888539068655e10,-5.561882541965658e10,-1.0169630183320364e11,-1.2921016311537668e11,-1.1184445811395491e11,-6.289520276479862e10,-2.0712476412503963e10,-3.0310941091469216e9,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-36.86666666666667,2612.733333333333,880586.5429315782,2.58769066508707e7,3.190248779785548e8,2.165737490196956e9,9.103826722266722e9,2.516944859639786e10,4.714484837223376e10,6.028345544481031e10,5.188494812822027e10,2.876927277805501e10,9.286976041546907e9,1.3267108630781298e9,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-57.13333333333333,-52928.28618502241,-2.8930003372693355e6,-5.799649101182244e7,-5.943782676834052e8,-3.6117879045470395e9,-1.4095434050579176e10,-3.694310664816257e10,-6.646474288799973e10,-8.235087355324098e10,-6.910511159213396e10,-3.752838135449264e10,-1.1905484323937954e10,-1.6758453007302692e9,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,1288.1362155560298,171329.4262403575,6.378245421382333e6,1.0642760530321938e8,9.777255230809364e8,5.52282590456045e9,2.045420469861058e10,5.153708389209838e10,8.991146463998302e10,1.0868422825737668e11,8.937325837111873e10,4.772044308351795e10,1.4923003392217157e10,2.0748560866184285e9,0,0,0,0,0,0,0,0,0,0},{0,0,0,-5.982039010629669,-4163.8773617253355,-374174.74996878806,-1.1581383324811196e7,-1.7326355869602597e8,-1.4804164912081263e9,-7.940429316689499e9,-2.828693012341041e10,-6.914758135245525e10,-1.1774449383689468e11,-1.395287760054435e11,-1.1285112004028159e11,-5.941617567775465e10,-1.8357965809863052e10,-2.5259117576224346e9,0,0,0,0,0,0,0,0,0},{0,0,0,-0.0017391304347826088,19.68235392850819,9071.70504037235,675142.9984015393,1.87165462532353e7,2.6038147706447074e8,2.1128045296213334e9,1.0902989617985832e10,3.76931192037466e10,8.995871805969456e10,1.5020871457643378e11,1.7511705338495316e11,1.3969263524174225e11,7.268311082558556e10,2.2228023467077423e10,3.0310941091469216e9,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,22,-408912.4,-1.760144321133892e7,-2.9861306666560435e8,-2.735742086051796e9,-1.5429018250372686e10,-5.7365925635849785e10,-1.459396829211136e11,-2.5834540566109332e11,-3.181407036536493e11,-2.6734969563212573e11,-1.462262308496573e11,-4.692366842044753e10,-6.703381202921077e9,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,18793,1.5042532023658487e6,4.1496704494122185e7,5.725677207573206e8,4.642875405124088e9,2.4142609768578815e10,8.469481355425212e10,2.0624416519975134e11,3.5284625417378284e11,4.227746181988333e11,3.4738564819211395e11,1.8647020933259586e11,5.8893991997092316e10,8.299424346473714e9,0,0,0,0,0,0,0,0,0,0},{0,0,0,-337.6,-67186.71908304376,-3.473936806561178e6,-7.829175553408918e7,-9.589299292985568e8,-7.183900332775953e9,-3.529847566422289e10,-1.1866407812293896e11,-2.795105576516615e11,-4.6559435752690393e11,-5.4578034888958093e11,-4.4032629265684235e11,-2.3272130603976505e11,-7.25297518974442e10,-1.0103647030489738e10,0,0,0,0,0,0,0,0,0},{0,0,0,1,1186.5310195053148,152876.8874522256,6.472435445144703e6,1.2971987635205658e8,1.4699377328144228e9,1.0417012853749659e10,4.909095266192736e10,1.5974095702715295e11,3.6655776122906323e11,5.976373260031626e11,6.881257568365696e11,5.468004776147498e11,2.8525211689964355e11,8.790172916526073e10,1.2124376436587687e10,0,0,0,0,0,0,0,0},{0,0,0,0,-3.4992592592592593,-2675.669679379713,-282242.09231669543,-1.0633815228365488e7,-1.9732870645890525e8,-2.1167235434403558e9,-1.4395851669845222e10,-6.570092170701432e10,-2.08363647527213e11,-4.6815844108415533e11,-7.499685194097299e11,-8.507323675829946e11,-6.674090341577878e11,-3.4432387109323157e11,-1.0507792911709328e11,-1.4369631332252073e10,0,0,0,0,0,0,0}},{{0.5333333333333333,-43.53333333333333,3629.4,1.4694724226778382e6,5.0982079751051836e7,7.433658698673364e8,5.9978865667303295e9,3.02094865091216e10,1.0127974704935579e11,2.3405817896550006e11,3.7868392857216315e11,4.284339090756366e11,3.3229306521589435e11,1.6843118108433334e11,5.027535902190807e10,6.703381202921077e9,0,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-67.13333333333334,-74599.00473169761,-4.808057892384602e6,-1.1363745491663341e8,-1.3765659670421038e9,-9.93853334295837e9,-4.646297120807411e10,-1.476455595126865e11,-3.276911350438754e11,-5.136740259640373e11,-5.665757674791024e11,-4.3035620039143896e11,-2.143610632661782e11,-6.304370417032917e10,-8.299424346473714e9,0,0,0,0,0,0,0,0,0,0},{0,0,0.2,1539.2381660875133,241314.9715176823,1.0573575649746368e7,2.0780309906924197e8,2.255048448318664e9,1.5127647788083984e10,6.709248572068778e10,2.0490559066010007e11,4.4090160795530695e11,6.741577248596049e11,7.285603048003533e11,5.440348341050625e11,2.6709174817027032e11,7.758157541268906e10,1.0103647030489738e10,0,0,0,0,0,0,0,0,0},{0,0,0,-6.062039010629669,-4980.454188585528,-526689.1747977207,-1.9167077767400973e7,-3.374851933365408e8,-3.4042942107257743e9,-2.167534593874192e10,-9.243454922934729e10,-2.738046230308966e11,-5.748972516712766e11,-8.61570663231068e11,-9.156248791038105e11,-6.740816221370153e11,-3.269296609004137e11,-9.396391738355457e10,-1.2124376436587687e10,0,0,0,0,0,0,0,0},{0,0,0,-0.0014814814814814814,19.963062463129766,10854.591016749811,949896.1873083068,3.0939338982764497e7,5.0627985565643203e8,4.84757118825071e9,2.9683411242703876e10,1.2280305832607028e11,3.5504229585249896e11,7.308189481361008e11,1.0772753882648191e12,1.1289483918947014e12,8.212160109323472e11,3.941685297769809e11,1.1226274478321931e11,1.4369631332252073e10,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,25.6,-642174.4,-3.2001493960675444e7,-6.301171929947947e8,-6.730005930120287e9,-4.45489555789727e10,-1.9627249696235114e11,-5.995497443810022e11,-1.2980003517584287e12,-2.0066420365331858e12,-2.2010916432997065e12,-1.6733714338577625e12,-8.384014633082003e11,-2.4898273039421143e11,-3.3197697385894855e10,0,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,25323.4,2.3470004379713614e6,7.499139768356036e7,1.2012583049576294e9,1.1358261276733395e10,6.933205150119518e10,2.8824587254763275e11,8.428926177352782e11,1.7637070948449934e12,2.6530579083520938e12,2.8455838704309585e12,2.1231780276189883e12,1.0469973628525146e12,3.067178562827242e11,4.0414588121958954e10,0,0,0,0,0,0,0,0,0},{0,0,0,-391.6,-90283.39413633075,-5.402084146905385e6,-1.409712773254586e8,-2.0042036720084534e9,-1.7506077529181057e10,-1.009677881940971e11,-4.0223835666768646e11,-1.1377089895665e12,-2.317805564538369e12,-3.4109110612635464e12,-3.591988921734658e12,-2.6387589471896216e12,-1.2839931153068442e12,-3.718142107220224e11,-4.8497505746350746e10,0,0,0,0,0,0,0,0},{0,0,0,1,1375.5680565423518,205134.69458317457,1.00442903694642e7,2.3300366348778668e8,3.0639399202108026e9,2.531140817273939e10,1.3999475849889786e11,5.397786494220163e11,1.4872042574435613e12,2.9652929630267153e12,4.285977100720373e12,4.445188146394695e12,3.223045360499386e12,1.5505730309458252e12,4.4456046934154846e11,5.747852532900829e10,0,0,0,0,0,0,0},{0,0,0,0,-3.499361430395913,-3101.049500580224,-378382.55774830375,-1.6479398081656067e7,-3.538256790695258e8,-4.4032169385133705e9,-3.490151422566471e10,-1.869146820137703e11,-7.023015906202007e11,-1.8944051915725413e12,-3.7109112830375283e12,-5.283759154390902e12,-5.409848733761012e12,-3.8788481619419673e12,-1.8478757481648335e12,-5.2523480042024817e11,-6.7388615902975235e10,0,0,0,0,0,0}},{{0.5333333333333333,-50.733333333333334,4914.6,2.3567543213508883e6,9.531948442077139e7,1.6222566814226518e9,1.533629951143212e10,9.106927966780995e10,3.6324193033461017e11,1.0115537476095123e12,2.0078489418750176e12,2.859678973879202e12,2.902119927570143e12,2.0490001876928757e12,9.566682602454508e11,2.6558157908715884e11,3.3197697385894855e10,0,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-77.93333333333334,-102426.67594272287,-7.688375333570598e6,-2.1157272142042986e8,-2.9899660626777706e9,-2.5285472574644356e10,-1.39341099517905e11,-5.2671795525996155e11,-1.4085398898401514e12,-2.708603610196061e12,-3.76067732280449e12,-3.7374252386297983e12,-2.5929559786286685e12,-1.1927785557210093e12,-3.269251503437037e11,-4.0414588121958954e10,0,0,0,0,0,0,0,0,0},{0,0,0.2,1814.5882726615152,331222.3335493492,1.6875662577301286e7,3.858469039048684e8,4.882312146902555e9,3.834964651451061e10,2.0043215049773267e11,7.280122943454908e11,1.8871102433942173e12,3.5392202281469395e12,4.81403000415386e12,4.70284874154185e12,3.215586981496385e12,1.4608069383404146e12,3.9606296359519775e11,4.8497505746350746e10,0,0,0,0,0,0,0,0},{0,0,0,-6.136113084703743,-5876.883265298239,-722621.9636936528,-3.0552356959223974e7,-6.254641839081137e8,-7.35329135286915e9,-5.480054731379718e10,-2.753158133060997e11,-9.696738980136191e11,-2.4522191929156543e12,-4.506888343001096e12,-6.027500191226616e12,-5.804540636175082e12,-3.920365399720353e12,-1.7620760421174104e12,-4.732997320060526e11,-5.747852532900829e10,0,0,0,0,0,0,0},{0,0,0,-0.001277139208173691,20.222883663640623,12812.749057488787,1.302854067321981e6,4.927317433912787e7,9.370025785364087e8,1.045225177549322e10,7.488955072282285e10,3.6490079744731726e11,1.254099223039917e12,3.108551076865836e12,5.618437072552979e12,7.408490300586078e12,7.048384464155902e12,4.710622193686491e12,2.09785778289315e12,5.589291083717358e11,6.7388615902975235e10,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,29.466666666666665,-976730,-5.578954646189742e7,-1.2615869100582263e9,-1.5529302994019297e10,-1.1910193801450629e11,-6.125072742936332e11,-2.206143296031422e12,-5.709225768796877e12,-1.0749971748792695e13,-1.4747065224375662e13,-1.4582852118589701e13,-1.0122591368671906e13,-4.679251530995561e12,-1.2932668199026865e12,-1.6165835248783582e11,0,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,33420.2,3.550881250122197e6,1.3009442746062008e8,2.3938339984597726e9,2.6090461836376514e10,1.8454580335053577e11,8.956680843174019e11,3.088494496941551e12,7.725403893782204e12,1.415456345665883e13,1.898742633772399e13,1.842784153284401e13,1.2590136522466424e13,5.741108749446352e12,1.5680860191320073e12,1.9399002298540298e11,0,0,0,0,0,0,0,0},{0,0,0,-449.6,-118882.34141578716,-8.1507702655822905e6,-2.4382796059468478e8,-3.981492068669497e9,-4.008401440642937e10,-2.6788273341492886e11,-1.2457916692080254e12,-4.155022019169404e12,-1.011883380132408e13,-1.8137213625744375e13,-2.3887559953693965e13,-2.2825549173918258e13,-1.538763792071379e13,-6.935816898196855e12,-1.8752368888588955e12,-2.2991410131603317e11,0,0,0,0,0,0,0},{0,0,0,1,1578.6025393009725,269796.6997164444,1.5129675524776911e7,4.02205042950141e8,6.073244823885286e9,5.781867124578261e10,3.705046212385272e11,1.6674750698719607e12,5.417057116138862e12,1.2910569366340434e13,2.272747357675429e13,2.947861243273825e13,2.7800233539143176e13,1.8528636980494258e13,8.268499554905844e12,2.2158962523390093e12,2.6955446361190094e11,0,0,0,0,0,0},{0,0,0,0,-3.49944382647386,-3557.9203447280424,-497291.8376827858,-2.479476383769259e7,-6.098901382048699e8,-8.713451379196568e9,-7.957942158518886e10,-4.937089707091298e11,-2.1650359733823113e12,-6.885306538377396e12,-1.6120601827215521e13,-2.7953517732769695e13,-3.579038142482068e13,-3.3375171285503258e13,-2.2026160316691473e13,-9.744096556853e12,-2.5912009727853706e12,-3.1303099000091724e11,0,0,0,0,0}},{{0.5333333333333333,-58.46666666666667,6511.533333333334,3.65374292379483e6,1.7041039042477334e8,3.3474383786596866e9,3.6634576706844986e10,2.5307096312507574e11,1.1825685116914846e12,3.8959211372933706e12,9.271173514538479e12,1.6125338479467012e13,2.0514656081142355e13,1.8879270148820613e13,1.2234885075983668e13,5.295573999855435e12,1.3740959961466045e12,1.6165835248783582e11,0,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-89.53333333333333,-137512.7002443942,-1.189358210895399e7,-3.7701063823343146e8,-6.146753773932911e9,-6.016166039394057e10,-3.856178138857783e11,-1.7075189529981672e12,-5.401437822018391e12,-1.2451974168004955e13,-2.1111659790717637e13,-2.6300614293483598e13,-2.3782945860158555e13,-1.5184861333257229e13,-6.488778629702592e12,-1.665081030624709e12,-1.9399002298540298e11,0,0,0,0,0,0,0,0},{0,0,0.2,2114.4828315743325,444637.2286422091,2.6068237359630816e7,6.861001365773908e8,1.00114325811189e10,9.098481065241385e10,5.529740045299663e11,2.3523822512552803e12,7.2120144708876045e12,1.621315950309689e13,2.692705307551175e13,3.29716634138851e13,2.938224475952283e13,1.8525493900149555e13,7.830326448629547e12,1.990193939516912e12,2.2991410131603317e11,0,0,0,0,0,0,0},{0,0,0,-6.2050786019451225,-6854.203876665512,-969805.7488195399,-4.71490524203349e7,-1.110535871836198e9,-1.5050298809158161e10,-1.2973475579082533e11,-7.577552802741434e11,-3.1251463627856104e12,-9.3459380263197e12,-2.058641033023447e13,-3.3613123793561336e13,-4.056896085255746e13,-3.57073389951639e13,-2.2272676941597234e13,-9.325906219148117e12,-2.3506734841449595e12,-2.6955446361190094e11,0,0,0,0,0,0},{0,0,0,-0.0011123470522803114,20.46471615241416,14948.520395986918,1.7481414056108568e6,7.598676584469618e7,1.6618757729228277e9,2.1362875654996433e10,1.7699538829298035e11,1.0024052815552432e12,4.0333265266471006e12,1.182051050899169e13,2.5601839654882164e13,4.120957066054989e13,4.913190571704601e13,4.278719239553509e13,2.6441705068033305e13,1.0981003732620514e13,2.747716467785829e12,3.1303099000091724e11,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,33.6,-1.4449664e6,-9.378112396360818e7,-2.4134343369641385e9,-3.3903936051757397e10,-2.9801676779554596e11,-1.7669252650270583e12,-7.395409184951448e12,-2.247442917360153e13,-5.039491703618102e13,-8.391129263208694e13,-1.034420381542176e14,-9.311814740541167e13,-5.94700664214626e13,-2.5517770940204883e13,-6.595660781503701e12,-7.759600919416119e11,0,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,43315.4,5.230291427936181e6,2.1780053830000895e8,4.561721534340654e9,5.6748630670697624e10,4.600956128255938e11,2.574621229746886e12,1.0317263052979926e13,3.0307188769397027e13,6.613140421026188e13,1.0767812330799452e14,1.302827448528449e14,1.1543547237775336e14,7.272605132546514e13,3.083902504292948e13,7.888927601406388e12,9.196564052641327e11,0,0,0,0,0,0,0},{0,0,0,-511.6,-153795.69885244747,-1.1978643183124974e7,-4.072033459630186e8,-7.567600637131104e9,-8.695493057921883e10,-6.660723636188911e11,-3.571363466702473e12,-1.384223532826015e13,-3.9588090502665234e13,-8.450579365558694e13,-1.3509302529267044e14,-1.609267891315999e14,-1.4069221688269344e14,-8.761436750764872e13,-3.677597449159481e13,-9.323413211988104e12,-1.0782178544476038e12,0,0,0,0,0,0},{0,0,0,1,1795.6347973654888,348690.3862286264,2.2204228030820765e7,6.705854777632657e8,1.1522110280379248e10,1.2517973983561208e11,9.19332170318912e11,4.770007373158425e12,1.8007053868363406e13,5.039707192316374e13,1.056513773616503e14,1.663261076501606e14,1.955389474170697e14,1.6900738607205572e14,1.0419707990723603e14,4.335070020676101e13,1.0903912818365283e13,1.252123960003669e12,0,0,0,0,0},{0,0,0,0,-3.4995112414467253,-4046.283374356923,-642320.5204937553,-3.6354442541503884e7,-1.0156406403679376e9,-1.6508254693268639e10,-1.7202985544924103e11,-1.2230324761502656e12,-6.182633991853942e12,-2.2846441388588523e13,-6.281007640234248e13,-1.2969530267124028e14,-2.0154019556485406e14,-2.3427740497541834e14,-2.0049551613303962e14,-1.2253405597896867e14,-5.058454321247145e13,-1.2635069050946113e13,-1.4418397115193762e12,0,0,0,0}},{{0.5333333333333333,-66.73333333333333,8466.6,5.500782327216349e6,2.9307562486459124e8,6.580662628830447e9,8.25198689979895e10,6.557192881581038e11,3.544366348591472e12,1.3610364338969898e13,3.81402493752755e13,7.919889465707464e13,1.2257383139758511e14,1.4091199728388275e14,1.1864488533235611e14,7.106501175365262e13,2.8670108813717684e13,6.983640827474507e12,7.759600919416119e11,0,0,0,0,0,0,0,0},{0,0.13333333333333333,-101.93333333333334,-181056.65587236284,-1.787733779890622e7,-6.467215044849563e8,-1.2047942031497614e10,-1.3508357853771237e11,-9.958337708633071e11,-5.100215968856238e12,-1.8803864759217754e13,-5.1043402609364266e13,-1.0331528027101834e14,-1.565720156503844e14,-1.7685958939722884e14,-1.4670592314888475e14,-8.675260770965969e13,-3.461105326764565e13,-8.348755804038454e12,-9.196564052641327e11,0,0,0,0,0,0,0},{0,0,0.2,2439.19770489493,585468.939241731,3.91400351372385e7,1.1749495789312527e9,1.958269650268004e10,2.0382117002694974e11,1.4244548817255012e12,7.007773329261644e12,2.5037504149523434e13,6.627085088332564e13,1.3138571746780752e14,1.956929732604737e14,2.1782474594777912e14,1.7841953684261428e14,1.0435529770005283e14,4.123551524987994e13,9.862522139211904e12,1.0782178544476038e12,0,0,0,0,0,0},{0,0,0,-6.2695947309773805,-7913.383352642443,-1.2767836155293747e6,-7.073831350388925e7,-1.899554623143067e9,-2.939480935713848e10,-2.901204668878392e11,-1.9481763004141086e12,-9.290239953778574e12,-3.237296296631215e13,-8.39479743534346e13,-1.6360610601542472e14,-2.401716637111394e14,-2.6402193545879147e14,-2.1393204742321744e14,-1.2394533297842339e14,-4.856788337344296e13,-1.1529974798367117e13,-1.252123960003669e12,0,0,0,0,0},{0,0,0,-0.0009775171065493646,20.69089338637782,17264.0838134564,2.3011678842776404e6,1.1394226862290737e8,2.840139762731206e9,4.167633267110191e10,3.95266965553167e11,2.5731613895229917e12,1.1969456812409002e13,4.086863287421054e13,1.0419401598474152e14,2.0016347293020044e14,2.902331341320077e14,3.156571512430503e14,2.533843334077847e14,1.4559242461110694e14,5.6631732792034625e13,1.33559889067058e13,1.4418397115193762e12,0,0,0,0}}},
-  {{{0,-0.26666666666666666,38,-2.0864644e6,-1.5269386717706367e8,-4.4364839170700865e9,-7.052545524685811e10,-7.039261202593761e11,-4.761725707062858e12,-2.288315999285902e13,-8.050868479032589e13,-2.1126861740115747e14,-4.1760113688084575e14,-6.230137174218235e14,-6.97244682853531e14,-5.760027708229431e14,-3.406464803623676e14,-1.3638576338223748e14,-3.3107630589508773e13,-3.678625621056531e12,0,0,0,0,0,0,0},{0,0,-0.06666666666666667,55257,7.524884401159955e6,3.534212218718977e8,8.358422454073611e9,1.1767720205354315e11,1.0834651446175271e12,6.917863829651936e12,3.183148547582819e13,1.0825791495805245e14,2.7646060697452588e14,5.3439199490061275e14,7.825097493435275e14,8.619879647594399e14,7.024798614322576e14,4.105674340973219e14,1.6268776314620662e14,3.913296565848068e13,4.312871417790415e12,0,0,0,0,0,0},{0,0,0,-577.6,-195891.5954785697,-1.720127764558216e7,-6.593956434546355e8,-1.3836051116645775e10,-1.7991428787352527e11,-1.5649809531653018e12,-9.574263945472568e12,-4.260947812998459e13,-1.4108556267746003e14,-3.5246266137808444e14,-6.68904000078248e14,-9.643324596899239e14,-1.0481525855129518e15,-8.443224624053235e14,-4.884650317232749e14,-1.9181971314970422e14,-4.577208698235634e13,-5.008495840014676e12,0,0,0,0,0},{0,0,0,1,2026.6651003957916,443769.2062382361,3.1848062618839644e7,1.084383682742406e9,2.1033538298344963e10,2.5857382719851614e11,2.1562791411962607e12,1.2764669581045951e13,5.532758658800373e13,1.7926934003434116e14,4.398155867559162e14,8.21954813552544e14,1.1694384435544125e15,1.2565957550652905e15,1.0021077247917248e15,5.746217280770576e14,2.2387644402300447e14,5.304452412379179e13,5.767358846077505e12,0,0,0,0},{0,0,0,0,-3.4995670995670998,-4566.139539696959,-817050.1240826164,-5.210286556396761e7,-1.6407138496930685e9,-3.010064457529331e10,-3.548915820326058e11,-2.864643885149056e12,-1.6520807008205463e13,-7.0090278456826984e13,-2.2307320285268588e14,-5.3903548690406256e14,-9.943274230202304e14,-1.3987464189591615e15,-1.488142833281783e15,-1.1763925899836822e15,-6.693106216369468e14,-2.589498048063432e14,-6.0969222087105055e13,-6.591267252660006e12,0,0,0}},{{0.5333333333333333,-75.53333333333333,10829.4,8.072048354127319e6,4.87250210500034e8,1.2400772896941032e10,1.7659692941512448e11,1.5987019273419814e12,9.889499268944688e12,4.3725671416071375e13,1.4222478427288353e14,3.464460612721393e14,6.378941277981012e14,8.892327870204825e14,9.324932431776439e14,7.236581421029889e14,4.029765524699275e14,1.5224983637304378e14,3.494694340003704e13,3.678625621056531e12,0,0,0,0,0,0,0},{0,0.13333333333333333,-115.13333333333334,-234357.4023199112,-2.6202969245825373e7,-1.0729925112854352e9,-2.264892860478733e10,-2.8833628269220435e11,-2.421334407948635e12,-1.4190732511616314e13,-6.023738501346369e13,-1.897848476488173e14,-4.506023042846216e14,-8.123862868785152e14,-1.1127081259761939e15,-1.1495259687556288e15,-8.80694584160074e14,-4.849782163048779e14,-1.8144558258461128e14,-4.128940136737588e13,-4.312871417790415e12,0,0,0,0,0,0},{0,0,0.2,2788.9909571394373,757954.1832518226,5.731896737696369e7,1.9467522753006718e9,3.6752178916813446e10,4.342367668300395e11,3.456417626472393e12,1.945586960892444e13,8.002395364327356e13,2.45820394128803e14,5.716362792738416e14,1.0128387071687611e15,1.366953901980593e15,1.394401321620245e15,1.0566084586443459e15,5.762621684739365e14,2.1376666367087962e14,4.827633490236368e13,5.008495840014676e12,0,0,0,0,0},{0,0,0,-6.330200791583441,-9055.326402164885,-1.652817817493035e6,-1.0353224612455417e8,-3.1443424489415655e9,-5.5099878956043625e10,-6.172115086692606e11,-4.719665182766741e12,-2.5747979102863504e13,-1.0327781515594061e14,-3.107840698734769e14,-7.103751521762541e14,-1.240428258290523e15,-1.6532690684504498e15,-1.6682200228770388e15,-1.2521020933688375e15,-6.771547917071688e14,-2.4931732630126084e14,-5.592820354683055e13,-5.767358846077505e12,0,0,0,0},{0,0,0,-0.0008658008658008658,20.90332181816109,19761.47677528686,2.9786440888161287e6,1.6669440060546213e8,4.697988868588864e9,7.804846936458011e10,8.399601182809939e11,6.225772187860445e12,3.3126459614313613e13,1.3018123394897244e14,3.8510657020790756e14,8.676089997567239e14,1.4962826923778152e15,1.9729018315606848e15,1.9720423433634065e15,1.4678534354359658e15,7.87971726203723e14,2.8819855324002194e14,6.4264855713435055e13,6.591267252660006e12,0,0,0}}},
-  {{{0,-0.26666666666666666,42.666666666666664,-2.9489904e6,-2.4170614799515897e8,-7.873218384663625e9,-1.405806642582533e11,-1.580544280937379e12,-1.2090386727568768e13,-6.6042366119374336e13,-2.65868882310363e14,-8.051739775983438e14,-1.857133409027708e15,-3.2801533762918805e15,-4.4314102156757605e15,-4.540487334262183e15,-3.465694635513561e15,-1.9084456023722588e15,-7.161903536719025e14,-1.6388911387603578e14,-1.725148567116166e13,0,0,0,0,0,0},{0,0,-0.06666666666666667,69509,1.060304375629801e7,5.578470160261151e8,1.479270594762511e10,2.3394997790297177e11,2.4264918279035615e12,1.7521030242218191e13,9.164276368056673e13,3.5664655366664625e14,1.05113206044863e15,2.370956512005569e15,4.1103527541472025e15,5.465870295900822e15,5.524844013590857e15,4.167585692773008e15,2.2713467255841065e15,8.446251275105141e14,1.917140907650062e14,2.0033983360058703e13,0,0,0,0,0},{0,0,0,-647.6,-246094.15250627516,-2.4198988932992294e7,-1.038980191421611e9,-2.444203632713007e10,-3.570077983612116e11,-3.498184851505777e12,-2.4202280989027707e13,-1.2243539925589284e14,-4.638933812042697e14,-1.3374968892379465e15,-2.9619773218874905e15,-5.055557384458424e15,-6.63336672836086e15,-6.627413577564161e15,-4.948584988121854e15,-2.672802925395651e15,-9.85971732202283e14,-2.2219508817519653e14,-2.306943538431002e13,0,0,0,0},{0,0,0,1,2271.693671824363,557112.5844066336,4.4760097703188986e7,1.7065933499774168e9,3.710782171508295e10,5.123704928625934e11,4.812792440204033e12,3.2217907329529703e13,1.587313473404659e14,5.885027219728265e14,1.6662726075609255e15,3.6337254670711775e15,6.120647631772677e15,7.939169799895172e15,7.852589702803345e15,5.811463115882084e15,3.1140914617754305e15,1.1406361435129525e15,2.5541160604057522e14,2.6365069010640023e13,0,0,0},{0,0,0,0,-3.4996138996138995,-5117.489627447047,-1.0252931044630904e6,-7.317764631938808e7,-2.5799387735712266e9,-5.305164082877038e10,-7.024571823174719e11,-6.386343641756565e12,-4.1646702455182195e13,-2.0082495548407444e14,-7.313240134063729e14,-2.0393725447628995e15,-4.389582156680698e15,-7.310312322718411e15,-9.388355782488322e15,-9.204613694406318e15,-6.75889981067322e15,-3.596449851906305e15,-1.3090123157014138e15,-2.9144089798248025e14,-2.9927916174240027e13,0,0}},{{0.5333333333333333,-84.86666666666666,13652.733333333334,1.1580743990317933e7,7.862366731187782e8,2.251285321019336e10,3.6126970425140875e11,3.6950296972946763e12,2.591996982109244e13,1.3060390853963811e14,4.872588592243463e14,1.3728326184824732e15,2.955623641337104e15,4.887098724271143e15,6.197174104927707e15,5.97435514747484e15,4.3000613327664335e15,2.2374288971381245e15,7.949002570465775e14,1.725148567116166e14,1.725148567116166e13,0,0,0,0,0,0},{0,0.13333333333333333,-129.13333333333333,-298814.1125960173,-3.756041742575181e7,-1.7285393875937688e9,-4.103692427927973e10,-5.885977025139501e11,-5.58378211235412e12,-3.710691956026596e13,-1.7949438370340738e14,-6.486221072613646e14,-1.7811709048134368e15,-3.7547456752020125e15,-6.099911491230204e15,-7.620161622284745e15,-7.252241847091468e15,-5.161779213919494e15,-2.65959108326093e15,-9.367258010130061e14,-2.0173108244503553e14,-2.0033983360058703e13,0,0,0,0,0},{0,0,0.2,3164.105012550278,966660.7328705739,8.210917088666102e7,3.1326839561683073e9,6.649903112671311e10,8.850518794573038e11,7.957226405896327e12,5.07826266196542e13,2.3800231954847772e14,8.384811979980429e14,2.2550231205737835e15,4.671485049782065e15,7.477796091175499e15,9.223459380199674e15,8.681741711096794e15,6.119697195173343e15,3.1262899720312225e15,1.0927437571553231e15,2.3372980586735153e14,2.306943538431002e13,0,0,0,0},{0,0,0,-6.387343648726298,-10280.88273895997,-2.1078979265578426e6,-1.482407551004836e8,-5.055907877161912e9,-9.959690402930423e10,-1.2564964279090027e12,-1.0850994538243352e13,-6.710880700339022e13,-3.066885058028235e14,-1.0583451011894089e15,-2.7975704791687135e15,-5.711120851896802e15,-9.02764697095337e15,-1.10141153245736e16,-1.0268428227212878e16,-7.177155441784758e15,-3.6389915826190465e15,-1.2633984960937452e15,-2.6859414054589525e14,-2.6365069010640023e13,0,0,0},{0,0,0,-0.0007722007722007722,21.103579218418492,22442.61268540996,3.7985964582853154e6,2.3859794710035256e8,7.549734457672135e9,1.4096953641872162e11,1.7083678819651787e12,1.429842236994991e13,8.623782828471784e13,3.860843010721173e14,1.3096501921718585e15,3.4118527798952095e15,6.87871387556754e15,1.0756091873106256e16,1.2998921089798014e16,1.2017683521567574e16,8.337385441942756e15,4.199116583526632e15,1.4491212804099838e15,3.0640485606960025e14,2.9927916174240027e13,0,0}}},
-  {{{0,-0.26666666666666666,47.6,-4.0895524e6,-3.731306038384463e8,-1.3541340916361624e10,-2.698066970601489e11,-3.3929623532272686e12,-2.912501505968892e13,-1.792856932147624e14,-8.178001345526671e14,-2.825665552462115e15,-7.50119392296909e15,-1.5421119083184214e16,-2.46069867650868e16,-3.036845308130471e16,-2.8690118845028184e16,-2.035084821245431e16,-1.0484659979090722e16,-3.7026001121730715e15,-8.013593344023481e14,-8.013593344023481e13,0,0,0,0,0},{0,0,-0.06666666666666667,86351.4,1.4665579721461162e7,8.590687659123018e8,2.5382910206863052e10,4.4799089906092065e11,5.197549704634442e12,4.2116936060807555e13,2.4826316584141612e14,1.0947767893988114e15,3.681377038739813e15,9.557508586062312e15,1.928610504650084e16,3.02919821648759e16,3.68806750791929e16,3.4434258261705336e16,2.417434564050942e16,1.2341328990945152e16,4.323002238921354e15,9.288483194209035e14,9.227774153724008e13,0,0,0,0},{0,0,0,-721.6,-305383.484221278,-3.3425150558028962e7,-1.5976051302013426e9,-4.187439493752403e10,-6.825325957092296e11,-7.480870721296626e12,-5.808146779339898e13,-3.311329496999199e14,-1.421626589092943e15,-4.676542004989115e15,-1.1920141073940436e16,-2.3681684177511636e16,-3.670117139829947e16,-4.416718389230369e16,-4.0819063755733816e16,-2.8399638601169932e16,-1.4382537224523932e16,-5.001926254562189e15,-1.067785294930921e15,-1.054602760425601e14,0,0,0},{0,0,0,1,2530.72069885139,690925.9210848194,6.1773305205390684e7,2.6215136024899797e9,6.350186022610584e10,9.783737218417522e11,1.0279134468481693e13,7.721651964503972e13,4.287219179136568e14,1.8010359258476095e15,5.818025681991426e15,1.460298629964141e16,2.8630185446713732e16,4.3862993135598696e16,5.225649481076826e16,4.7866759281312376e16,3.3039905722220736e16,1.6614027170527334e16,5.741105116040728e15,1.218493729951201e15,1.1971166469696011e14,0,0},{0,0,0,0,-3.4996534996535,-5700.334296291716,-1.2710928628651593e6,-1.0093436202872059e8,-3.9601706432110143e9,-9.070909301290082e10,-1.3400853937505337e12,-1.3626158227398803e13,-9.970831360069828e13,-5.418127541007572e14,-2.2355599883931558e15,-7.112384380705038e15,-1.7619359196305414e16,-3.415306825634278e16,-5.180484759888663e16,-6.1176142561382664e16,-5.559884636602166e16,-3.810791930105565e16,-1.904137287813753e16,-6.54222329112722e15,-1.3812884388110782e15,-1.350593140170832e14,0}},{{0.5333333333333333,-94.73333333333333,16992.6,1.6284696076892616e7,1.2354648054405298e9,3.953909107382076e10,7.10090176204812e11,8.145748277303172e12,6.428556882265668e13,3.6590982390426875e14,1.5502704689894388e15,4.993707604738265e15,1.2398036774129854e16,2.3903947362329856e16,3.5861500931598584e16,4.170569864198567e16,3.720611350142881e16,2.496972481358118e16,1.2193217903736838e16,4.0882542918542015e15,8.414273011224655e14,8.013593344023481e13,0,0,0,0,0},{0,0.13333333333333333,-143.93333333333334,-375927.24292232457,-5.278450853716055e7,-2.7125229474487467e9,-7.195565577844536e10,-1.1548552468425483e12,-1.2286437334588822e13,-9.185201223250092e13,-5.0188188887196794e14,-2.0594686450678228e15,-6.465664297334423e15,-1.5717197545820644e16,-2.9773055055612476e16,-4.400198164051586e16,-5.051762663082156e16,-4.456554705592129e16,-2.961652536463062e16,-1.4337322088783526e16,-4.770124322093573e15,-9.749871901895235e14,-9.227774153724008e13,0,0,0,0},{0,0,0.2,3564.768442556024,1.2164908134451648e6,1.1533096610258973e8,4.911578657437878e9,1.1646951484526044e11,1.7342546082017852e12,1.7484020896956271e13,1.2551336178335739e14,6.644159134672428e14,2.6578960250785765e15,8.171790366631361e15,1.9520413309070224e16,3.643312168795762e16,5.316310532259258e16,6.036333626184364e16,5.273684513072426e16,3.4747435047530596e16,1.6693177509884468e16,5.516045100269669e15,1.120515432952201e15,1.054602760425601e14,0,0,0},{0,0,0,-6.441397702780352,-11590.853392628731,-2.6527484863642906e6,-2.081436499095543e8,-7.921865093783669e9,-1.742928669332534e11,-2.459659492823631e12,-2.3815795421580676e13,-1.6566332438371656e14,-8.550505095885778e14,-3.35024333679381e15,-1.0123366574848608e16,-2.382922456508392e16,-4.391688037572645e16,-6.338437811869518e16,-7.128043872024897e16,-6.174789017813265e16,-4.037820760670786e16,-1.9267335122747188e16,-6.327906043885648e15,-1.2783495622996812e15,-1.1971166469696011e14,0,0},{0,0,0,-0.000693000693000693,21.292986207825482,25309.29515631317,4.780381324186655e6,3.3492374593636465e8,1.1823731636670485e10,2.4653622561126352e11,3.3416154029679727e12,3.135410116283323e13,2.126729757114602e14,1.0752440457778672e15,4.1409771925451395e15,1.233117595422076e16,2.8664288229529544e16,5.225580879389953e16,7.470388245200797e16,8.330526615716496e16,7.162566653980231e16,4.652411455487196e16,2.2066154752113164e16,7.207543889154556e15,1.4488180958196198e15,1.350593140170832e14,0}}},
-  {{{0,-0.26666666666666666,52.8,-5575520,-5.632173785675783e8,-2.264573851170883e10,-5.005643706894967e11,-6.997344021760841e12,-6.694984221034684e13,-4.609967645533807e14,-2.3627840501606355e15,-9.225264284921132e15,-2.7870762591869724e16,-6.579211913432579e16,-1.219269835005012e17,-1.7736434748785085e17,-2.014372433713144e17,-1.7653028386935773e17,-1.1695051216654723e17,-5.660662707425071e16,-1.887747613881895e16,-3.8756651445640835e15,-3.691109661489603e14,0,0,0,0},{0,0,-0.06666666666666667,106080.2,1.9949649623509426e7,1.2939911180306041e9,4.2363534986906364e10,8.295293999689657e11,1.0698737964202242e13,9.66363247645834e13,6.372094391758614e14,3.1574388239306565e15,1.1998128373402768e16,3.545022868007551e16,8.214242163461622e16,1.498448307438975e17,2.1504119173799283e17,2.413696663998524e17,2.0935359957837e17,1.3743658725905952e17,6.598443928517343e16,2.1845367673730504e16,4.455696662798164e15,4.218411041702404e14,0,0,0},{0,0,0,-799.6,-374795.69873168645,-4.541501586740491e7,-2.4033232898026366e9,-6.979280795787791e10,-1.2620648339616711e12,-1.5377051478454482e13,-1.3307719247169702e14,-8.486965787241058e14,-4.0942474686362435e15,-1.521973082413072e16,-4.415040755395909e16,-1.0071975616913048e17,-1.8128971785509302e17,-2.5715892674943798e17,-2.8571552176641878e17,-2.4559351140219373e17,-1.5993872560572854e17,-7.623776610305851e16,-2.5076921618640444e16,-5.084895471889925e15,-4.7884665878784044e14,0,0},{0,0,0,1,2803.746339877031,847540.594948172,8.387088415905303e7,3.940171303117425e9,1.057365813099728e11,1.8072133228725144e12,2.1105818071761484e13,1.7671976487014494e14,1.0975457428896409e15,5.180820146125421e15,1.8912018709994548e16,5.402178465503179e16,1.2161716004687645e17,2.1639908949667334e17,3.038797903142797e17,3.3462662569227334e17,2.853611054467527e17,1.845190954017643e17,8.739229013859099e16,2.857951555540064e16,5.764577084638233e15,5.402372560683328e14,0},{0,0,0,0,-3.499687304565353,-6314.674103265669,-1.5587237516807944e6,-1.3697283658064875e8,-5.948433133232432e9,-1.5092828425611444e11,-2.4733417883407153e12,-2.7953736163984633e13,-2.2798507703929834e14,-1.3857335293027922e15,-6.424397479638844e15,-2.30959575834661e16,-6.511275177576189e16,-1.4492407203283318e17,-2.5530540726016147e17,-3.553604828117912e17,-3.882498975703751e17,-3.287640702824053e17,-2.1123805647598467e17,-9.947298157155096e16,-3.2360331425024412e16,-6.496023591260685e15,-6.06119848271788e14}},{{0.5333333333333333,-105.13333333333334,20908.2,2.2492357135156598e7,1.8958309719109235e9,6.741542072724315e10,1.3467332712719966e12,1.721588784468186e13,1.517969171625762e14,9.68623788198903e14,4.620809634242403e15,1.6852457171265348e16,4.7703107096260296e16,1.0578958618367114e17,1.8461804798071936e17,2.5344496869855994e17,2.7218267219337744e17,2.2596420895370938e17,1.4205763700894958e17,6.535328208213089e16,2.074610040494806e16,4.0602206276385635e15,3.691109661489603e14,0,0,0,0},{0,0.13333333333333333,-159.53333333333333,-467299.4470188559,-7.287456290234995e7,-4.157830371714083e9,-1.2252070190736252e11,-2.186990850552188e12,-2.5926110989630664e13,-2.1653318849256094e14,-1.326322841173958e15,-6.127978836743251e15,-2.1781741790169716e16,-6.036681088296472e16,-1.3152785185627565e17,-2.2611628841057744e17,-3.06435432704922e17,-3.2542265994529766e17,-2.6752084016889734e17,-1.667276585666764e17,-7.611122760127998e16,-2.3994120798097664e16,-4.666617214883284e15,-4.218411041702404e14,0,0,0},{0,0,0.2,3991.1974633728914,1.5126843075902709e6,1.591637552639756e8,7.523047958345665e9,1.981274589389424e11,3.28062880467928e12,3.684945335931074e13,2.9550727863338325e14,1.753482804920874e15,7.897512890513422e15,2.748953095986418e16,7.486280786775282e16,1.6070534554507542e17,2.7277027276789126e17,3.6558244328737126e17,3.8447574794727104e17,3.133601408355606e17,1.9380644168944502e17,8.786770088566074e16,2.7529585606062684e16,5.324318801283845e15,4.7884665878784044e14,0,0},{0,0,0,-6.4926797540624035,-12985.995991128793,-3.298836226795991e6,-2.871680700153716e8,-1.2127517294150885e10,-2.9628375638388446e11,-4.648967460183313e12,-5.014705791678989e13,-3.896342464153759e14,-2.254104416220173e15,-9.943117755509682e15,-3.401307144070906e16,-9.127203209515408e16,-1.934632666986177e17,-3.247778760884149e17,-4.311079790213169e17,-4.495396895431404e17,-3.636200897900059e17,-2.2336772996888845e17,-1.0065183695567805e17,-3.1360509612206944e16,-6.034695712672399e15,-5.402372560683328e14,0},{0,0,0,-0.0006253908692933083,21.472659314327856,28363.229946619325,5.944698143021086e6,4.619832444694353e8,1.809376056308954e10,4.1886637559539825e11,6.31178461726564e12,6.596977935869714e13,4.997768062476191e14,2.8319808910505985e15,1.2277848441468622e16,4.138797722399096e16,1.0967212084846331e17,2.299374395484744e17,3.823298988047106e17,5.032265327743345e17,5.208059242745585e17,4.1843448110868006e17,2.5548313610900355e17,1.1449196659647726e17,3.5494695749103796e16,6.799083515396579e15,6.06119848271788e14}}}
-};
+  0,-0.26666666666666666,-0.5333333333333333,0,-0.06666666666666667,0.2,0,0.4,0.13333333333333333,1,1.2666666666666666,0.5333333333333333,-4,-6.933333333333334,-3.2,0.5333333333333333,1.5333333333333334,1.5333333333333334,0,0.13333333333333333,0.4666666666666667,-0.2,0,0.2,-0.4666666666666667,-0.13333333333333333,0,-1.5333333333333334,-1.5333333333333334,-0.5333333333333333,1,6.866666666666666,8.533333333333333,3.2,
+  0,-0.26666666666666666,-0.4,-0.4,0,-0.06666666666666667,-0.6,-0.26666666666666666,0,-1.6,-2.4,-1.0666666666666667,1,9.266666666666667,14.4,6.4,-3.3333333333333335,-24.933333333333334,-38.4,-17.066666666666666,0.5333333333333333,1.2666666666666666,0.6,0.4,0,0.13333333333333333,0.06666666666666667,0.7333333333333333,0.26666666666666666,0,0.2,2.6,2.933333333333333,1.0666666666666667,0,-3.533333333333333,-15.266666666666667,-17.6,-6.4,-0.3333333333333333,10.2,40.93333333333333,46.93333333333333,17.066666666666666,
+  0,-0.26666666666666666,0,1.6,1.0666666666666667,0,-0.06666666666666667,5,9.066666666666666,4.266666666666667,0,-7.6,-42,-59.733333333333334,-25.6,1,30.6,128,166.4,68.26666666666667,-3.466666666666667,-73.6,-275.2,-341.3333333333333,-136.53333333333333,0.5333333333333333,0.4666666666666667,-0.6,-2.1333333333333333,-1.0666666666666667,0,0.13333333333333333,-1.1333333333333333,-8.733333333333333,-11.2,-4.266666666666667,0,0.2,19.8,67.06666666666666,72.53333333333333,25.6,0,-4.2,-69.8,-198.4,-200.53333333333333,-68.26666666666667,-0.06666666666666667,13.266666666666667,160,420.26666666666665,409.6,136.53333333333333,
+  0,-0.26666666666666666,0.6666666666666666,-16.4,-34.13333333333333,-17.066666666666666,0,-0.06666666666666667,41,186.4,247.46666666666667,102.4,0,-17.6,-204,-630.4,-716.8,-273.06666666666666,1,65.8,536,1427.2,1501.8666666666666,546.1333333333333,-3.4857142857142858,-153.0857142857143,-1073.3714285714286,-2640.457142857143,-2652.647619047619,-936.2285714285714,0.5333333333333333,-0.8666666666666667,2.7333333333333334,30.266666666666666,42.666666666666664,17.066666666666666,0,0.13333333333333333,-3.1333333333333333,-97.4,-290.93333333333334,-298.6666666666667,-102.4,0,0.2,53.8,410.4,937.6,853.3333333333334,273.06666666666666,0,-4.6,-177.4,-1019.2,-2075.733333333333,-1774.9333333333334,-546.1333333333333,-0.02857142857142857,14.771428571428572,392.62857142857143,1984,3791.2380952380954,3120.7619047619046,936.2285714285714,
+  0,-0.26666666666666666,1.6,-198.4,-814.9333333333333,-1024,-409.6,0,-0.06666666666666667,147.4,1179.7333333333333,3012.266666666667,3072,1092.2666666666667,0,-31.6,-629.2,-3345.0666666666666,-7116.8,-6553.6,-2184.5333333333333,1,114.94285714285714,1556.3428571428572,6981.4857142857145,13497.295238095237,11702.857142857143,3744.9142857142856,-3.492063492063492,-263.84761904761905,-3017.295238095238,-12327.009523809524,-22469.485714285714,-18724.571428571428,-5825.422222222222,0.5333333333333333,-2.7333333333333334,18.6,452.26666666666665,1250.1333333333334,1228.8,409.6,0,0.13333333333333333,-5.933333333333334,-401.26666666666665,-2212.266666666667,-4343.466666666666,-3618.133333333333,-1092.2666666666667,0,0.2,106.2,1463.3333333333333,5879.466666666666,9984,7645.866666666667,2184.5333333333333,0,-4.885714285714286,-344.0857142857143,-3410.5142857142855,-11886.933333333332,-18646.55238095238,-13575.314285714287,-3744.9142857142856,-0.015873015873015872,15.806349206349207,753.3714285714286,6407.466666666666,20597.02857142857,30739.504761904762,21637.28253968254,5825.422222222222,
+  0,-0.26666666666666666,2.8,-970,-6314.666666666667,-14080,-13107.2,-4369.066666666667,0,-0.06666666666666667,380.2,4689.866666666667,19157.333333333332,34508.8,28398.933333333334,8738.133333333333,0,-49.6,-1514.1714285714286,-12285.104761904762,-41442.74285714285,-66823.31428571428,-51180.49523809524,-14979.657142857142,1,178.05396825396826,3632.0761904761903,24604.95238095238,74800.76190476191,112737.52380952382,82388.11428571428,23301.68888888889,-3.494949494949495,-405.9919191919192,-6920.145454545454,-42364.121212121216,-120645.81818181818,-173769.69696969696,-122863.45050505051,-33893.36565656566,0.5333333333333333,-5.133333333333334,58.2,2479.3333333333335,11306.666666666666,19814.4,15291.733333333334,4369.066666666667,0,0.13333333333333333,-9.533333333333333,-1129.9333333333334,-9986.933333333332,-31906.133333333335,-47069.86666666667,-32768,-8738.133333333333,0,0.2,178.14285714285714,3892.609523809524,24463.390476190478,66662.4,89604.87619047619,58670.32380952381,14979.657142857142,0,-5.1079365079365076,-573.9968253968254,-8815.314285714287,-47328,-117906.28571428571,-149562.51428571428,-94038.95873015873,-23301.68888888889,-0.010101010101010102,16.6,1251.761616161616,16279.660606060606,79786.66666666667,187671.27272727274,228846.41616161616,139810.13333333333,33893.36565656566,
+  0,-0.26666666666666666,4.266666666666667,-3262.4,-30573.866666666665,-103765.33333333333,-163840,-122333.86666666667,-34952.53333333333,0,-0.06666666666666667,811.4,14256.685714285713,84442.81904761905,231716.57142857142,322998.85714285716,222198.24761904762,59918.62857142857,0,-71.6,-3111.35873015873,-35753.44761904762,-174188.49523809523,-426296.0761904762,-551126.5523809524,-359511.77142857143,-93206.75555555556,1,255.14487734487736,7331.7772005772,69909.00086580086,305560.71341991343,696355.4632034632,856110.1021645021,538057.1797979798,135573.46262626263,-3.4965034965034967,-579.5630147630147,-13824.999533799533,-118555.33053613054,-483592.47365967365,-1.0497981165501166e6,-1.2450923412587412e6,-761297.1362859363,-187717.1020979021,0.5333333333333333,-8.066666666666666,135.93333333333334,9026.133333333333,61310.933333333334,166024.53333333333,218453.33333333334,139810.13333333333,34952.53333333333,0,0.13333333333333333,-13.933333333333334,-2571.1714285714284,-33332.038095238095,-157322.3619047619,-357171.2,-422863.2380952381,-252157.5619047619,-59918.62857142857,0,0.2,270.5174603174603,8617.873015873016,78308.57142857143,312652.8,643189.0285714286,713406.1714285715,406115.1492063492,93206.75555555556,0,-5.28975468975469,-870.3079365079365,-19227.160750360752,-147887.70909090908,-536312.6857142857,-1.0362348051948051e6,-1.0997186678210679e6,-605843.911111111,-135573.46262626263,-0.006993006993006993,17.244910644910647,1895.0315462315461,35180.35244755245,245442.05874125875,836234.2041958042,1.5471995524475526e6,1.5905439527583527e6,855155.6873348873,187717.1020979021,
+  0,-0.26666666666666666,6,-8800.4,-111859.80952380953,-531221.9428571429,-1.2414390857142857e6,-1.5322940952380951e6,-958698.0571428571,-239674.51428571428,0,-0.06666666666666667,1529,36268.93968253968,292742.09523809527,1.1256783238095238e6,2.3227830857142857e6,2.6401645714285714e6,1.557884342857143e6,372827.02222222224,0,-97.6,-5729.1255411255415,-88548.89927849927,-586570.2510822511,-2.0080116917748917e6,-3.8364944623376625e6,-4.1284842943722946e6,-2.3386422303030305e6,-542293.8505050505,1,346.2218004218004,13349.73026973027,170513.0474858475,1.0105419870795871e6,3.214343297236097e6,5.829024556243756e6,6.033182035742036e6,3.3163354703962705e6,750868.4083916084,-3.4974358974358974,-784.5839937839938,-25005.26247086247,-286327.7053613054,-1.5797995114219114e6,-4.77710082983683e6,-8.342656417715617e6,-8.387304409013209e6,-4.50521045034965e6,-1.0011578778554779e6,0.5333333333333333,-11.533333333333333,269.4,25857.619047619046,244643.3523809524,941524.1142857143,1.8502997333333334e6,1.9667041523809524e6,1.0785353142857142e6,239674.51428571428,0,0.13333333333333333,-19.133333333333333,-5094.479365079365,-91148.63492063493,-595972.8761904762,-1.9178837333333334e6,-3.3857145904761907e6,-3.3492016761904764e6,-1.744297853968254e6,-372827.02222222224,0,0.2,384.0510822510823,16824.368253968252,209062.3953823954,1.1501940363636364e6,3.3420239238095237e6,5.513081239826839e6,5.196125312554113e6,2.6097891555555556e6,542293.8505050505,0,-5.443600843600843,-1235.5986901986903,-37219.1333999334,-389168.827972028,-1.9364873206793207e6,-5.267843912887113e6,-8.294196586702187e6,-7.550561944366745e6,-3.6917696745920745e6,-750868.4083916084,-0.005128205128205128,17.78850038850039,2689.031546231546,67733.57202797203,639727.53006993,2.9806964363636365e6,7.743910966899767e6,1.1785440213830614e7,1.0452192532090131e7,5.005789389277389e6,1.0011578778554779e6,
+  0,-0.26666666666666666,8,-20454.4,-338221.5111111111,-2.129646933333333e6,-6.821751466666667e6,-1.2233386666666666e7,-1.2443101866666667e7,-6.7108864e6,-1.491308088888889e6,0,-0.06666666666666667,2637,81197.69581529581,855236.9685425685,4.365921080519481e6,1.2354614081385281e7,2.0404108744588744e7,1.9569787234632034e7,1.0100222965656566e7,2.169175402020202e6,0,-127.6,-9731.779553779554,-194743.272016872,-1.6810041968697968e6,-7.631895255677655e6,-1.9979235561238762e7,-3.121355504229104e7,-2.8716805848018646e7,-1.4349929582595183e7,-3.0034736335664336e6,1,451.2884670884671,22506.019314019315,371138.143989344,2.8608340821844824e6,1.2051529176956376e7,2.991034232967033e7,4.489893256254856e7,4.0046315114219114e7,1.9522578618181817e7,4.0046315114219114e6,-3.4980392156862745,-1021.0684583390466,-41964.88205128205,-619011.4680926916,-4.434788679994515e6,-1.7736541547237076e7,-4.234410989606472e7,-6.1679177494547285e7,-5.3709175564952694e7,-2.5676754984999314e7,-5.182464308898944e6,0.5333333333333333,-15.533333333333333,479.4,63067.02222222222,792570.3111111111,4.1009152e6,1.1153681066666666e7,1.7336456533333335e7,1.55189248e7,7.456540444444444e6,1.491308088888889e6,0,0.13333333333333333,-25.133333333333333,-9153.99163059163,-216262.70476190475,-1.870872972005772e6,-8.079372412121212e6,-1.9716661638095237e7,-2.849857074978355e7,-2.421317832958153e7,-1.1184810666666666e7,-2.169175402020202e6,0,0.2,519.3591075591075,29973.258252858253,488692.7529359529,3.5444105846153847e6,1.3786808101764902e7,3.138413195977356e7,4.3162921822710626e7,3.5328619333022535e7,1.58516663993784e7,3.0034736335664336e6,0,-5.576934176934177,-1672.0434454434455,-65967.23223443223,-901384.234965035,-5.895572075924076e6,-2.1422238766033966e7,-4.646431837318237e7,-6.163704083294483e7,-4.905673601491842e7,-2.1524894373892773e7,-4.0046315114219114e6,-0.00392156862745098,18.25848530554413,3638.6809634809633,119650.73401892226,1.4725623786096256e6,8.997631810448375e6,3.1165726124667488e7,6.523953848801134e7,8.420522974629554e7,6.55758409995338e7,2.8267987139448788e7,5.182464308898944e6,
+  0,-0.26666666666666666,10.266666666666667,-42656.4,-889373.995959596,-7.149019797979798e6,-2.9865748169696968e7,-7.235293556363636e7,-1.0554394065454546e8,-9.146124722424242e7,-4.3383508040404044e7,-8.676701608080808e6,0,-0.06666666666666667,4255.4,165053.57016317017,2.19670492991453e6,1.4330180624708625e7,5.29140260997669e7,1.1808499516270396e8,1.624359102955711e8,1.346948423011655e8,6.173806913442113e7,1.2013894534265734e7,0,-161.6,-15539.587434787434,-390961.72201132204,-4.259990718614719e6,-2.4699115148318347e7,-8.432809336796537e7,-1.779399951088911e8,-2.3469069971592852e8,-1.8834282577156177e8,-8.409726173986015e7,-1.6018526045687646e7,1,570.3472906178788,35746.582191664544,739622.7686979687,7.187172049660143e6,3.862786977665472e7,1.249378262920452e8,2.5314112267361397e8,3.234930047362311e8,2.531309910877828e8,1.1071628296284108e8,2.0729857235595778e7,-3.498452012383901,-1289.0251146857959,-66438.47422257825,-1.227617738434115e6,-1.107397992473244e7,-5.645272137256345e7,-1.7550347663965014e8,-3.4482027794523466e8,-4.29947715579034e8,-3.2974049077368206e8,-1.4183586529618162e8,-2.6185082823910456e7,0.5333333333333333,-20.066666666666666,789.9333333333333,136892.39191919193,2.2055480888888887e6,1.4743798173737373e7,5.277455204848485e7,1.1157285546666667e8,1.4395359728484848e8,1.115261196929293e8,4.7721858844444446e7,8.676701608080808e6,0,0.13333333333333333,-31.933333333333334,-15290.940326340326,-461269.8076146076,-5.10054407956488e6,-2.841850342937063e7,-9.11948410927739e7,-1.7918446766247088e8,-2.193337460960373e8,-1.6331127164320123e8,-6.7745016401554e7,-1.2013894534265734e7,0,0.2,676.9748695748696,49810.32203352203,1.0321920394272394e6,9.544164072727272e6,4.781388058341658e7,1.4294413774385613e8,2.6698699182559663e8,3.145956128422688e8,2.2738798300792542e8,9.210652476270397e7,1.6018526045687646e7,0,-5.694581235757706,-2181.5221419103773,-109270.05492285492,-1.892202578033731e6,-1.5744906345607335e7,-7.356716086097433e7,-2.0929734465833253e8,-3.7668167367356825e8,-4.312426213404269e8,-3.046022843375291e8,-1.2108121158063897e8,-2.0729857235595778e7,-0.0030959752321981426,18.672520393263426,4748.226915980476,197766.84242568578,3.0782871159107145e6,2.3888763615371626e7,1.062565981512135e8,2.914255876520172e8,5.098456950542433e8,5.706785877375826e8,3.9574872039228964e8,1.5492840670813686e8,2.6185082823910456e7,
+  0,-0.26666666666666666,12.8,-81880,-2.1007407614607615e6,-2.095521238228438e7,-1.1023046737156177e8,-3.441285888596737e8,-6.709847600932401e8,-8.259552492307693e8,-6.240550771965812e8,-2.6430567975384617e8,-4.805557813706294e7,0,-0.06666666666666667,6520.2,311067.7942501943,5.102019779331779e6,4.133440304335664e7,1.922698987114219e8,5.530782550526806e8,1.0170620137920746e9,1.1980522605003884e9,8.746782659530692e8,3.6041683602797204e8,6.407410418275058e7,0,-199.6,-23628.784478266833,-730166.5007724302,-9.797468315151514e6,-7.051502323959962e7,-3.0318843028131086e8,-8.24417740343672e8,-1.4532290842782943e9,-1.6563077409054527e9,-1.1777150141972852e9,-4.749021839427396e8,-8.291942894238311e7,1,703.3999221968262,54143.24552805296,1.3738612902969064e6,1.6423980970872264e7,1.0950013007528281e8,4.457761957446739e8,1.1633972193432798e9,1.9862208061391819e9,2.20653026587352e9,1.5363898975089884e9,6.088031756559181e8,1.0474033129564182e8,-3.49874686716792,-1588.4598780648316,-100391.40281967774,-2.2721153274630425e6,-2.5192147588914696e7,-1.5919834323671788e8,-6.225945846062396e8,-1.5748847121862333e9,-2.622330288934644e9,-2.854181112514796e9,-1.9537500785578425e9,-7.631081280111047e8,-1.2967850541365178e8,0.5333333333333333,-25.133333333333333,1228.2,271881.5229215229,5.463605097125097e6,4.5788857465734266e7,2.0806943674778554e8,5.705886187710955e8,9.891261404195805e8,1.0929306833255634e9,7.47197496172805e8,2.883334688223776e8,4.805557813706294e7,0,0.13333333333333333,-39.53333333333333,-24135.788500388502,-905518.1986013986,-1.2458983344832946e7,-8.693429073752914e7,-3.539285428811189e8,-9.016469155505828e8,-1.4824022811648796e9,-1.5738201839888113e9,-1.0428727894327894e9,-3.9245388811934733e8,-6.407410418275058e7,0,0.2,857.3689565336624,78373.47438182733,2.0127715456099457e6,2.3112727872974087e7,1.448205784474976e8,5.48772786971836e8,1.3280004404618127e9,2.1005893010457883e9,2.16389478497818e9,1.3996187132419581e9,5.163618984139312e8,8.291942894238311e7,0,-5.799844393652443,-2765.6909199503625,-171565.7852751995,-3.67408829080517e6,-3.790738907893345e7,-2.2126713741740116e8,-7.971567635483366e8,-1.8574286571222606e9,-2.852811286882909e9,-2.870394025251496e9,-1.8211526732190146e9,-6.61173341303739e8,-1.0474033129564182e8,-0.002506265664160401,19.04256314720711,6021.407418450143,310071.7180627422,5.959559314048181e6,5.72743914936333e7,3.179286576710175e8,1.1032734622114787e9,2.4971591341437187e9,3.7476056187814e9,3.700130737674165e9,2.310989422798335e9,8.279473807179306e8,1.2967850541365178e8,
+  0,-0.26666666666666666,15.6,-147184.4,-4.556378703962704e6,-5.516948408391608e7,-3.559327987468532e8,-1.3849838370013986e9,-3.448738599742657e9,-5.628697306405595e9,-5.996935688354312e9,-4.0186477217118883e9,-1.537778500386014e9,-2.5629641673100233e8,0,-0.06666666666666667,9583.4,551597.1562502857,1.092800063183875e7,1.0752849872261073e8,6.136858642814754e8,2.2008252360679007e9,5.169359078663266e9,8.074326015812789e9,8.312849426393528e9,5.419679834310819e9,2.0277569441364596e9,3.3167771576953244e8,0,-241.6,-34531.581210533535,-1.2859442616457501e6,-2.0830391072875936e7,-1.8202685521436995e8,-9.600492874957876e8,-3.2540002685571485e9,-7.325356346213779e9,-1.1069155880596071e10,-1.1097453830148788e10,-7.079345431875746e9,-2.6010515605084386e9,-4.189613251825673e8,1,850.4475412444452,78893.74837670069,2.409665423174555e6,3.474925120193656e7,2.8114098072956973e8,1.403407938144174e9,4.564031654437904e9,9.948487456287066e9,1.4649250696397833e10,1.4378787962114319e10,9.011876808307611e9,3.2619131746357026e9,5.187140216546071e8,-3.4989648033126293,-1919.3769533617697,-146019.8335099459,-3.9742071741968985e6,-5.311713496745179e7,-4.071180069944188e8,-1.951471853701304e9,-6.149049338477993e9,-1.3068470999123806e10,-1.8848566822377876e10,-1.8183385037681484e10,-1.1230798287201794e10,-4.014395471935655e9,-6.314779394056087e8,0.5333333333333333,-30.733333333333334,1824.6,503413.80792540795,1.23437348997669e7,1.2666985013706294e8,7.111014843972028e8,2.4453185536e9,5.440886345756643e9,8.003944371617716e9,7.74195386945641e9,4.739481393767832e9,1.6659267087515152e9,2.5629641673100233e8,0,0.13333333333333333,-47.93333333333333,-36410.112500571326,-1.6632604871154989e6,-2.7868508792540792e7,-2.3790098953758398e8,-1.1959445584594543e9,-3.819200511326039e9,-8.057472578080973e9,-1.1386686300517574e10,-1.0673579702376745e10,-6.371368734672261e9,-2.193595802021226e9,-3.3167771576953244e8,0,0.2,1060.962421067065,117999.39040993406,3.6796141928934497e6,5.137764483644158e7,3.934568326273124e8,1.8396699858694205e9,5.577640943291375e9,1.131629761773835e10,1.5511646734480068e10,1.4188707002727196e10,8.301315963658234e9,2.8105322230997224e9,4.189613251825673e8,0,-5.895082488890538,-3426.029950579177,-257947.1453013447,-6.696260875827578e6,-8.390810906845228e7,-5.980646799483613e8,-2.656730813122411e9,-7.751269489416868e9,-1.5263016489000265e10,-2.042660824129106e10,-1.832174708555405e10,-1.0545574516565224e10,-3.521270185463006e9,-5.187140216546071e8,-0.002070393374741201,19.377095129336347,7461.561160324547,465737.4659903026,1.0838682409513706e7,1.2638856718220124e8,8.560311134982536e8,3.660454950424734e9,1.0368589915334404e10,1.9940417844891014e10,2.6176608626888607e10,2.310528608711372e10,1.3119593909531069e10,4.330134441638459e9,6.314779394056087e8,
+  0,-0.26666666666666666,18.666666666666668,-250822.4,-9.21840527146579e6,-1.3309575831290278e8,-1.0317491250125874e9,-4.880582542269025e9,-1.5029793383663677e10,-3.1108875678233482e10,-4.36671203627632e10,-4.102438746924404e10,-2.470622075987824e10,-8.623620610007843e9,-1.3267108630781298e9,0,-0.06666666666666667,13613,930252.8430925112,2.189775853092872e7,2.5704415869336855e8,1.7632092507090087e9,7.688769367066271e9,2.233765721776305e10,4.425202515598031e10,6.002764410921827e10,5.486875815318882e10,3.230882151159315e10,1.1067561673572819e10,1.6758453007302692e9,0,-287.6,-48836.168107778016,-2.157297016025873e6,-4.150197552329858e7,-4.325356919968865e8,-2.7414740676285434e9,-1.129721454934732e10,-3.1453610225900883e10,-6.027595384543495e10,-7.961419543169162e10,-7.119894052826602e10,-4.116669092530494e10,-1.3885575348907944e10,-2.0748560866184285e9,1,1011.4910195053149,111321.75903879551,4.0295488900919873e6,6.897135012978844e7,6.652503712536638e8,3.9895117085213494e9,1.5770553504337744e10,4.2506951460346924e10,7.936585512341737e10,1.0261545331623116e11,9.014849059168524e10,5.1342279166782936e10,1.7095009931051834e10,2.5259117576224346e9,-3.4991304347826087,-2281.7794378338194,-205750.77203382071,-6.631606823604064e6,-1.0514449275916624e8,-9.603493437127837e8,-5.528469326922443e9,-2.116888539068655e10,-5.561882541965658e10,-1.0169630183320364e11,-1.2921016311537668e11,-1.1184445811395491e11,-6.289520276479862e10,-2.0712476412503963e10,-3.0310941091469216e9,0.5333333333333333,-36.86666666666667,2612.733333333333,880586.5429315782,2.58769066508707e7,3.190248779785548e8,2.165737490196956e9,9.103826722266722e9,2.516944859639786e10,4.714484837223376e10,6.028345544481031e10,5.188494812822027e10,2.876927277805501e10,9.286976041546907e9,1.3267108630781298e9,0,0.13333333333333333,-57.13333333333333,-52928.28618502241,-2.8930003372693355e6,-5.799649101182244e7,-5.943782676834052e8,-3.6117879045470395e9,-1.4095434050579176e10,-3.694310664816257e10,-6.646474288799973e10,-8.235087355324098e10,-6.910511159213396e10,-3.752838135449264e10,-1.1905484323937954e10,-1.6758453007302692e9,0,0.2,1288.1362155560298,171329.4262403575,6.378245421382333e6,1.0642760530321938e8,9.777255230809364e8,5.52282590456045e9,2.045420469861058e10,5.153708389209838e10,8.991146463998302e10,1.0868422825737668e11,8.937325837111873e10,4.772044308351795e10,1.4923003392217157e10,2.0748560866184285e9,0,-5.982039010629669,-4163.8773617253355,-374174.74996878806,-1.1581383324811196e7,-1.7326355869602597e8,-1.4804164912081263e9,-7.940429316689499e9,-2.828693012341041e10,-6.914758135245525e10,-1.1774449383689468e11,-1.395287760054435e11,-1.1285112004028159e11,-5.941617567775465e10,-1.8357965809863052e10,-2.5259117576224346e9,-0.0017391304347826088,19.68235392850819,9071.70504037235,675142.9984015393,1.87165462532353e7,2.6038147706447074e8,2.1128045296213334e9,1.0902989617985832e10,3.76931192037466e10,8.995871805969456e10,1.5020871457643378e11,1.7511705338495316e11,1.3969263524174225e11,7.268311082558556e10,2.2228023467077423e10,3.0310941091469216e9,
+  0,-0.26666666666666666,22,-408912.4,-1.760144321133892e7,-2.9861306666560435e8,-2.735742086051796e9,-1.5429018250372686e10,-5.7365925635849785e10,-1.459396829211136e11,-2.5834540566109332e11,-3.181407036536493e11,-2.6734969563212573e11,-1.462262308496573e11,-4.692366842044753e10,-6.703381202921077e9,0,-0.06666666666666667,18793,1.5042532023658487e6,4.1496704494122185e7,5.725677207573206e8,4.642875405124088e9,2.4142609768578815e10,8.469481355425212e10,2.0624416519975134e11,3.5284625417378284e11,4.227746181988333e11,3.4738564819211395e11,1.8647020933259586e11,5.8893991997092316e10,8.299424346473714e9,0,-337.6,-67186.71908304376,-3.473936806561178e6,-7.829175553408918e7,-9.589299292985568e8,-7.183900332775953e9,-3.529847566422289e10,-1.1866407812293896e11,-2.795105576516615e11,-4.6559435752690393e11,-5.4578034888958093e11,-4.4032629265684235e11,-2.3272130603976505e11,-7.25297518974442e10,-1.0103647030489738e10,1,1186.5310195053148,152876.8874522256,6.472435445144703e6,1.2971987635205658e8,1.4699377328144228e9,1.0417012853749659e10,4.909095266192736e10,1.5974095702715295e11,3.6655776122906323e11,5.976373260031626e11,6.881257568365696e11,5.468004776147498e11,2.8525211689964355e11,8.790172916526073e10,1.2124376436587687e10,-3.4992592592592593,-2675.669679379713,-282242.09231669543,-1.0633815228365488e7,-1.9732870645890525e8,-2.1167235434403558e9,-1.4395851669845222e10,-6.570092170701432e10,-2.08363647527213e11,-4.6815844108415533e11,-7.499685194097299e11,-8.507323675829946e11,-6.674090341577878e11,-3.4432387109323157e11,-1.0507792911709328e11,-1.4369631332252073e10,0.5333333333333333,-43.53333333333333,3629.4,1.4694724226778382e6,5.0982079751051836e7,7.433658698673364e8,5.9978865667303295e9,3.02094865091216e10,1.0127974704935579e11,2.3405817896550006e11,3.7868392857216315e11,4.284339090756366e11,3.3229306521589435e11,1.6843118108433334e11,5.027535902190807e10,6.703381202921077e9,0,0.13333333333333333,-67.13333333333334,-74599.00473169761,-4.808057892384602e6,-1.1363745491663341e8,-1.3765659670421038e9,-9.93853334295837e9,-4.646297120807411e10,-1.476455595126865e11,-3.276911350438754e11,-5.136740259640373e11,-5.665757674791024e11,-4.3035620039143896e11,-2.143610632661782e11,-6.304370417032917e10,-8.299424346473714e9,0,0.2,1539.2381660875133,241314.9715176823,1.0573575649746368e7,2.0780309906924197e8,2.255048448318664e9,1.5127647788083984e10,6.709248572068778e10,2.0490559066010007e11,4.4090160795530695e11,6.741577248596049e11,7.285603048003533e11,5.440348341050625e11,2.6709174817027032e11,7.758157541268906e10,1.0103647030489738e10,0,-6.062039010629669,-4980.454188585528,-526689.1747977207,-1.9167077767400973e7,-3.374851933365408e8,-3.4042942107257743e9,-2.167534593874192e10,-9.243454922934729e10,-2.738046230308966e11,-5.748972516712766e11,-8.61570663231068e11,-9.156248791038105e11,-6.740816221370153e11,-3.269296609004137e11,-9.396391738355457e10,-1.2124376436587687e10,-0.0014814814814814814,19.963062463129766,10854.591016749811,949896.1873083068,3.0939338982764497e7,5.0627985565643203e8,4.84757118825071e9,2.9683411242703876e10,1.2280305832607028e11,3.5504229585249896e11,7.308189481361008e11,1.0772753882648191e12,1.1289483918947014e12,8.212160109323472e11,3.941685297769809e11,1.1226274478321931e11,1.4369631332252073e10,
+  0,-0.26666666666666666,25.6,-642174.4,-3.2001493960675444e7,-6.301171929947947e8,-6.730005930120287e9,-4.45489555789727e10,-1.9627249696235114e11,-5.995497443810022e11,-1.2980003517584287e12,-2.0066420365331858e12,-2.2010916432997065e12,-1.6733714338577625e12,-8.384014633082003e11,-2.4898273039421143e11,-3.3197697385894855e10,0,-0.06666666666666667,25323.4,2.3470004379713614e6,7.499139768356036e7,1.2012583049576294e9,1.1358261276733395e10,6.933205150119518e10,2.8824587254763275e11,8.428926177352782e11,1.7637070948449934e12,2.6530579083520938e12,2.8455838704309585e12,2.1231780276189883e12,1.0469973628525146e12,3.067178562827242e11,4.0414588121958954e10,0,-391.6,-90283.39413633075,-5.402084146905385e6,-1.409712773254586e8,-2.0042036720084534e9,-1.7506077529181057e10,-1.009677881940971e11,-4.0223835666768646e11,-1.1377089895665e12,-2.317805564538369e12,-3.4109110612635464e12,-3.591988921734658e12,-2.6387589471896216e12,-1.2839931153068442e12,-3.718142107220224e11,-4.8497505746350746e10,1,1375.5680565423518,205134.69458317457,1.00442903694642e7,2.3300366348778668e8,3.0639399202108026e9,2.531140817273939e10,1.3999475849889786e11,5.397786494220163e11,1.4872042574435613e12,2.9652929630267153e12,4.285977100720373e12,4.445188146394695e12,3.223045360499386e12,1.5505730309458252e12,4.4456046934154846e11,5.747852532900829e10,-3.499361430395913,-3101.049500580224,-378382.55774830375,-1.6479398081656067e7,-3.538256790695258e8,-4.4032169385133705e9,-3.490151422566471e10,-1.869146820137703e11,-7.023015906202007e11,-1.8944051915725413e12,-3.7109112830375283e12,-5.283759154390902e12,-5.409848733761012e12,-3.8788481619419673e12,-1.8478757481648335e12,-5.2523480042024817e11,-6.7388615902975235e10,0.5333333333333333,-50.733333333333334,4914.6,2.3567543213508883e6,9.531948442077139e7,1.6222566814226518e9,1.533629951143212e10,9.106927966780995e10,3.6324193033461017e11,1.0115537476095123e12,2.0078489418750176e12,2.859678973879202e12,2.902119927570143e12,2.0490001876928757e12,9.566682602454508e11,2.6558157908715884e11,3.3197697385894855e10,0,0.13333333333333333,-77.93333333333334,-102426.67594272287,-7.688375333570598e6,-2.1157272142042986e8,-2.9899660626777706e9,-2.5285472574644356e10,-1.39341099517905e11,-5.2671795525996155e11,-1.4085398898401514e12,-2.708603610196061e12,-3.76067732280449e12,-3.7374252386297983e12,-2.5929559786286685e12,-1.1927785557210093e12,-3.269251503437037e11,-4.0414588121958954e10,0,0.2,1814.5882726615152,331222.3335493492,1.6875662577301286e7,3.858469039048684e8,4.882312146902555e9,3.834964651451061e10,2.0043215049773267e11,7.280122943454908e11,1.8871102433942173e12,3.5392202281469395e12,4.81403000415386e12,4.70284874154185e12,3.215586981496385e12,1.4608069383404146e12,3.9606296359519775e11,4.8497505746350746e10,0,-6.136113084703743,-5876.883265298239,-722621.9636936528,-3.0552356959223974e7,-6.254641839081137e8,-7.35329135286915e9,-5.480054731379718e10,-2.753158133060997e11,-9.696738980136191e11,-2.4522191929156543e12,-4.506888343001096e12,-6.027500191226616e12,-5.804540636175082e12,-3.920365399720353e12,-1.7620760421174104e12,-4.732997320060526e11,-5.747852532900829e10,-0.001277139208173691,20.222883663640623,12812.749057488787,1.302854067321981e6,4.927317433912787e7,9.370025785364087e8,1.045225177549322e10,7.488955072282285e10,3.6490079744731726e11,1.254099223039917e12,3.108551076865836e12,5.618437072552979e12,7.408490300586078e12,7.048384464155902e12,4.710622193686491e12,2.09785778289315e12,5.589291083717358e11,6.7388615902975235e10,
+  0,-0.26666666666666666,29.466666666666665,-976730,-5.578954646189742e7,-1.2615869100582263e9,-1.5529302994019297e10,-1.1910193801450629e11,-6.125072742936332e11,-2.206143296031422e12,-5.709225768796877e12,-1.0749971748792695e13,-1.4747065224375662e13,-1.4582852118589701e13,-1.0122591368671906e13,-4.679251530995561e12,-1.2932668199026865e12,-1.6165835248783582e11,0,-0.06666666666666667,33420.2,3.550881250122197e6,1.3009442746062008e8,2.3938339984597726e9,2.6090461836376514e10,1.8454580335053577e11,8.956680843174019e11,3.088494496941551e12,7.725403893782204e12,1.415456345665883e13,1.898742633772399e13,1.842784153284401e13,1.2590136522466424e13,5.741108749446352e12,1.5680860191320073e12,1.9399002298540298e11,0,-449.6,-118882.34141578716,-8.1507702655822905e6,-2.4382796059468478e8,-3.981492068669497e9,-4.008401440642937e10,-2.6788273341492886e11,-1.2457916692080254e12,-4.155022019169404e12,-1.011883380132408e13,-1.8137213625744375e13,-2.3887559953693965e13,-2.2825549173918258e13,-1.538763792071379e13,-6.935816898196855e12,-1.8752368888588955e12,-2.2991410131603317e11,1,1578.6025393009725,269796.6997164444,1.5129675524776911e7,4.02205042950141e8,6.073244823885286e9,5.781867124578261e10,3.705046212385272e11,1.6674750698719607e12,5.417057116138862e12,1.2910569366340434e13,2.272747357675429e13,2.947861243273825e13,2.7800233539143176e13,1.8528636980494258e13,8.268499554905844e12,2.2158962523390093e12,2.6955446361190094e11,-3.49944382647386,-3557.9203447280424,-497291.8376827858,-2.479476383769259e7,-6.098901382048699e8,-8.713451379196568e9,-7.957942158518886e10,-4.937089707091298e11,-2.1650359733823113e12,-6.885306538377396e12,-1.6120601827215521e13,-2.7953517732769695e13,-3.579038142482068e13,-3.3375171285503258e13,-2.2026160316691473e13,-9.744096556853e12,-2.5912009727853706e12,-3.1303099000091724e11,0.5333333333333333,-58.46666666666667,6511.533333333334,3.65374292379483e6,1.7041039042477334e8,3.3474383786596866e9,3.6634576706844986e10,2.5307096312507574e11,1.1825685116914846e12,3.8959211372933706e12,9.271173514538479e12,1.6125338479467012e13,2.0514656081142355e13,1.8879270148820613e13,1.2234885075983668e13,5.295573999855435e12,1.3740959961466045e12,1.6165835248783582e11,0,0.13333333333333333,-89.53333333333333,-137512.7002443942,-1.189358210895399e7,-3.7701063823343146e8,-6.146753773932911e9,-6.016166039394057e10,-3.856178138857783e11,-1.7075189529981672e12,-5.401437822018391e12,-1.2451974168004955e13,-2.1111659790717637e13,-2.6300614293483598e13,-2.3782945860158555e13,-1.5184861333257229e13,-6.488778629702592e12,-1.665081030624709e12,-1.9399002298540298e11,0,0.2,2114.4828315743325,444637.2286422091,2.6068237359630816e7,6.861001365773908e8,1.00114325811189e10,9.098481065241385e10,5.529740045299663e11,2.3523822512552803e12,7.2120144708876045e12,1.621315950309689e13,2.692705307551175e13,3.29716634138851e13,2.938224475952283e13,1.8525493900149555e13,7.830326448629547e12,1.990193939516912e12,2.2991410131603317e11,0,-6.2050786019451225,-6854.203876665512,-969805.7488195399,-4.71490524203349e7,-1.110535871836198e9,-1.5050298809158161e10,-1.2973475579082533e11,-7.577552802741434e11,-3.1251463627856104e12,-9.3459380263197e12,-2.058641033023447e13,-3.3613123793561336e13,-4.056896085255746e13,-3.57073389951639e13,-2.2272676941597234e13,-9.325906219148117e12,-2.3506734841449595e12,-2.6955446361190094e11,-0.0011123470522803114,20.46471615241416,14948.520395986918,1.7481414056108568e6,7.598676584469618e7,1.6618757729228277e9,2.1362875654996433e10,1.7699538829298035e11,1.0024052815552432e12,4.0333265266471006e12,1.182051050899169e13,2.5601839654882164e13,4.120957066054989e13,4.913190571704601e13,4.278719239553509e13,2.6441705068033305e13,1.0981003732620514e13,2.747716467785829e12,3.1303099000091724e11,
+  0,-0.26666666666666666,33.6,-1.4449664e6,-9.378112396360818e7,-2.4134343369641385e9,-3.3903936051757397e10,-2.9801676779554596e11,-1.7669252650270583e12,-7.395409184951448e12,-2.247442917360153e13,-5.039491703618102e13,-8.391129263208694e13,-1.034420381542176e14,-9.311814740541167e13,-5.94700664214626e13,-2.5517770940204883e13,-6.595660781503701e12,-7.759600919416119e11,0,-0.06666666666666667,43315.4,5.230291427936181e6,2.1780053830000895e8,4.561721534340654e9,5.6748630670697624e10,4.600956128255938e11,2.574621229746886e12,1.0317263052979926e13,3.0307188769397027e13,6.613140421026188e13,1.0767812330799452e14,1.302827448528449e14,1.1543547237775336e14,7.272605132546514e13,3.083902504292948e13,7.888927601406388e12,9.196564052641327e11,0,-511.6,-153795.69885244747,-1.1978643183124974e7,-4.072033459630186e8,-7.567600637131104e9,-8.695493057921883e10,-6.660723636188911e11,-3.571363466702473e12,-1.384223532826015e13,-3.9588090502665234e13,-8.450579365558694e13,-1.3509302529267044e14,-1.609267891315999e14,-1.4069221688269344e14,-8.761436750764872e13,-3.677597449159481e13,-9.323413211988104e12,-1.0782178544476038e12,1,1795.6347973654888,348690.3862286264,2.2204228030820765e7,6.705854777632657e8,1.1522110280379248e10,1.2517973983561208e11,9.19332170318912e11,4.770007373158425e12,1.8007053868363406e13,5.039707192316374e13,1.056513773616503e14,1.663261076501606e14,1.955389474170697e14,1.6900738607205572e14,1.0419707990723603e14,4.335070020676101e13,1.0903912818365283e13,1.252123960003669e12,-3.4995112414467253,-4046.283374356923,-642320.5204937553,-3.6354442541503884e7,-1.0156406403679376e9,-1.6508254693268639e10,-1.7202985544924103e11,-1.2230324761502656e12,-6.182633991853942e12,-2.2846441388588523e13,-6.281007640234248e13,-1.2969530267124028e14,-2.0154019556485406e14,-2.3427740497541834e14,-2.0049551613303962e14,-1.2253405597896867e14,-5.058454321247145e13,-1.2635069050946113e13,-1.4418397115193762e12,0.5333333333333333,-66.73333333333333,8466.6,5.500782327216349e6,2.9307562486459124e8,6.580662628830447e9,8.25198689979895e10,6.557192881581038e11,3.544366348591472e12,1.3610364338969898e13,3.81402493752755e13,7.919889465707464e13,1.2257383139758511e14,1.4091199728388275e14,1.1864488533235611e14,7.106501175365262e13,2.8670108813717684e13,6.983640827474507e12,7.759600919416119e11,0,0.13333333333333333,-101.93333333333334,-181056.65587236284,-1.787733779890622e7,-6.467215044849563e8,-1.2047942031497614e10,-1.3508357853771237e11,-9.958337708633071e11,-5.100215968856238e12,-1.8803864759217754e13,-5.1043402609364266e13,-1.0331528027101834e14,-1.565720156503844e14,-1.7685958939722884e14,-1.4670592314888475e14,-8.675260770965969e13,-3.461105326764565e13,-8.348755804038454e12,-9.196564052641327e11,0,0.2,2439.19770489493,585468.939241731,3.91400351372385e7,1.1749495789312527e9,1.958269650268004e10,2.0382117002694974e11,1.4244548817255012e12,7.007773329261644e12,2.5037504149523434e13,6.627085088332564e13,1.3138571746780752e14,1.956929732604737e14,2.1782474594777912e14,1.7841953684261428e14,1.0435529770005283e14,4.123551524987994e13,9.862522139211904e12,1.0782178544476038e12,0,-6.2695947309773805,-7913.383352642443,-1.2767836155293747e6,-7.073831350388925e7,-1.899554623143067e9,-2.939480935713848e10,-2.901204668878392e11,-1.9481763004141086e12,-9.290239953778574e12,-3.237296296631215e13,-8.39479743534346e13,-1.6360610601542472e14,-2.401716637111394e14,-2.6402193545879147e14,-2.1393204742321744e14,-1.2394533297842339e14,-4.856788337344296e13,-1.1529974798367117e13,-1.252123960003669e12,-0.0009775171065493646,20.69089338637782,17264.0838134564,2.3011678842776404e6,1.1394226862290737e8,2.840139762731206e9,4.167633267110191e10,3.95266965553167e11,2.5731613895229917e12,1.1969456812409002e13,4.086863287421054e13,1.0419401598474152e14,2.0016347293020044e14,2.902331341320077e14,3.156571512430503e14,2.533843334077847e14,1.4559242461110694e14,5.6631732792034625e13,1.33559889067058e13,1.4418397115193762e12,
+  0,-0.26666666666666666,38,-2.0864644e6,-1.5269386717706367e8,-4.4364839170700865e9,-7.052545524685811e10,-7.039261202593761e11,-4.761725707062858e12,-2.288315999285902e13,-8.050868479032589e13,-2.1126861740115747e14,-4.1760113688084575e14,-6.230137174218235e14,-6.97244682853531e14,-5.760027708229431e14,-3.406464803623676e14,-1.3638576338223748e14,-3.3107630589508773e13,-3.678625621056531e12,0,-0.06666666666666667,55257,7.524884401159955e6,3.534212218718977e8,8.358422454073611e9,1.1767720205354315e11,1.0834651446175271e12,6.917863829651936e12,3.183148547582819e13,1.0825791495805245e14,2.7646060697452588e14,5.3439199490061275e14,7.825097493435275e14,8.619879647594399e14,7.024798614322576e14,4.105674340973219e14,1.6268776314620662e14,3.913296565848068e13,4.312871417790415e12,0,-577.6,-195891.5954785697,-1.720127764558216e7,-6.593956434546355e8,-1.3836051116645775e10,-1.7991428787352527e11,-1.5649809531653018e12,-9.574263945472568e12,-4.260947812998459e13,-1.4108556267746003e14,-3.5246266137808444e14,-6.68904000078248e14,-9.643324596899239e14,-1.0481525855129518e15,-8.443224624053235e14,-4.884650317232749e14,-1.9181971314970422e14,-4.577208698235634e13,-5.008495840014676e12,1,2026.6651003957916,443769.2062382361,3.1848062618839644e7,1.084383682742406e9,2.1033538298344963e10,2.5857382719851614e11,2.1562791411962607e12,1.2764669581045951e13,5.532758658800373e13,1.7926934003434116e14,4.398155867559162e14,8.21954813552544e14,1.1694384435544125e15,1.2565957550652905e15,1.0021077247917248e15,5.746217280770576e14,2.2387644402300447e14,5.304452412379179e13,5.767358846077505e12,-3.4995670995670998,-4566.139539696959,-817050.1240826164,-5.210286556396761e7,-1.6407138496930685e9,-3.010064457529331e10,-3.548915820326058e11,-2.864643885149056e12,-1.6520807008205463e13,-7.0090278456826984e13,-2.2307320285268588e14,-5.3903548690406256e14,-9.943274230202304e14,-1.3987464189591615e15,-1.488142833281783e15,-1.1763925899836822e15,-6.693106216369468e14,-2.589498048063432e14,-6.0969222087105055e13,-6.591267252660006e12,0.5333333333333333,-75.53333333333333,10829.4,8.072048354127319e6,4.87250210500034e8,1.2400772896941032e10,1.7659692941512448e11,1.5987019273419814e12,9.889499268944688e12,4.3725671416071375e13,1.4222478427288353e14,3.464460612721393e14,6.378941277981012e14,8.892327870204825e14,9.324932431776439e14,7.236581421029889e14,4.029765524699275e14,1.5224983637304378e14,3.494694340003704e13,3.678625621056531e12,0,0.13333333333333333,-115.13333333333334,-234357.4023199112,-2.6202969245825373e7,-1.0729925112854352e9,-2.264892860478733e10,-2.8833628269220435e11,-2.421334407948635e12,-1.4190732511616314e13,-6.023738501346369e13,-1.897848476488173e14,-4.506023042846216e14,-8.123862868785152e14,-1.1127081259761939e15,-1.1495259687556288e15,-8.80694584160074e14,-4.849782163048779e14,-1.8144558258461128e14,-4.128940136737588e13,-4.312871417790415e12,0,0.2,2788.9909571394373,757954.1832518226,5.731896737696369e7,1.9467522753006718e9,3.6752178916813446e10,4.342367668300395e11,3.456417626472393e12,1.945586960892444e13,8.002395364327356e13,2.45820394128803e14,5.716362792738416e14,1.0128387071687611e15,1.366953901980593e15,1.394401321620245e15,1.0566084586443459e15,5.762621684739365e14,2.1376666367087962e14,4.827633490236368e13,5.008495840014676e12,0,-6.330200791583441,-9055.326402164885,-1.652817817493035e6,-1.0353224612455417e8,-3.1443424489415655e9,-5.5099878956043625e10,-6.172115086692606e11,-4.719665182766741e12,-2.5747979102863504e13,-1.0327781515594061e14,-3.107840698734769e14,-7.103751521762541e14,-1.240428258290523e15,-1.6532690684504498e15,-1.6682200228770388e15,-1.2521020933688375e15,-6.771547917071688e14,-2.4931732630126084e14,-5.592820354683055e13,-5.767358846077505e12,-0.0008658008658008658,20.90332181816109,19761.47677528686,2.9786440888161287e6,1.6669440060546213e8,4.697988868588864e9,7.804846936458011e10,8.399601182809939e11,6.225772187860445e12,3.3126459614313613e13,1.3018123394897244e14,3.8510657020790756e14,8.676089997567239e14,1.4962826923778152e15,1.9729018315606848e15,1.9720423433634065e15,1.4678534354359658e15,7.87971726203723e14,2.8819855324002194e14,6.4264855713435055e13,6.591267252660006e12,
+  0,-0.26666666666666666,42.666666666666664,-2.9489904e6,-2.4170614799515897e8,-7.873218384663625e9,-1.405806642582533e11,-1.580544280937379e12,-1.2090386727568768e13,-6.6042366119374336e13,-2.65868882310363e14,-8.051739775983438e14,-1.857133409027708e15,-3.2801533762918805e15,-4.4314102156757605e15,-4.540487334262183e15,-3.465694635513561e15,-1.9084456023722588e15,-7.161903536719025e14,-1.6388911387603578e14,-1.725148567116166e13,0,-0.06666666666666667,69509,1.060304375629801e7,5.578470160261151e8,1.479270594762511e10,2.3394997790297177e11,2.4264918279035615e12,1.7521030242218191e13,9.164276368056673e13,3.5664655366664625e14,1.05113206044863e15,2.370956512005569e15,4.1103527541472025e15,5.465870295900822e15,5.524844013590857e15,4.167585692773008e15,2.2713467255841065e15,8.446251275105141e14,1.917140907650062e14,2.0033983360058703e13,0,-647.6,-246094.15250627516,-2.4198988932992294e7,-1.038980191421611e9,-2.444203632713007e10,-3.570077983612116e11,-3.498184851505777e12,-2.4202280989027707e13,-1.2243539925589284e14,-4.638933812042697e14,-1.3374968892379465e15,-2.9619773218874905e15,-5.055557384458424e15,-6.63336672836086e15,-6.627413577564161e15,-4.948584988121854e15,-2.672802925395651e15,-9.85971732202283e14,-2.2219508817519653e14,-2.306943538431002e13,1,2271.693671824363,557112.5844066336,4.4760097703188986e7,1.7065933499774168e9,3.710782171508295e10,5.123704928625934e11,4.812792440204033e12,3.2217907329529703e13,1.587313473404659e14,5.885027219728265e14,1.6662726075609255e15,3.6337254670711775e15,6.120647631772677e15,7.939169799895172e15,7.852589702803345e15,5.811463115882084e15,3.1140914617754305e15,1.1406361435129525e15,2.5541160604057522e14,2.6365069010640023e13,-3.4996138996138995,-5117.489627447047,-1.0252931044630904e6,-7.317764631938808e7,-2.5799387735712266e9,-5.305164082877038e10,-7.024571823174719e11,-6.386343641756565e12,-4.1646702455182195e13,-2.0082495548407444e14,-7.313240134063729e14,-2.0393725447628995e15,-4.389582156680698e15,-7.310312322718411e15,-9.388355782488322e15,-9.204613694406318e15,-6.75889981067322e15,-3.596449851906305e15,-1.3090123157014138e15,-2.9144089798248025e14,-2.9927916174240027e13,0.5333333333333333,-84.86666666666666,13652.733333333334,1.1580743990317933e7,7.862366731187782e8,2.251285321019336e10,3.6126970425140875e11,3.6950296972946763e12,2.591996982109244e13,1.3060390853963811e14,4.872588592243463e14,1.3728326184824732e15,2.955623641337104e15,4.887098724271143e15,6.197174104927707e15,5.97435514747484e15,4.3000613327664335e15,2.2374288971381245e15,7.949002570465775e14,1.725148567116166e14,1.725148567116166e13,0,0.13333333333333333,-129.13333333333333,-298814.1125960173,-3.756041742575181e7,-1.7285393875937688e9,-4.103692427927973e10,-5.885977025139501e11,-5.58378211235412e12,-3.710691956026596e13,-1.7949438370340738e14,-6.486221072613646e14,-1.7811709048134368e15,-3.7547456752020125e15,-6.099911491230204e15,-7.620161622284745e15,-7.252241847091468e15,-5.161779213919494e15,-2.65959108326093e15,-9.367258010130061e14,-2.0173108244503553e14,-2.0033983360058703e13,0,0.2,3164.105012550278,966660.7328705739,8.210917088666102e7,3.1326839561683073e9,6.649903112671311e10,8.850518794573038e11,7.957226405896327e12,5.07826266196542e13,2.3800231954847772e14,8.384811979980429e14,2.2550231205737835e15,4.671485049782065e15,7.477796091175499e15,9.223459380199674e15,8.681741711096794e15,6.119697195173343e15,3.1262899720312225e15,1.0927437571553231e15,2.3372980586735153e14,2.306943538431002e13,0,-6.387343648726298,-10280.88273895997,-2.1078979265578426e6,-1.482407551004836e8,-5.055907877161912e9,-9.959690402930423e10,-1.2564964279090027e12,-1.0850994538243352e13,-6.710880700339022e13,-3.066885058028235e14,-1.0583451011894089e15,-2.7975704791687135e15,-5.711120851896802e15,-9.02764697095337e15,-1.10141153245736e16,-1.0268428227212878e16,-7.177155441784758e15,-3.6389915826190465e15,-1.2633984960937452e15,-2.6859414054589525e14,-2.6365069010640023e13,-0.0007722007722007722,21.103579218418492,22442.61268540996,3.7985964582853154e6,2.3859794710035256e8,7.549734457672135e9,1.4096953641872162e11,1.7083678819651787e12,1.429842236994991e13,8.623782828471784e13,3.860843010721173e14,1.3096501921718585e15,3.4118527798952095e15,6.87871387556754e15,1.0756091873106256e16,1.2998921089798014e16,1.2017683521567574e16,8.337385441942756e15,4.199116583526632e15,1.4491212804099838e15,3.0640485606960025e14,2.9927916174240027e13,
+  0,-0.26666666666666666,47.6,-4.0895524e6,-3.731306038384463e8,-1.3541340916361624e10,-2.698066970601489e11,-3.3929623532272686e12,-2.912501505968892e13,-1.792856932147624e14,-8.178001345526671e14,-2.825665552462115e15,-7.50119392296909e15,-1.5421119083184214e16,-2.46069867650868e16,-3.036845308130471e16,-2.8690118845028184e16,-2.035084821245431e16,-1.0484659979090722e16,-3.7026001121730715e15,-8.013593344023481e14,-8.013593344023481e13,0,-0.06666666666666667,86351.4,1.4665579721461162e7,8.590687659123018e8,2.5382910206863052e10,4.4799089906092065e11,5.197549704634442e12,4.2116936060807555e13,2.4826316584141612e14,1.0947767893988114e15,3.681377038739813e15,9.557508586062312e15,1.928610504650084e16,3.02919821648759e16,3.68806750791929e16,3.4434258261705336e16,2.417434564050942e16,1.2341328990945152e16,4.323002238921354e15,9.288483194209035e14,9.227774153724008e13,0,-721.6,-305383.484221278,-3.3425150558028962e7,-1.5976051302013426e9,-4.187439493752403e10,-6.825325957092296e11,-7.480870721296626e12,-5.808146779339898e13,-3.311329496999199e14,-1.421626589092943e15,-4.676542004989115e15,-1.1920141073940436e16,-2.3681684177511636e16,-3.670117139829947e16,-4.416718389230369e16,-4.0819063755733816e16,-2.8399638601169932e16,-1.4382537224523932e16,-5.001926254562189e15,-1.067785294930921e15,-1.054602760425601e14,1,2530.72069885139,690925.9210848194,6.1773305205390684e7,2.6215136024899797e9,6.350186022610584e10,9.783737218417522e11,1.0279134468481693e13,7.721651964503972e13,4.287219179136568e14,1.8010359258476095e15,5.818025681991426e15,1.460298629964141e16,2.8630185446713732e16,4.3862993135598696e16,5.225649481076826e16,4.7866759281312376e16,3.3039905722220736e16,1.6614027170527334e16,5.741105116040728e15,1.218493729951201e15,1.1971166469696011e14,-3.4996534996535,-5700.334296291716,-1.2710928628651593e6,-1.0093436202872059e8,-3.9601706432110143e9,-9.070909301290082e10,-1.3400853937505337e12,-1.3626158227398803e13,-9.970831360069828e13,-5.418127541007572e14,-2.2355599883931558e15,-7.112384380705038e15,-1.7619359196305414e16,-3.415306825634278e16,-5.180484759888663e16,-6.1176142561382664e16,-5.559884636602166e16,-3.810791930105565e16,-1.904137287813753e16,-6.54222329112722e15,-1.3812884388110782e15,-1.350593140170832e14,0.5333333333333333,-94.73333333333333,16992.6,1.6284696076892616e7,1.2354648054405298e9,3.953909107382076e10,7.10090176204812e11,8.145748277303172e12,6.428556882265668e13,3.6590982390426875e14,1.5502704689894388e15,4.993707604738265e15,1.2398036774129854e16,2.3903947362329856e16,3.5861500931598584e16,4.170569864198567e16,3.720611350142881e16,2.496972481358118e16,1.2193217903736838e16,4.0882542918542015e15,8.414273011224655e14,8.013593344023481e13,0,0.13333333333333333,-143.93333333333334,-375927.24292232457,-5.278450853716055e7,-2.7125229474487467e9,-7.195565577844536e10,-1.1548552468425483e12,-1.2286437334588822e13,-9.185201223250092e13,-5.0188188887196794e14,-2.0594686450678228e15,-6.465664297334423e15,-1.5717197545820644e16,-2.9773055055612476e16,-4.400198164051586e16,-5.051762663082156e16,-4.456554705592129e16,-2.961652536463062e16,-1.4337322088783526e16,-4.770124322093573e15,-9.749871901895235e14,-9.227774153724008e13,0,0.2,3564.768442556024,1.2164908134451648e6,1.1533096610258973e8,4.911578657437878e9,1.1646951484526044e11,1.7342546082017852e12,1.7484020896956271e13,1.2551336178335739e14,6.644159134672428e14,2.6578960250785765e15,8.171790366631361e15,1.9520413309070224e16,3.643312168795762e16,5.316310532259258e16,6.036333626184364e16,5.273684513072426e16,3.4747435047530596e16,1.6693177509884468e16,5.516045100269669e15,1.120515432952201e15,1.054602760425601e14,0,-6.441397702780352,-11590.853392628731,-2.6527484863642906e6,-2.081436499095543e8,-7.921865093783669e9,-1.742928669332534e11,-2.459659492823631e12,-2.3815795421580676e13,-1.6566332438371656e14,-8.550505095885778e14,-3.35024333679381e15,-1.0123366574848608e16,-2.382922456508392e16,-4.391688037572645e16,-6.338437811869518e16,-7.128043872024897e16,-6.174789017813265e16,-4.037820760670786e16,-1.9267335122747188e16,-6.327906043885648e15,-1.2783495622996812e15,-1.1971166469696011e14,-0.000693000693000693,21.292986207825482,25309.29515631317,4.780381324186655e6,3.3492374593636465e8,1.1823731636670485e10,2.4653622561126352e11,3.3416154029679727e12,3.135410116283323e13,2.126729757114602e14,1.0752440457778672e15,4.1409771925451395e15,1.233117595422076e16,2.8664288229529544e16,5.225580879389953e16,7.470388245200797e16,8.330526615716496e16,7.162566653980231e16,4.652411455487196e16,2.2066154752113164e16,7.207543889154556e15,1.4488180958196198e15,1.350593140170832e14,
+  0,-0.26666666666666666,52.8,-5575520,-5.632173785675783e8,-2.264573851170883e10,-5.005643706894967e11,-6.997344021760841e12,-6.694984221034684e13,-4.609967645533807e14,-2.3627840501606355e15,-9.225264284921132e15,-2.7870762591869724e16,-6.579211913432579e16,-1.219269835005012e17,-1.7736434748785085e17,-2.014372433713144e17,-1.7653028386935773e17,-1.1695051216654723e17,-5.660662707425071e16,-1.887747613881895e16,-3.8756651445640835e15,-3.691109661489603e14,0,-0.06666666666666667,106080.2,1.9949649623509426e7,1.2939911180306041e9,4.2363534986906364e10,8.295293999689657e11,1.0698737964202242e13,9.66363247645834e13,6.372094391758614e14,3.1574388239306565e15,1.1998128373402768e16,3.545022868007551e16,8.214242163461622e16,1.498448307438975e17,2.1504119173799283e17,2.413696663998524e17,2.0935359957837e17,1.3743658725905952e17,6.598443928517343e16,2.1845367673730504e16,4.455696662798164e15,4.218411041702404e14,0,-799.6,-374795.69873168645,-4.541501586740491e7,-2.4033232898026366e9,-6.979280795787791e10,-1.2620648339616711e12,-1.5377051478454482e13,-1.3307719247169702e14,-8.486965787241058e14,-4.0942474686362435e15,-1.521973082413072e16,-4.415040755395909e16,-1.0071975616913048e17,-1.8128971785509302e17,-2.5715892674943798e17,-2.8571552176641878e17,-2.4559351140219373e17,-1.5993872560572854e17,-7.623776610305851e16,-2.5076921618640444e16,-5.084895471889925e15,-4.7884665878784044e14,1,2803.746339877031,847540.594948172,8.387088415905303e7,3.940171303117425e9,1.057365813099728e11,1.8072133228725144e12,2.1105818071761484e13,1.7671976487014494e14,1.0975457428896409e15,5.180820146125421e15,1.8912018709994548e16,5.402178465503179e16,1.2161716004687645e17,2.1639908949667334e17,3.038797903142797e17,3.3462662569227334e17,2.853611054467527e17,1.845190954017643e17,8.739229013859099e16,2.857951555540064e16,5.764577084638233e15,5.402372560683328e14,-3.499687304565353,-6314.674103265669,-1.5587237516807944e6,-1.3697283658064875e8,-5.948433133232432e9,-1.5092828425611444e11,-2.4733417883407153e12,-2.7953736163984633e13,-2.2798507703929834e14,-1.3857335293027922e15,-6.424397479638844e15,-2.30959575834661e16,-6.511275177576189e16,-1.4492407203283318e17,-2.5530540726016147e17,-3.553604828117912e17,-3.882498975703751e17,-3.287640702824053e17,-2.1123805647598467e17,-9.947298157155096e16,-3.2360331425024412e16,-6.496023591260685e15,-6.06119848271788e14,0.5333333333333333,-105.13333333333334,20908.2,2.2492357135156598e7,1.8958309719109235e9,6.741542072724315e10,1.3467332712719966e12,1.721588784468186e13,1.517969171625762e14,9.68623788198903e14,4.620809634242403e15,1.6852457171265348e16,4.7703107096260296e16,1.0578958618367114e17,1.8461804798071936e17,2.5344496869855994e17,2.7218267219337744e17,2.2596420895370938e17,1.4205763700894958e17,6.535328208213089e16,2.074610040494806e16,4.0602206276385635e15,3.691109661489603e14,0,0.13333333333333333,-159.53333333333333,-467299.4470188559,-7.287456290234995e7,-4.157830371714083e9,-1.2252070190736252e11,-2.186990850552188e12,-2.5926110989630664e13,-2.1653318849256094e14,-1.326322841173958e15,-6.127978836743251e15,-2.1781741790169716e16,-6.036681088296472e16,-1.3152785185627565e17,-2.2611628841057744e17,-3.06435432704922e17,-3.2542265994529766e17,-2.6752084016889734e17,-1.667276585666764e17,-7.611122760127998e16,-2.3994120798097664e16,-4.666617214883284e15,-4.218411041702404e14,0,0.2,3991.1974633728914,1.5126843075902709e6,1.591637552639756e8,7.523047958345665e9,1.981274589389424e11,3.28062880467928e12,3.684945335931074e13,2.9550727863338325e14,1.753482804920874e15,7.897512890513422e15,2.748953095986418e16,7.486280786775282e16,1.6070534554507542e17,2.7277027276789126e17,3.6558244328737126e17,3.8447574794727104e17,3.133601408355606e17,1.9380644168944502e17,8.786770088566074e16,2.7529585606062684e16,5.324318801283845e15,4.7884665878784044e14,0,-6.4926797540624035,-12985.995991128793,-3.298836226795991e6,-2.871680700153716e8,-1.2127517294150885e10,-2.9628375638388446e11,-4.648967460183313e12,-5.014705791678989e13,-3.896342464153759e14,-2.254104416220173e15,-9.943117755509682e15,-3.401307144070906e16,-9.127203209515408e16,-1.934632666986177e17,-3.247778760884149e17,-4.311079790213169e17,-4.495396895431404e17,-3.636200897900059e17,-2.2336772996888845e17,-1.0065183695567805e17,-3.1360509612206944e16,-6.034695712672399e15,-5.402372560683328e14,-0.0006253908692933083,21.472659314327856,28363.229946619325,5.944698143021086e6,4.619832444694353e8,1.809376056308954e10,4.1886637559539825e11,6.31178461726564e12,6.596977935869714e13,4.997768062476191e14,2.8319808910505985e15,1.2277848441468622e16,4.138797722399096e16,1.0967212084846331e17,2.299374395484744e17,3.823298988047106e17,5.032265327743345e17,5.208059242745585e17,4.1843448110868006e17,2.5548313610900355e17,1.1449196659647726e17,3.5494695749103796e16,6.799083515396579e15,6.06119848271788e14
+ };
+
+static const int ReEIOffset[21][2][5] =
+ {
+  {{0,3,6,9,12},{15,18,22,26,30}},
+  {{34,38,42,46,50},{54,58,63,68,73}},
+  {{78,83,88,93,98},{103,108,114,120,126}},
+  {{132,138,144,150,156},{162,168,175,182,189}},
+  {{196,203,210,217,224},{231,238,246,254,262}},
+  {{270,278,286,294,302},{310,318,327,336,345}},
+  {{354,363,372,381,390},{399,408,418,428,438}},
+  {{448,458,468,478,488},{498,508,519,530,541}},
+  {{552,563,574,585,596},{607,618,630,642,654}},
+  {{666,678,690,702,714},{726,738,751,764,777}},
+  {{790,803,816,829,842},{855,868,882,896,910}},
+  {{924,938,952,966,980},{994,1008,1023,1038,1053}},
+  {{1068,1083,1098,1113,1128},{1143,1158,1174,1190,1206}},
+  {{1222,1238,1254,1270,1286},{1302,1318,1335,1352,1369}},
+  {{1386,1403,1420,1437,1454},{1471,1488,1506,1524,1542}},
+  {{1560,1578,1596,1614,1632},{1650,1668,1687,1706,1725}},
+  {{1744,1763,1782,1801,1820},{1839,1858,1878,1898,1918}},
+  {{1938,1958,1978,1998,2018},{2038,2058,2079,2100,2121}},
+  {{2142,2163,2184,2205,2226},{2247,2268,2290,2312,2334}},
+  {{2356,2378,2400,2422,2444},{2466,2488,2511,2534,2557}},
+  {{2580,2603,2626,2649,2672},{2695,2718,2742,2766,2790}}
+ };
+
+static const double ImEI[2751] __attribute__ ((aligned (64))) =
+ {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,-0.03333333333333333,-0.06666666666666667,0,0,-0.3,-0.26666666666666666,0,0.5,2.1333333333333333,1.6,0,-1.8333333333333333,-6.133333333333334,-4.266666666666667,-0.03333333333333333,4.2,12.8,8.533333333333333,0.06666666666666667,0.06666666666666667,0.06666666666666667,0,0.1,0.43333333333333335,0.26666666666666666,0,0,-1.2666666666666666,-2.933333333333333,-1.6,0,0.16666666666666666,4.1,8.266666666666667,4.266666666666667,0.06666666666666667,-0.4666666666666667,-9,-17.066666666666666,-8.533333333333333,
+  0,-0.06666666666666667,1.0666666666666667,1.0666666666666667,0,0,-2.6,-9.066666666666666,-6.4,0,1,11.6,27.733333333333334,17.066666666666666,0,-3.533333333333333,-29.066666666666666,-59.733333333333334,-34.13333333333333,0.009523809523809525,8,56.68571428571428,107.27619047619048,58.51428571428571,0.13333333333333333,-0.26666666666666666,-1.6,-1.0666666666666667,0,0.2,5.933333333333334,12.266666666666667,6.4,0,0,-3.2,-22.266666666666666,-36.266666666666666,-17.066666666666666,0,0.06666666666666667,10.066666666666666,52.53333333333333,76.8,34.13333333333333,-0.01904761904761905,-0.26666666666666666,-21.714285714285715,-99.35238095238095,-136.53333333333333,-58.51428571428571,
+  0,-0.1,12.6,38.4,25.6,0,0,-8.9,-64.26666666666667,-123.73333333333333,-68.26666666666667,0,1.5,35.2,170.13333333333333,273.06666666666666,136.53333333333333,0,-5.271428571428571,-84,-341.9428571428571,-497.37142857142857,-234.05714285714285,0.0015873015873015873,11.88888888888889,159.4920634920635,589.6126984126984,806.1968253968254,364.0888888888889,0.2,-1.4,-27,-51.2,-25.6,0,0.3,24.233333333333334,113.33333333333333,157.86666666666667,68.26666666666667,0,0,-5.4,-81.86666666666666,-281.06666666666666,-341.3333333333333,-136.53333333333333,0,0.04285714285714286,17.1,183.65714285714284,546.7428571428571,614.4,234.05714285714285,-0.0031746031746031746,-0.15555555555555556,-36.93015873015873,-337.26984126984127,-924.4444444444445,-988.2412698412699,-364.0888888888889,
+  0,-0.13333333333333333,59.733333333333334,332.8,546.1333333333333,273.06666666666666,0,0,-21.2,-260.26666666666665,-921.6,-1228.8,-546.1333333333333,0,2,79.88571428571429,648.5333333333333,1896.8380952380953,2262.552380952381,936.2285714285714,0,-7.015873015873016,-186.48888888888888,-1262.120634920635,-3319.0603174603175,-3692.9015873015874,-1456.3555555555556,0.0005772005772005772,15.806060606060607,349.617316017316,2133.1116883116883,5241.461471861472,5560.630303030303,2118.3353535353535,0.26666666666666666,-3.7333333333333334,-149.33333333333334,-554.6666666666666,-682.6666666666666,-273.06666666666666,0,0.4,64.13333333333334,541.8666666666667,1433.6,1501.8666666666666,546.1333333333333,0,0,-7.771428571428571,-209.86666666666667,-1260.4952380952382,-2852.5714285714284,-2730.6666666666665,-936.2285714285714,0,0.031746031746031744,24.755555555555556,462.5015873015873,2365.765079365079,4892.444444444444,4421.079365079365,1456.3555555555556,-0.0011544011544011544,-0.11313131313131314,-53.58268398268398,-839.8961038961039,-3909.818181818182,-7624.588744588745,-6619.79797979798,-2118.3353535353535,
+  0,-0.16666666666666666,191.66666666666666,1668.2666666666667,4753.066666666667,5461.333333333333,2184.5333333333333,0,0,-41.5,-775.8095238095239,-4313.6,-9976.685714285713,-10142.47619047619,-3744.9142857142856,0,2.5,152.63492063492063,1872.888888888889,8569.092063492064,17664.812698412698,16644.06349206349,5825.422222222222,0,-8.762626262626263,-352.2020202020202,-3580.7676767676767,-14673.19595959596,-28117.59191919192,-25155.23232323232,-8473.341414141414,0.0002775002775002775,19.731934731934732,655.7495837495837,5983.52047952048,22836.666267066266,41605.430303030305,35848.75213675214,11732.318881118881,0.3333333333333333,-7.666666666666667,-528.2,-3225.6,-7074.133333333333,-6553.6,-2184.5333333333333,0,0.5,135.11904761904762,1809.8666666666666,7751.314285714286,14345.752380952381,12014.933333333332,3744.9142857142856,0,0,-10.26984126984127,-436.8888888888889,-4089.930158730159,-14826.869841269841,-24894.577777777777,-19556.774603174603,-5825.422222222222,0,0.025252525252525252,32.86363636363637,955.6767676767677,7544.371717171717,24809.761616161617,39106.45656565657,29391.90303030303,8473.341414141414,-0.000555000555000555,-0.08935508935508936,-71.26440226440226,-1727.040959040959,-12325.773426573427,-38017.645288045285,-57329.99658119658,-41714.91157731158,-11732.318881118881,
+  0,-0.2,489.6,6106.971428571429,26214.4,50556.34285714286,44938.97142857143,14979.657142857142,0,0,-71.8,-1901.8920634920635,-15197.155555555555,-53000.93968253968,-90398.06984126984,-74066.08253968254,-23301.68888888889,0,3,260.43463203463205,4506.052525252525,29564.416738816737,91759.85685425685,144822.26608946608,112271.77373737373,33893.36565656566,0,-10.51048951048951,-596.8428904428904,-8522.413053613054,-49961.41351981352,-143888.94731934732,-215275.8303030303,-160341.69137529138,-46929.275524475524,0.0001554001554001554,23.661849261849262,1106.6579642579643,14141.066045066045,77056.03978243978,210652.15602175603,303084.9044289044,219003.28578088578,62572.367365967366,0.4,-13.6,-1447.5428571428572,-13136,-44470.857142857145,-70217.14285714286,-52428.8,-14979.657142857142,0,0.6,247.18412698412698,4825.422222222222,30428.749206349206,86497.11746031746,123062.04444444444,85716.92698412699,23301.68888888889,0,0,-12.86926406926407,-795.3656565656565,-10742.07215007215,-56978.655122655124,-146297.53535353535,-194603.1468975469,-129218.45656565657,-33893.36565656566,0,0.02097902097902098,41.329137529137526,1733.909557109557,19631.14219114219,94030.1724941725,225862.41491841493,286647.4368298368,183806.32913752913,46929.275524475524,-0.0003108003108003108,-0.07397047397047397,-89.75540015540015,-3126.114063714064,-31870.1898989899,-142693.88282828283,-326997.6515928516,-400854.2284382284,-250289.46946386946,-62572.367365967366,
+  0,-0.23333333333333334,1074.7333333333333,18153.244444444445,108464.35555555555,307655.1111111111,449285.68888888886,326223.64444444445,93206.75555555556,0,0,-114.1,-4069.7131313131313,-44104.92121212121,-214282.8606060606,-537693.0909090909,-723676.3151515152,-495690.4727272727,-135573.46262626263,0,3.5,410.27630147630146,9526.587723387724,84649.39362859362,365700.5550893551,848556.257964258,1.0798214464646464e6,709153.4968142968,187717.1020979021,0,-12.25897435897436,-936.1311577311577,-17890.690287490288,-141813.89526029525,-567884.4618492619,-1.2480050523698523e6,-1.524549659052059e6,-969871.6941724942,-250289.46946386946,0.0000959824489236254,27.593994241053064,1731.1486631016044,29547.359934183463,217402.40296174414,825519.0614561909,1.7431695357191828e6,2.0641979866721514e6,1.280893167256273e6,323904.019306184,0.4666666666666667,-21.933333333333334,-3355.6222222222223,-42348.08888888889,-203582.57777777777,-479869.15555555554,-594921.2444444444,-372827.02222222224,-93206.75555555556,0,0.7,410.7262626262626,11022.440404040404,96074.47272727273,386563.103030303,819299.296969697,946101.5272727272,563477.2040404041,135573.46262626263,0,0,-15.552602952602953,-1319.1589743589743,-24329.85236985237,-177655.00916860916,-643821.182905983,-1.273099178865579e6,-1.3992012382284382e6,-803012.0478632479,-187717.1020979021,0,0.017948717948717947,50.09052059052059,2871.1639471639473,44222.36891996892,290731.34296814294,983393.9045843045,1.851893577000777e6,1.9625562306138305e6,1.0950164289044288e6,250289.46946386946,-0.0001919648978472508,-0.06315645139174551,-108.91493212669683,-5170.4839160839165,-71524.53607568901,-438562.81431509665,-1.4125950964486494e6,-2.565467062004662e6,-2.6439125666803783e6,-1.4428451769093652e6,-323904.019306184,
+  0,-0.26666666666666666,2116.266666666667,46478.36998556999,367133.99595959595,1.4218853217893217e6,3.00440476998557e6,3.5321728923520925e6,2.169175402020202e6,542293.8505050505,0,0,-170.4,-7878.639405039405,-111119.03776223776,-714162.356043956,-2.447790332334332e6,-4.76751157962038e6,-5.287365042424242e6,-3.1077609125097124e6,-750868.4083916084,0,4,609.1538683538683,18291.647552447554,211297.13166833165,1.2068968343656345e6,3.8238280972360973e6,7.039391328671329e6,7.482612264180264e6,4.254920980885781e6,1.0011578778554779e6,0,-14.007843137254902,-1385.7954019836372,-34183.56217377394,-351855.81673751085,-1.8614895882261528e6,-5.582810520261438e6,-9.861435769605558e6,-1.0149606059509119e7,-5.624151607952831e6,-1.295616077224736e6,0.0000635071842502183,31.527506549178376,2558.0482279330577,56272.57883911754,537113.6969927904,2.6926125869276235e6,7.7549386769432835e6,1.3272122169070559e7,1.3318034401472213e7,7.228173904516948e6,1.6365676764944035e6,0.5333333333333333,-33.06666666666667,-6906.606637806638,-115649.93939393939,-746992.1893217893,-2.4357735803751806e6,-4.414610876767676e6,-4.515080496392496e6,-2.440322327272727e6,-542293.8505050505,0,0.8,636.47881007881,22496.094483294484,259039.60572760573,1.3972491252747253e6,4.090821281118881e6,6.898882843023643e6,6.700457672105672e6,3.483195116705517e6,750868.4083916084,0,0,-18.30773670773671,-2043.3143745143745,-49402.28837828838,-475220.8388944389,-2.3042702023310023e6,-6.28517082917083e6,-1.0076758327894328e7,-9.422355652525252e6,-4.75549991981352e6,-1.0011578778554779e6,0,0.01568627450980392,59.10452945747063,4444.078065725124,89495.53131313132,773530.6577448695,3.495176651510581e6,9.067520102966314e6,1.400317438010878e7,1.2718753849005897e7,6.2719596465652e6,1.295616077224736e6,-0.0001270143685004366,-0.05512423592918949,-128.64458637337896,-7998.43481348373,-144411.5393015653,-1.162342659386434e6,-4.9947002896331735e6,-1.2482808925253488e7,-1.8729284982381087e7,-1.6625264914387986e7,-8.04645774276415e6,-1.6365676764944035e6,
+  0,-0.3,3839.4,106318.05314685314,1.0702797874125873e6,5.392764956643357e6,1.5350685180419581e7,2.580816845874126e7,2.539460421818182e7,1.3515631351048952e7,3.0034736335664336e6,0,0,-242.7,-14124.181152181152,-251299.74452214452,-2.0592303781551782e6,-9.185474911222111e6,-2.4106659233033635e7,-3.8236604926806524e7,-3.601039741911422e7,-1.852142074032634e7,-4.0046315114219114e6,0,4.5,864.0628077804548,32599.88898944193,474679.1184031655,3.455516380591957e6,1.4245058289412549e7,3.533020329192376e7,5.370181410996846e7,4.892054909771013e7,2.449892218752228e7,5.182464308898944e6,0,-15.756965944272446,-1961.5696724328304,-60708.62697178982,-786988.0535711966,-5.303549502574206e6,-2.0688066335863516e7,-4.921807658793219e7,-7.241782910112797e7,-6.427015135233064e7,-3.1503927772517268e7,-6.546270705977614e6,0.00004422821760283061,35.461919504643966,3616.1956285200868,99702.79558212686,1.1976321362253844e6,7.643730469367165e6,2.8621924200018764e7,6.595342171821161e7,9.458539786739412e7,8.219612447821817e7,3.9589351412340805e7,8.104906588353236e6,0.6,-47.4,-13003.506293706294,-278936.1678321678,-2.3265602237762236e6,-9.980674506293707e6,-2.4597585633566435e7,-3.625286534265734e7,-3.158926858741259e7,-1.5017368167832168e7,-3.0034736335664336e6,0,0.9,935.4623043623044,42143.00606060606,619613.8922410923,4.308818503096903e6,1.6579424074592074e7,3.799234747545788e7,5.314447145174825e7,4.452023938088578e7,2.0523736496037297e7,4.0046315114219114e6,0,0,-21.12561556090968,-3003.887892499657,-92251.03664962489,-1.130768793872794e6,-7.0588418527355e6,-2.5277949085518405e7,-5.502439582942548e7,-7.405439677762237e7,-6.019829813355272e7,-2.7090154341971755e7,-5.182464308898944e6,0,0.01393188854489164,68.33903526813744,6531.570529779818,166762.43296022862,1.8339761297278572e6,1.0656330035982594e7,3.6261947787464544e7,7.597502823061767e7,9.92596311986317e7,7.879468948121847e7,3.477706312550607e7,6.546270705977614e6,-0.00008845643520566122,-0.04891640866873065,-148.871487026905,-11752.440015711842,-268684.86844919785,-2.74861261174986e6,-1.5174070609897017e7,-4.97030496228197e7,-1.0110656940201923e8,-1.2902029170934741e8,-1.0047113019907235e8,-4.364180470651743e7,-8.104906588353236e6,
+  0,-0.3333333333333333,6533.333333333333,222654.46091686093,2.778624556954157e6,1.7600566104118105e7,6.443886523574203e7,1.4451080095726496e8,2.0156645274156955e8,1.7053055852804974e8,8.009263022843823e7,1.6018526045687646e7,0,0,-333,-23825.97413044472,-521880.007239819,-5.303014873879062e6,-2.974522501247772e7,-1.0042604004409708e8,-2.1250665797888386e8,-2.837202903655926e8,-2.319741694631016e8,-1.0600495177293295e8,-2.0729857235595778e7,0,5,1181.999610984131,54754.40911616763,980895.6130251585,8.852088141103067e6,4.5880486491885826e7,1.4637328059863028e8,2.967933223074854e8,3.832574936190464e8,3.0507729190651166e8,1.3638063970786697e8,2.6185082823910456e7,0,-17.506265664160402,-2679.1916209005994,-101698.47428388605,-1.6209314727333898e6,-1.3536137961823797e7,-6.6368244028934255e7,-2.0306241420633388e8,-3.984997390155933e8,-5.012577425662849e8,-3.9049673738068247e8,-1.7144994706131846e8,-3.2419626353412945e7,0.000032049433045529426,39.39695786781532,4934.437997592661,166727.4017375813,2.460969788432378e6,1.945561056293358e7,9.154241300341979e7,2.712219032798776e8,5.1868580194167066e8,6.387408437835916e8,4.888559794904897e8,2.114323457831279e8,3.946737121285054e7,0.6666666666666666,-65.33333333333333,-22842.255167055166,-610794.4205128205,-6.384583827195027e6,-3.4760849444599845e7,-1.1109825668873349e8,-2.199600400907537e8,-2.733161006545454e8,-2.075734000087024e8,-8.810189325128205e7,-1.6018526045687646e7,0,1,1318.9482608894373,73805.46920791626,1.3491923253530783e6,1.1743463056410257e7,5.730339427900727e7,1.7019760844996572e8,3.196860685490927e8,3.8177487075555557e8,2.810897971178939e8,1.1636988039073084e8,2.0729857235595778e7,0,0,-23.999221968262216,-4237.817551557489,-161226.06704008067,-2.4533664806920635e6,-1.9149318022051428e7,-8.689604748579635e7,-2.450198244808148e8,-4.4258655082519025e8,-5.1267962114181876e8,-3.683579087309619e8,-1.4947318111982217e8,-2.6185082823910456e7,0,0.012531328320802004,77.76920671347916,9214.54894194213,291039.0946701733,3.9691610755076366e6,2.8811933867454045e7,1.2415265791155085e8,3.367590805724054e8,5.902267861563345e8,6.673985861532614e8,4.701430309700768e8,1.8765976023802492e8,3.2419626353412945e7,-0.00006409886609105885,-0.04397182213846637,-169.53941844936594,-16578.624554339185,-468446.0812958478,-5.9377916416310035e6,-4.0923115567559e7,-1.696412196057358e8,-4.465302941617743e8,-7.640784094103152e8,-8.472253347457047e8,-5.871720202796443e8,-2.3116603138955316e8,-3.946737121285054e7,
+  0,-0.36666666666666664,10559.266666666666,434294.7652086476,6.574489355455003e6,5.10204267471091e7,2.3250794534097537e8,6.64917593632177e8,1.2277649331804926e9,1.4624266471674209e9,1.0850784646757164e9,4.560568591831071e8,8.291942894238311e7,0,0,-443.3,-38255.76555264481,-1.0114779064221641e6,-1.2470381821703581e7,-8.571332767814559e7,-3.6026736682270384e8,-9.722698334254823e8,-1.7186034725420127e9,-1.9784568926620624e9,-1.4283144396604905e9,-5.869822733026594e8,-1.0474033129564182e8,0,5.5,1569.961476844449,87625.69572649573,1.8939060047826958e6,2.0732385792547733e7,1.3166046654165429e8,5.228893340210738e8,1.352134487330338e9,2.311593394202756e9,2.5906866318906407e9,1.8295657646295648e9,7.381699538930948e8,1.2967850541365178e8,0,-19.255693581780537,-3554.4014008396293,-162426.07358635293,-3.1217844988459083e6,-3.16126055748029e7,-1.8987086397373933e8,-7.230764038384147e8,-1.809469262049569e9,-3.0129885415469217e9,-3.304452922123214e9,-2.2917775413786182e9,-9.105686358393375e8,-1.5786948485140216e8,0.00002397297591805601,43.33244851258581,6541.62812737135,265926.5903814425,4.731094982759278e6,4.5340842546994835e7,2.612763288477679e8,9.633487135585018e8,2.348932232111619e9,3.828700312931434e9,4.124825501869743e9,2.8177588722517457e9,1.105086393959815e9,1.894433818216826e8,0.7333333333333333,-87.26666666666667,-37956.79708396179,-1.2378745500251383e6,-1.5839376732026143e7,-1.06514876608547e8,-4.268125048599296e8,-1.084457648638713e9,-1.7937872069180493e9,-1.927228914871795e9,-1.297559501340573e9,-4.9751657365429866e8,-8.291942894238311e7,0,1.1,1798.4311052896192,122419.20256145643,2.723675026625387e6,2.8991573532491863e7,1.7462463657162815e8,6.49987059367659e8,1.5663069635696964e9,2.4893757054309864e9,2.5923743423070254e9,1.7021667641938875e9,6.393524389504802e8,1.0474033129564182e8,0,0,-26.922953688897962,-5782.824037469239,-267059.29319830495,-4.940120546192026e6,-4.71164384933979e7,-2.6376188135589048e8,-9.316258847784076e8,-2.1581550271623797e9,-3.3260680887754226e9,-3.3792200077329974e9,-2.1743360218110523e9,-8.030092065999206e8,-1.2967850541365178e8,0,0.011387163561076604,87.37526544737474,12575.685027901907,481630.25459747476,7.978130346470807e6,7.071870426544951e7,3.7573583030587316e8,1.2761080113371363e9,2.867315117761134e9,4.312316120466565e9,4.2944103377974663e9,2.717461330888649e9,9.895033782650386e8,1.5786948485140216e8,-0.00004794595183611202,-0.039938977879481315,-190.60366239225843,-22626.351358782555,-774685.3323404123,-1.1919507515836926e7,-1.0026023448105781e8,-5.122220252548393e8,-1.6875254790953407e9,-3.7006690484617324e9,-5.456117441460743e9,-5.344261556173933e9,-3.3347814351400876e9,-1.1998080848706565e9,-1.894433818216826e8,
+  0,-0.4,16358.4,798958.1317110135,1.4416265779644504e7,1.3432181467691442e8,7.434303361587911e8,2.626393853597904e9,6.143042747321345e9,9.628736625974842e9,1.0003891869771244e10,6.609352950962489e9,2.5137679510954037e9,4.189613251825673e8,0,0,-575.6,-58965.4028822227,-1.851578588510492e6,-2.721337278865888e7,-2.246109735140044e8,-1.1467505597679276e9,-3.823590344956376e9,-8.562024604039784e9,-1.2971313192672047e10,-1.3113370455110611e10,-8.471497747887982e9,-3.1621604781636624e9,-5.187140216546071e8,0,6,2034.9461170318891,134714.58794018233,3.456620690885645e6,4.5099821439376034e7,3.4389086889063436e8,1.6588888433384745e9,5.299781267706849e9,1.1477806342984741e10,1.6928250138062456e10,1.6740562578044119e10,1.0617264990476751e10,3.9016315541846533e9,6.314779394056087e8,0,-21.00521739130435,-4602.940974829003,-249320.1853983052,-5.686343886484196e6,-6.861345311881912e7,-4.947368541065237e8,-2.288195708861567e9,-7.073833639317552e9,-1.4920448268974035e10,-2.1533210358591484e10,-2.091140714317489e10,-1.3059753134332243e10,-4.736084545542065e9,-7.577735272867304e8,0.00001840349666436623,47.2682769726248,8466.622898449223,407758.88048708765,8.605464337728756e6,9.82448816901423e7,6.795288568188525e8,3.042463166214668e9,9.163485366790909e9,1.8918381774570183e10,2.681818912368284e10,2.565065895730421e10,1.5811505960561546e10,5.669268611552575e9,8.981019582657546e8,0.8,-113.6,-60265.06342202689,-2.354631489783282e6,-3.6188869743358806e7,-2.9423519790246165e8,-1.4410252993176384e9,-4.548903494657308e9,-9.579486167460339e9,-1.3604387251458832e10,-1.2876514478657967e10,-7.78768167803846e9,-2.7232486136866875e9,-4.189613251825673e8,0,1.2,2385.605764445393,194164.23206487356,5.166394900690916e6,6.6000166193341576e7,4.804116328378407e8,2.1848240357089143e9,6.539431397703931e9,1.3229596648755936e10,1.8207931242597847e10,1.6804843678929035e10,9.955319107909575e9,3.4215174889909663e9,5.187140216546071e8,0,0,-29.892234063778012,-7677.3315851704865,-423195.2594681369,-9.353395630081888e6,-1.069960803506276e8,-7.235025322877827e8,-3.121175266299493e9,-8.978155548848114e9,-1.7608717027453564e10,-2.363934658860129e10,-2.1376840213692146e10,-1.2449678653930527e10,-4.217370523887458e9,-6.314779394056087e8,0,0.010434782608695653,97.14108009278826,16699.23576343072,762726.8199599064,1.5085840946795626e7,1.603035047267927e8,1.0283599406244267e9,4.2643450431212244e9,1.1894505365747297e10,2.2759909848626797e10,2.9943147410467827e10,2.6624309126235004e10,1.5285712870737015e10,5.114971309185431e9,7.577735272867304e8,-0.00003680699332873246,-0.03658615136876006,-212.02777987521023,-30047.89230250005,-1.2262431435256745e6,-2.251696238611375e7,-2.2695429228591478e8,-1.3994804759815316e9,-5.627673799689461e9,-1.5316193575786037e10,-2.8723952643539726e10,-3.7161678742566864e10,-3.257762113150629e10,-1.8477746149163006e10,-6.118319590685452e9,-8.981019582657546e8,
+  0,-0.43333333333333335,24459.933333333334,1.39948310974227e6,2.9664356557875972e7,3.264766937613553e8,2.1527966210326242e9,9.174872352635342e9,2.63526819412877e10,5.20431450209414e10,7.080795804555496e10,6.521613086318431e10,3.8830607464800354e10,1.3486564563019785e10,2.0748560866184285e9,0,0,-731.9,-87814.82467992813,-3.230537622359549e6,-5.578284651915676e7,-5.439079051073674e8,-3.308797228275689e9,-1.3310466229841167e10,-3.660457080636495e10,-6.987539486462099e10,-9.251142702281056e10,-8.331826353464978e10,-4.868864058693869e10,-1.6643954260047829e10,-2.5259117576224346e9,0,6.5,2583.9516267845465,200215.24405318496,6.016616118581815e6,9.221263263214113e7,8.305750837148908e8,4.77383576908197e9,1.840021088352963e10,4.8939353849036934e10,9.094760672013042e10,1.177844008258246e11,1.0414198859975996e11,5.991259714028463e10,2.0207294060979477e10,3.0310941091469216e9,0,-22.754814814814814,-5840.553656708876,-370080.7888040544,-9.881938796070835e6,-1.4003615801375034e8,-1.1925823709998772e9,-6.57143044116013e9,-2.4508050681444206e10,-6.348184946356478e10,-1.1543549489334048e11,-1.468037932397025e11,-1.27811573462042e11,-7.256032344847891e10,-2.4192621500783764e10,-3.5924078330630183e9,0.00001443722583152868,51.20436448442445,10738.282242670764,604748.6713855794,1.493782547301189e7,2.0024139920202476e8,1.6355739069693673e9,8.723538381973366e9,3.1694134443060642e10,8.035017116564796e10,1.435061488294865e11,1.797385196878227e11,1.544460759994406e11,8.668740434615086e10,2.861538653232956e10,4.211788493935952e9,0.8666666666666667,-144.73333333333332,-92115.75281787357,-4.24804535780092e6,-7.720394235745513e7,-7.459561839697425e8,-4.37688462512671e9,-1.675264548351156e10,-4.352291071881835e10,-7.819993218306961e10,-9.728719442636674e10,-8.229722149813876e10,-4.518485423006929e10,-1.4523992606328999e10,-2.0748560866184285e9,0,1.3,3092.3493598562786,296618.58790897264,9.301895812628992e6,1.4042234137451884e8,1.2141829505065637e9,6.6136711412013e9,2.3997256897036137e10,5.988243978747334e10,1.0425835625270293e11,1.2646490694806935e11,1.0477864663163727e11,5.65370092624084e10,1.7906910138859047e10,2.5259117576224346e9,0,0,-32.90325356909285,-9960.403453242889,-646128.1687916917,-1.6817577993811376e7,-2.272190859950398e8,-1.8244572021268456e9,-9.424164410318285e9,-3.2855536243018745e10,-7.94693874291209e10,-1.3493911256397678e11,-1.6035193404744455e11,-1.3059358460620116e11,-6.944791402530933e10,-2.1722841115552937e10,-3.0310941091469216e9,0,0.00962962962962963,107.05323934367682,21670.89761846037,1.1640149545323383e6,2.7098524121223144e7,3.3995615473259085e8,2.5888012200866394e9,1.2850503978831438e10,4.34323908124913e10,1.0247227787993118e11,1.704876950572971e11,1.9917787189184882e11,1.5989240688923416e11,8.398305773017148e10,2.5988825417315273e10,3.5924078330630183e9,-0.00002887445166305736,-0.033754233994114057,-233.78149683578326,-38998.16031069183,-1.8707910950575937e6,-4.041802774693853e7,-4.8079742512005436e8,-3.518362643932259e9,-1.6932117246290905e10,-5.582666431497299e10,-1.2906973332811464e11,-2.1113776786988696e11,-2.4316208621413403e11,-1.9281924836901074e11,-1.0020538726970265e11,-3.0721280779297535e10,-4.211788493935952e9,
+  0,-0.4666666666666667,35489.066666666666,2.3512673864932396e6,5.783459782554564e7,7.417629589224231e8,5.737794526335927e9,2.8958539764775536e10,9.980418605461873e10,2.4087583664136777e11,4.1111360367982263e11,4.938686168666484e11,4.0842050111710443e11,2.2130873014861176e11,7.072552921342816e10,1.0103647030489738e10,0,0,-914.2,-127000.05298477177,-5.410357632421346e6,-1.084187847239819e8,-1.2320553672292948e9,-8.793144231643013e9,-4.189268519105384e10,-1.3824796054280862e11,-3.2253689193271765e11,-5.3569991047103217e11,-6.2930263262471e11,-5.107830750947536e11,-2.7241958305957956e11,-8.588099975916278e10,-1.2124376436587687e10,0,7,3223.9763957964633,289078.1147930231,1.0056934701494202e7,1.7885319900918955e8,1.8774039305941489e9,1.2659112178824976e10,5.778636226399293e10,1.8443310408086594e11,4.188943611564575e11,6.80570218646967e11,7.848818851678533e11,6.271698565745526e11,3.30024403976469e11,1.028326742214289e11,1.4369631332252073e10,0,-24.504469987228607,-7282.983796526446,-533794.5211804865,-1.6496528391199792e7,-2.7121016480072916e8,-2.69139348470133e9,-1.7396960801336163e10,-7.683642125146432e10,-2.388197884303981e11,-5.3073846409068134e11,-8.467207746541761e11,-9.615174725410426e11,-7.581688663491782e11,-3.943770868588842e11,-1.2164636179544427e11,-1.6847153975743809e10,0.000011535450912536563,55.140655048819674,13385.468430331828,871673.8196526119,2.4913415664470177e7,3.873820740702931e8,3.686591045638684e9,2.3063912016993534e10,9.92281083489501e10,3.018436477318775e11,6.588209340059844e11,1.0351031513181844e12,1.160082623098246e12,9.043453403023804e11,4.6572230892101843e11,1.4238562392402832e11,1.9564436875057327e10,0.9333333333333333,-181.06666666666666,-136335.83965314535,-7.327933577454448e6,-1.5542659822206742e8,-1.7593665355350988e9,-1.2169475752962036e10,-5.541107203717101e10,-1.734553628583209e11,-3.823252362645737e11,-5.987312993848872e11,-6.626663891105165e11,-5.067610463730009e11,-2.5477706093710904e11,-7.577735272867303e10,-1.0103647030489738e10,0,1.4,3930.705969543536,438914.5575660432,1.6021909399733834e7,2.821148285309416e8,2.8568306121554456e9,1.834034705520107e10,7.915174003764148e10,2.3795742789826575e11,5.0818633097929156e11,7.758814204731168e11,8.410097103451432e11,6.320268394606305e11,3.130867623573008e11,9.194318797745662e10,1.2124376436587687e10,0,0,-35.952791592926204,-12671.688278689997,-955744.668589088,-2.8937820175670214e7,-4.558361881243446e8,-4.2852364908962717e9,-2.6082358434683636e10,-1.0813493285251514e11,-3.150596210807534e11,-6.56127990059077e11,-9.812778081103854e11,-1.045448978125867e12,-7.742480850836678e11,-3.7874643521238617e11,-1.1001748988755493e11,-1.4369631332252073e10,0,0.008939974457215836,117.10041553054182,27577.685460833156,1.7212957303475374e6,4.6594371675881036e7,6.812809157261431e8,6.07243220002907e9,3.551011349027069e10,1.4269874524439893e11,4.054913031711275e11,8.273111760165848e11,1.2162825061370105e12,1.2771474457642676e12,9.341281376272004e11,4.520414263861544e11,1.3006993878331618e11,1.6847153975743809e10,-0.000023070901825073126,-0.031330284678449304,-255.83925591764077,-49634.48688799174,-2.765829691982738e6,-6.945891513716699e7,-9.627476140344408e8,-8.244250951607839e9,-4.673088800021546e10,-1.8316187642444714e11,-5.0994384612902716e11,-1.022841420534557e12,-1.4821974712563923e12,-1.5372206353757112e12,-1.112343356234171e12,-5.3324678896895935e11,-1.5216784236155698e11,-1.9564436875057327e10,
+  0,-0.5,50175,3.8110518751832955e6,1.076462696229007e8,1.5907243629794188e9,1.4251013900556408e10,8.39147841034878e10,3.408264309321651e11,9.827003704330287e11,2.041566817044961e12,3.065320744754241e12,3.2952209252682485e12,2.4722631961132183e12,1.2290545345785562e12,3.6373129309763055e11,4.8497505746350746e10,0,0,-1124.5,-179081.18687280125,-8.746490101655236e6,-2.0128246173478386e8,-2.6356156253879805e9,-2.1787106957386932e10,-1.2111135286756642e11,-4.7103679933522406e11,-1.312930805324278e12,-2.654465838545084e12,-3.897567876302638e12,-4.1124050502739814e12,-3.036874638157322e12,-1.489333703666579e12,-4.355794497588909e11,-5.747852532900829e10,0,7.5,3962.019044757294,407072.920718967,1.6232431369128535e7,3.3147987895103717e8,4.0090734366763234e9,3.13099625273733e10,1.6676035684980087e11,6.272725393185522e11,1.702120269314377e12,3.366309892830835e12,4.852504880352651e12,5.040497006172991e12,3.6725169792886714e12,1.7801426017692478e12,5.153247098462812e11,6.7388615902975235e10,0,-26.25417130144605,-8945.976556539295,-751050.1272782461,-2.6597813264939196e7,-5.0203783424558866e8,-5.739732894683955e9,-4.2968855344066925e10,-2.214204398894586e11,-8.110701607930319e11,-2.1534160242155322e12,-4.1819214920925874e12,-5.935635976892781e12,-6.084107901642862e12,-4.381942913426506e12,-2.1025895514418992e12,-6.03236803647601e11,-7.825774750022931e10,9.363190675760198e-6,59.07710774785302,16437.045563842872,1.2257532331766458e6,4.013768184797409e7,7.164271778242302e8,7.854094148649289e9,5.6903267984881676e10,2.856175070922272e11,1.0238847552212717e12,2.6698130647352876e12,5.105908405067799e12,7.152238271875518e12,7.247671528966757e12,5.167805995087918e12,2.457745328571359e12,6.99576833714171e11,9.011498196996101e10,1,-223,-196278.75036659127,-1.2163480027372148e7,-2.9773689168561506e8,-3.901236201224221e9,-3.1389389329419144e10,-1.6743088681163474e11,-6.199947751483894e11,-1.6382802519391409e12,-3.132920728260574e12,-4.3465612386153613e12,-4.3323760798965054e12,-3.0231374871104106e12,-1.4018268987999307e12,-3.8798004597080597e11,-4.8497505746350746e10,0,1.5,4912.873745602497,631897.2803378738,2.656490166119503e7,5.395585963900452e8,6.322823026301706e9,4.720796893278593e10,2.3863565691698135e11,8.485721474191187e11,2.172352790028894e12,4.049809894234472e12,5.50235200650019e12,5.38931258216232e12,3.7052589549104136e12,1.6963462050468354e12,4.643187124233951e11,5.747852532900829e10,0,0,-39.038089514588414,-15851.374766259272,-1.3756719102298168e6,-4.7943245278919205e7,-8.708307769571735e8,-9.47113944257027e9,-6.703028125916526e10,-3.254547834230943e11,-1.1214448357099817e12,-2.7992820802386875e12,-5.111448386239666e12,-6.825434396193574e12,-6.587638039199097e12,-4.472282579818021e12,-2.0251695912105806e12,-5.4901901779776886e11,-6.7388615902975235e10,0,0.008342602892102336,127.27291285612064,34507.8303268765,2.4771144537147037e6,7.715353799846987e7,1.3004413372683635e9,1.3407053636109262e10,9.11467268081413e10,4.288886516771684e11,1.4411578341601123e12,3.5239100414919814e12,6.3247528225204e12,8.32319236966487e12,7.933155759027074e12,5.327467452291677e12,2.3895346256094067e12,6.423656773977156e11,7.825774750022931e10,-0.000018726381351520396,-0.029231881289723337,-278.179190366686,-62116.434369362025,-3.979701958366857e6,-1.1496637205380797e8,-1.8365386839217353e9,-1.8187049742974773e10,-1.198292372617549e11,-5.49880612073813e11,-1.810124500260231e12,-4.3508491817515527e12,-7.696337232599344e12,-1.000270962164139e13,-9.431448443943848e12,-6.273956282611874e12,-2.7906371863090767e12,-7.446343246991516e11,-9.011498196996101e10,
+  0,-0.5333333333333333,69358.93333333333,5.9871611113645565e6,1.924439018268767e8,3.2448156139755497e9,3.330669577632881e10,2.2601945627174777e11,1.0662940872799772e12,3.608672101565586e12,8.923743251707213e12,1.6254636226822168e13,2.1772292854629945e13,2.117283786317375e13,1.453488209257297e13,6.674693753831088e12,1.8393128105282654e12,2.2991410131603317e11,0,0,-1364.8,-247010.3969398599,-1.3710914253764993e7,-3.5907586422209996e8,-5.365095399350815e9,-5.081736342983615e10,-3.255698706535722e11,-1.470867065526843e12,-4.812414875990048e12,-1.1581712843876643e13,-2.0631072691303906e13,-2.7124046546863812e13,-2.5963317717947027e13,-1.758285432472868e13,-7.979604930158186e12,-2.1762558900431414e12,-2.6955446361190094e11,0,8,4805.078378923909,560851.6328710681,2.5412128545875855e7,5.904978119526415e8,8.148894279740852e9,7.291974445465744e10,4.476097728118765e11,1.955793734114073e12,6.229626820644424e12,1.4665713663876832e13,2.56478138439078e13,3.319636806334255e13,3.135144116117232e13,2.098522418302309e13,9.426637994127908e12,2.547724446396354e12,3.1303099000091724e11,0,-28.003910068426197,-10845.277747543556,-1.0340539156313771e6,-4.160211107138518e7,-8.934162310823445e8,-1.1653781015963501e10,-9.995712648139485e10,-5.936175304669795e11,-2.525790561524574e12,-7.87163260522547e12,-1.819637446847215e13,-3.1333388101515715e13,-4.001900002443862e13,-3.736019485586116e13,-2.4754756721440023e13,-1.1020607767604893e13,-2.954822829857143e12,-3.6045992787984406e11,7.704568327482677e-6,63.01369198098898,19921.879208008424,1.6868344786841804e6,6.273964748932823e7,1.273959927266718e9,1.593305010069684e10,1.3225038205179854e11,7.649853076246484e11,3.185325437278451e12,9.749212126813445e12,2.219341094639236e13,3.771515415332075e13,4.76205488262829e13,4.401174323403532e13,2.890378760514151e13,1.2766176186368576e13,3.3986221771528154e12,4.1195420329125037e11,1.0666666666666667,-270.93333333333334,-275873.1560624472,-1.9526615598641343e7,-5.463067917939428e8,-8.201340252473525e9,-7.590059501108307e10,-4.682825773172421e11,-2.0210768151063833e12,-6.288523857290183e12,-1.4356521317251836e13,-2.4229695665058094e13,-3.016739913942077e13,-2.7348748241932996e13,-1.7548912264512844e13,-7.551241265098464e12,-1.9542698611862817e12,-2.2991410131603317e11,0,1.6,6051.193879719814,888285.5021747415,4.261058156357549e7,9.887753453648256e8,1.327213854827666e10,1.1396014858065186e11,6.662406988329823e11,2.7610060006323486e12,8.322298591918423e12,1.852086668895058e13,3.0609487847613902e13,3.744833590963831e13,3.344798330425991e13,2.11898795413883e13,9.017191413252525e12,2.311033121849092e12,2.6955446361190094e11,0,0,-42.156757847819044,-19540.15290525303,-1.9336304731780519e6,-7.685712819702701e7,-1.594439517783882e9,-1.9858807743317722e10,-1.6160641862808392e11,-9.073615412262385e11,-3.643384657047884e12,-1.0707067507058748e13,-2.333725913033687e13,-3.790443110434288e13,-4.569379747197401e13,-4.029844176053195e13,-2.5250191501700312e13,-1.0641806906700912e13,-2.7042399413968125e12,-3.1303099000091724e11,0,0.007820136852394917,137.56233770685833,42550.691954386595,3.4813989145593178e6,1.2363151215452614e8,2.3794672470258155e9,2.8087829807876396e10,2.19531539097911e11,1.1943955071569575e12,4.67634681344435e12,1.34610069080083e13,2.883661986591e13,4.615458622396285e13,5.4943021866992516e13,4.792868725397259e13,2.9744824442882992e13,1.2430432946055994e13,3.135052793797065e12,3.6045992787984406e11,-0.000015409136654965353,-0.027397444972528398,-300.78237626127407,-76605.63532406824,-5.592621537223804e6,-1.841644469419035e8,-3.3586851599070764e9,-3.807661046434377e10,-2.883838211797314e11,-1.5299369967994255e12,-5.867608218199371e12,-1.6601437441364713e13,-3.5048526877146164e13,-5.5398397289151914e13,-6.523376765866994e13,-5.636627223479088e13,-3.46882547466682e13,-1.4388245861827873e13,-3.604599278798441e12,-4.1195420329125037e11,
+  0,-0.5666666666666667,94002.06666666667,9.151311935305258e6,3.320851910459127e8,6.33521032186008e9,7.382275924950447e10,5.713935821593523e11,3.094041226242078e12,1.2118112094805514e13,3.5055579190329652e13,7.577080308439667e13,1.2277365554920727e14,1.4836959871768953e14,1.316939805223555e14,8.331707351347927e13,3.554854783594292e13,9.164851762804633e12,1.0782178544476038e12,0,0,-1637.1,-334159.9205226142,-2.0918744937359024e7,-6.185177808929194e8,-1.0456566421124214e10,-1.1244319702124878e11,-8.217073662582078e11,-4.261136422965968e12,-1.613507388311211e13,-4.54274671317859e13,-9.60274321618125e13,-1.5272694341908484e14,-1.8167523305110694e14,-1.5908213959048006e14,-9.946452714264984e13,-4.200158523126891e13,-1.0730006712809219e13,-1.252123960003669e12,0,8.5,5760.15335336423,758011.4560133434,3.872804138514868e7,1.0159241892397866e9,1.586238004713476e10,1.611446504457956e11,1.1282876946995315e12,5.658785050777512e12,2.0860295618072766e13,5.745164785582471e13,1.1922862068135155e14,1.8668579152657497e14,2.1910636544081044e14,1.8963108518772156e14,1.1735697816416962e14,4.9110491347309305e13,1.2445353299430406e13,1.4418397115193762e12,0,-29.753679653679654,-12996.633706471774,-1.396745220816542e6,-6.3353746792567894e7,-1.5357532178764133e9,-2.2663668846309917e10,-2.2067759802151013e11,-1.4948161492516946e12,-7.300452192754711e12,-2.633115093534921e13,-7.12076759521055e13,-1.4550478401170806e14,-2.2481450876051734e14,-2.608206421034274e14,-2.2345389682757944e14,-1.3705312915212823e14,-5.689609265768836e13,-1.4315408564370951e13,-1.6478168131650015e12,6.416135448393513e-6,66.95038440199731,23868.836113681442,2.2775814000040796e6,9.549105192520149e7,2.1884705815436573e9,3.0963237347720776e10,2.91743710502673e11,1.9247605684553428e12,9.198896562512525e12,3.258322450023937e13,8.677160313048934e13,1.749810194392509e14,2.6727116291968612e14,3.0697010372751906e14,2.6065987367419022e14,1.5860983054210656e14,6.537859338635338e13,1.6344561363015016e13,1.8704947608900017e12,1.1333333333333333,-325.26666666666665,-379672.3372771824,-3.044289317860951e7,-9.653190181565726e8,-1.645654568518213e10,-1.7350035488585364e11,-1.224974862145457e12,-6.087121650396307e12,-2.198279146517062e13,-5.886931627391679e13,-1.1819629684730314e14,-1.7844037358940066e14,-2.014677026353088e14,-1.674879308472654e14,-9.947402064977933e13,-3.992880786963631e13,-9.703960690028434e12,-1.0782178544476038e12,0,1.7,7358.141045228405,1.2228343356326213e6,6.639078335866816e7,1.7454206071277142e9,2.6599212141387142e10,2.601475592017887e11,1.740271415261319e12,8.302886018750533e12,2.904578302199949e13,7.582019351190167e13,1.490656602100751e14,2.211250836544858e14,2.4596589754150544e14,2.018771799198576e14,1.185708301208829e14,4.713181534517283e13,1.1356068692811053e13,1.252123960003669e12,0,0,-45.30670672845925,-23779.18039507422,-2.661791803943833e6,-1.1969660677337208e8,-2.812574307228695e9,-3.9764345032168434e10,-3.685338752285082e11,-2.367394455421027e12,-1.0942906507013615e13,-3.73202401876562e13,-9.540709750646728e13,-1.843299072761322e14,-2.694183018006003e14,-2.9589668840921594e14,-2.401899624280804e14,-1.3971389256713602e14,-5.5062823051114625e13,-1.3166273155190094e13,-1.4418397115193762e12,0,0.00735930735930736,147.96135233748615,51796.68308694178,4.792105916700205e6,1.9247997245947763e8,4.195150944550882e9,5.6203346619271835e10,5.002227932450558e11,3.113437647355672e12,1.403128377992629e13,4.686853664732211e13,1.1775423667475845e14,2.241800875868455e14,3.235464771315656e14,3.5146497769033325e14,2.825652031993201e14,1.6297151920138706e14,6.37448312874054e13,1.5139316970953451e13,1.6478168131650015e12,-0.000012832270896787026,-0.025780032231645135,-323.6322744648659,-93265.65360101484,-7.69771425123931e6,-2.866519541825688e8,-5.919173280043663e9,-7.614963399570706e10,-6.566791772809753e11,-3.985094039738327e12,-1.7590885222630846e13,-5.775012578906397e13,-1.429804558962491e14,-2.6879959044347166e14,-3.8372757967297875e14,-4.1286846760141056e14,-3.291372259583687e14,-1.8840988086355138e14,-7.320015630019402e13,-1.7279808743460016e13,-1.8704947608900017e12,
+  0,-0.6,125193.6,1.3652102441336416e7,5.554014600143847e8,1.1899676153316288e10,1.56165088407177e11,1.366540496131952e12,8.40861783023701e12,3.767209777990931e13,1.2572771066140053e14,3.1699683846911475e14,6.078847468910346e14,8.864741332485448e14,9.755540111565658e14,7.962880116350478e14,4.6711589143195694e14,1.8610613034936884e14,4.507646256013208e13,5.008495840014676e12,0,0,-1943.4,-444350.0575188254,-3.1158621445006426e7,-1.0328718631043336e9,-1.9611734199856762e10,-2.3751855080120044e11,-1.9624234636460256e12,-1.1564556559203219e13,-5.009287309334422e13,-1.6271440389198622e14,-4.0123038305561994e14,-7.55244323016712e14,-1.0841303144905668e15,-1.1770068866194732e15,-9.494737901060278e14,-5.512548272291732e14,-2.1763242435124375e14,-5.228566111772896e13,-5.767358846077505e12,0,9,6834.2430464192685,1.0071578139815058e6,5.7630935107687674e7,1.6947655536972034e9,2.971887868603432e10,3.400242318221734e11,2.691676008673227e12,1.5341040964447729e13,6.469277318651995e13,2.0556218578916944e14,4.9764013132721725e14,9.221943510366396e14,1.306119324762518e15,1.4015595146061295e15,1.1191029056445291e15,6.438857748567351e14,2.5216204623961334e14,6.0145313680522555e13,6.591267252660006e12,0,-31.503474903474903,-15415.791203007979,-1.8549118704564322e6,-9.421570811376691e7,-2.5600544123712883e9,-4.242743900283097e10,-4.6525101895250854e11,-3.5629896100471016e12,-1.977415609780622e13,-8.158625551552306e13,-2.545518754366963e14,-6.067625924438578e14,-1.1095340952535998e15,-1.553365741029738e15,-1.650033451843795e15,-1.3057251452334125e15,-7.452766846539458e14,-2.8978473074627556e14,-6.867387907839006e13,-7.481979043560007e12,5.4000054000054e-6,70.88716688716688,28306.784007021753,3.0236617450400395e6,1.4194238784983155e8,3.6460856395006375e9,5.792852759286986e10,6.146661187977393e11,4.584553043233062e12,2.4898101684512574e13,1.008823224117668e14,3.099519834507942e14,7.291125023795298e14,1.3180326124569462e15,1.826761435393357e15,1.9232229378190795e15,1.5098730462049652e15,8.556875473106161e14,3.305876811925353e14,7.788932029962469e13,8.4412071260677e12,1.2,-386.4,-512904.0826728312,-4.6250508101108156e7,-1.6498943779538748e9,-3.1693433546401592e10,-3.774969633261728e11,-3.0222573837808267e12,-1.7114252146731506e13,-7.088860314805319e13,-2.195652433185797e14,-5.154436720771549e14,-9.229759888796809e14,-1.260086991646628e15,-1.3012905395960398e15,-9.989055197138905e14,-5.52186666361618e14,-2.0770526865943212e14,-4.758071048013942e13,-5.008495840014676e12,0,1.8,8846.315037650835,1.652499890670798e6,1.0081815236953616e8,2.980852295984091e9,5.117658296341241e10,5.653923499515992e11,4.2884376326036885e12,2.3314343858552824e13,9.354089348013502e13,2.8240048108547756e14,6.491502225984054e14,1.142121460503862e15,1.5361570189811522e15,1.5661512339351905e15,1.188884318540835e15,6.508081678370406e14,2.4269387512646872e14,5.516934054076771e13,5.767358846077505e12,0,0,-48.486092838536685,-28610.053294245357,-3.5971398670573817e6,-1.8170450901651797e8,-4.800628986511418e9,-7.645048609922267e10,-8.002747183060198e11,-5.828318542596038e12,-3.0696178946402035e13,-1.2005854798795881e14,-3.549510824718861e14,-8.017723301469554e14,-1.3898631564766085e15,-1.8456808435841622e15,-1.8609896441157935e15,-1.3990467910248515e15,-7.593074829663808e14,-2.8099884047000084e14,-6.3440947306852555e13,-6.591267252660006e12,0,0.0069498069498069494,158.46348709704054,62337.20331735644,6.475875533245151e6,2.921192897693864e8,7.157442458806223e9,1.0799555655084192e11,1.0855125833750288e12,7.659196496678287e12,3.932659690536154e13,1.5063960727715928e14,4.376723566398628e14,9.741274125347245e14,1.6673482941700252e15,2.189911586818609e15,2.1868594523613995e15,1.630061509290193e15,8.779941332352192e14,3.227187992148031e14,7.241486860017006e13,7.481979043560007e12,-0.0000108000108000108,-0.024343224343224345,-346.71430558980086,-112261.86290506809,-1.0402072220276337e7,-4.349568507848248e8,-1.009552791463289e10,-1.4625792737830328e11,-1.4242626335574956e12,-9.797394622514166e12,-4.9269031116791766e13,-1.8547288277928522e14,-5.3100005187471706e14,-1.167000294197266e15,-1.9756813909489115e15,-2.5700586158413735e15,-2.544779679266689e15,-1.882576246583223e15,-1.007168503518773e15,-3.6794961500620994e14,-8.210992386265853e13,-8.4412071260677e12,
+  0,-0.6333333333333333,164158.73333333334,1.9930293177442875e7,9.033522147628825e8,2.159562943718983e10,3.1695435436427655e11,3.1117616133093535e12,2.1572888288816043e13,1.09484309701826e14,4.1677133450584825e14,1.2090804894217778e15,2.6979173704553415e15,4.645555959846248e15,6.155935299753043e15,6.217286496234509e15,4.696578395452082e15,2.568066717852626e15,9.596044046707916e14,2.191596361509452e14,2.306943538431002e13,0,0,-2285.7,-581877.1667007137,-4.542712920857985e7,-1.6777496857464986e9,-3.554596419337812e10,-4.8146941932528937e11,-4.463236488322537e12,-2.963468073013338e13,-1.4541483616136725e14,-5.387724333982664e14,-1.528682077106105e15,-3.3483222279232085e15,-5.675362800076585e15,-7.419408932698538e15,-7.405721111493924e15,-5.536919691805194e15,-3.000077941416619e15,-1.1119673832339076e15,-2.5211597241424522e14,-2.6365069010640023e13,0,9.5,8034.346639088207,1.3179673367617e6,8.39534763120524e7,2.750469750609688e9,5.381559497441904e10,6.886135692098751e11,6.116068398456957e12,3.927525531830635e13,1.87621875146192e14,6.800177457846064e14,1.8942591437198682e15,4.0847532803221355e15,6.831268665098625e15,8.82695090814349e15,8.720982640500069e15,6.461561639299811e15,3.4729854777955795e15,1.277987710634628e15,2.8787805081888025e14,2.9927916174240027e13,0,-33.253291753291755,-18118.497367092852,-2.4263056561244098e6,-1.371723164151261e8,-4.1521251582654886e9,-7.677555171735455e10,-9.415385502549863e11,-8.089827546033466e12,-5.058607217578998e13,-2.364337668337472e14,-8.414253645683544e14,-2.307828334679184e15,-4.910703691264801e15,-8.118041289783834e15,-1.0383658748433438e16,-1.0167288912591014e16,-7.473149461470064e15,-3.9880042421706445e15,-1.4580506661137562e15,-3.2652123928561875e14,-3.37648285042708e13,4.587809465858246e-6,74.82402515085442,33264.59142595566,3.9539347999028377e6,2.0657696267892247e8,5.910713251530081e9,1.0476957462492262e11,1.2431924580143315e12,1.0402955953492928e13,6.365382991017692e13,2.9216326172935256e14,1.0238733031895974e15,2.7713247980029775e15,5.829535183879195e15,9.540280533475378e15,1.209446128636118e16,1.1748726073620186e16,8.574250203286003e15,4.5463150567317e15,1.6525312353663298e15,3.6811898393680606e14,3.788249051698675e13,1.2666666666666666,-454.73333333333335,-681521.0882190833,-6.866812258629e7,-2.7377423472293215e9,-5.885373059155742e10,-7.861999036201415e11,-7.081109305222594e12,-4.529513317348146e13,-2.1305179026514706e14,-7.544247442837826e14,-2.042292971648917e15,-4.264112494563583e15,-6.887192122673396e15,-8.579721224269423e15,-8.162941954518764e15,-5.819981799016939e15,-3.0089392479769985e15,-1.064858703611706e15,-2.3069435384310022e14,-2.306943538431002e13,0,1.9,10528.43340142741,2.1966056588859563e6,1.496340808486337e8,4.94310202090654e9,9.495646973148334e10,1.1764390850983005e12,1.0037702723170137e13,6.163907586873927e13,2.808207197238787e14,9.692149606108888e14,2.56903911487428e15,5.27020715794106e15,8.385800766327233e15,1.0313148662287174e16,9.703156383423962e15,6.850671684428315e15,3.5112616134256495e15,1.2330819190015352e15,2.6529850691956525e14,2.6365069010640023e13,0,0,-51.693278176413344,-34074.78014180465,-4.781836743440356e6,-2.6961591339264446e8,-7.957160824871687e9,-1.417663970015018e11,-1.6639977875868992e12,-1.3631292963271166e13,-8.108623737250361e13,-3.6010324340970756e14,-1.2170534965459422e15,-3.1699041795772295e15,-6.406817661291515e15,-1.006485817543921e16,-1.2241435673077942e16,-1.1405817498928164e16,-7.983798180042419e15,-4.0608079407256885e15,-1.4163152517613982e15,-3.0284200890600025e14,-2.9927916174240027e13,0,0.006583506583506584,169.06299475396784,74264.58077013028,8.60869260141037e6,4.3336689596040046e8,1.1859561376200863e10,2.0016987814094357e11,2.255834083018215e12,1.7902005880230887e13,1.0381148852085344e14,4.5148680237416356e14,1.499482007722108e15,3.8480749449814715e15,7.679151287997549e15,1.1931083759742532e16,1.4371388164888972e16,1.3276270216445754e16,9.222548421515924e15,4.658972295533745e15,1.614980380412015e15,3.434036535377542e14,3.37648285042708e13,-9.175618931716493e-6,-0.023058330375403547,-370.01552049520996,-133761.33977549043,-1.3827819745792182e7,-6.451738118427956e8,-1.6723378636699493e10,-2.709901673195793e11,-2.9584696444771226e12,-2.288771647820421e13,-1.2998082039545089e14,-5.555315701855969e14,-1.8179762075703875e15,-4.606611728235598e15,-9.092222501474912e15,-1.3990963605707124e16,-1.6709589472590812e16,-1.5319694204447672e16,-1.0570016078374418e16,-5.307109848412682e15,-1.8294877603627978e15,-3.8706022919529944e14,-3.788249051698675e13,
+  0,-0.6666666666666666,212266.66666666666,2.853599258035219e7,1.4330114863456995e9,3.800258146404937e10,6.199274770948887e11,6.782860407787912e12,5.259010470068523e13,2.998352445442762e14,1.289474302995765e15,4.256253873967506e15,1.0902678302444068e16,2.1797926698136784e16,3.403776778865586e16,4.131592071162812e16,3.85489253454479e16,2.709770607257666e16,1.3874444112447926e16,4.881180309397506e15,1.054602760425601e15,1.054602760425601e14,0,0,-2666,-751541.6624389548,-6.496750631920008e7,-2.6584414136368732e9,-6.248207318933823e10,-9.406826677470544e11,-9.718503789838549e12,-7.216907849489138e13,-3.978378205026157e14,-1.6653179634893145e15,-5.376204754295016e15,-1.3518436707709178e16,-2.6605608406951144e16,-4.0986885639172104e16,-4.9169772065455784e16,-4.540651511838149e16,-3.162877001568124e16,-1.6063591016532404e16,-5.610415428520925e15,-1.204242341296801e15,-1.1971166469696011e14,0,10,9367.463398770313,1.701250849010266e6,1.1998124014091475e8,4.354863213182676e9,9.45208118958657e10,1.344305113466995e12,1.3306614989260633e13,9.556877985629884e13,5.12895265809024e14,2.1002083731150322e15,6.656579614385937e15,1.6478625548324368e16,3.1999232770493936e16,4.8724507460816184e16,5.785749736908936e16,5.294839315410694e16,3.65864067552318e16,1.844784707627131e16,6.401367498840126e15,1.365940789490955e15,1.350593140170832e14,0,-35.00312695434646,-21120.499631781146,-3.13075780749621e6,-1.9594466391609663e8,-6.57050375487538e9,-1.3476651743799847e11,-1.8369043800571548e12,-1.7589435314077154e13,-1.2300981206774544e14,-6.45896597792679e14,-2.5969519006174225e15,-8.1043872896729e15,-1.979717247928791e16,-3.800085757405471e16,-5.727840617892459e16,-6.7406697825393336e16,-6.119592653276693e16,-4.198322456673902e16,-2.1032687680075924e16,-7.255685440992997e15,-1.5400055927557658e15,-1.51529962067947e14,3.930803703917714e-6,78.76094777966587,38771.1275913068,5.100639029001081e6,2.949841095687273e8,9.349478097378347e9,1.8381938202018082e11,2.42419630975418e12,2.2606778024802125e13,1.547013295439825e14,7.976887641336864e14,3.1582328358075825e15,9.726354425919532e15,2.3487483127377148e16,4.463176708335417e16,6.667543951844797e16,7.784411667165024e16,7.0169853688251656e16,4.78314795584771e16,2.3823442630743476e16,8.174976337050191e15,1.7267367770533495e15,1.6914972509910362e14,1.3333333333333333,-530.6666666666666,-892251.827371045,-9.987215970701566e7,-4.424126639899304e9,-1.0578643572033942e11,-1.5747287228400437e12,-1.5845717567057562e13,-1.1362682509291195e14,-6.01771280857198e14,-2.4125671241445005e15,-7.446002113664234e15,-1.7881405459744606e16,-3.35951258854644e16,-4.9401354974251736e16,-5.657957303847233e16,-4.9900402465368104e16,-3.3212859965007824e16,-1.612718315044587e16,-5.388707887852326e15,-1.107332898446881e15,-1.054602760425601e14,0,2,12417.32487790964,2.877010547668333e6,2.1757735630149266e8,7.983815399399566e9,1.7056499979904105e11,2.354551408251009e12,2.244295896408418e13,1.5448897973201038e14,7.924454954576368e14,3.09644241377513e15,9.357141993333924e15,2.2077909573687176e16,4.086271515883938e16,5.931957879239599e16,6.7183171140618856e16,5.867380519673225e16,3.8715022071894504e16,1.8654226260365056e16,6.190090662038646e15,1.2640981736452812e15,1.1971166469696011e14,0,0,-54.92679754062404,-40215.75896837982,-6.263591942903851e6,-3.919620881744125e8,-1.2847160247073557e10,-2.5452055340858438e11,-3.3284003694315527e12,-3.045760371601915e13,-2.0308431931952872e14,-1.0153938929148701e15,-3.8851031201166525e15,-1.1535964059895936e16,-2.6816071946032308e16,-4.9000640659284456e16,-7.0346216741010216e16,-7.889814086638738e16,-6.831336974290147e16,-4.473081072704507e16,-2.1405078738350924e16,-7.0590142722074e15,-1.4334704464994968e15,-1.350593140170832e14,0,0.006253908692933083,179.75473573239677,87672.02030488498,1.127655502867755e7,6.299257811345832e8,1.9142375540966686e10,3.592377142778432e11,4.510116251939719e12,3.997869384169198e13,2.598472460491622e14,1.2722572790529712e15,4.783417939546741e15,1.3993927307709768e16,3.2117401194767464e16,5.8041145938566104e16,8.251977130024504e16,9.176083681396456e16,7.884587952758733e16,5.127529010535035e16,2.4385985285874588e16,7.99727636948314e15,1.6157705737897392e15,1.51529962067947e14,-7.861607407835427e-6,-0.021902438238229502,-393.52434085950074,-157932.76854200763,-1.8113190266049244e7,-9.376913624338514e8,-2.698711715217962e10,-4.86188476940676e11,-5.912673590075985e12,-5.109028982891983e13,-3.251901708214681e14,-1.5646005583864498e15,-5.796048104691107e15,-1.6742037879323554e16,-3.800261305735843e16,-6.801536029880263e16,-9.587749223709138e16,-1.0580649570083427e17,-9.029733700258528e16,-5.8363106600548536e16,-2.7603025440299108e16,-9.006629152120784e15,-1.8113116396029015e15,-1.6914972509910362e14
+ };
 
-static const double ImEI[21][2][5][27] =
+static const int ImEIOffset[21][2][5] =
  {
-  {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.03333333333333333,-0.06666666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.3,-0.26666666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.5,2.1333333333333333,1.6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-1.8333333333333333,-6.133333333333334,-4.266666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-0.03333333333333333,4.2,12.8,8.533333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.06666666666666667,0.06666666666666667,0.06666666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.1,0.43333333333333335,0.26666666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-1.2666666666666666,-2.933333333333333,-1.6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.16666666666666666,4.1,8.266666666666667,4.266666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.06666666666666667,-0.4666666666666667,-9,-17.066666666666666,-8.533333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.06666666666666667,1.0666666666666667,1.0666666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-2.6,-9.066666666666666,-6.4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,1,11.6,27.733333333333334,17.066666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-3.533333333333333,-29.066666666666666,-59.733333333333334,-34.13333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.009523809523809525,8,56.68571428571428,107.27619047619048,58.51428571428571,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.13333333333333333,-0.26666666666666666,-1.6,-1.0666666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.2,5.933333333333334,12.266666666666667,6.4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-3.2,-22.266666666666666,-36.266666666666666,-17.066666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.06666666666666667,10.066666666666666,52.53333333333333,76.8,34.13333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.01904761904761905,-0.26666666666666666,-21.714285714285715,-99.35238095238095,-136.53333333333333,-58.51428571428571,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.1,12.6,38.4,25.6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-8.9,-64.26666666666667,-123.73333333333333,-68.26666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,1.5,35.2,170.13333333333333,273.06666666666666,136.53333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-5.271428571428571,-84,-341.9428571428571,-497.37142857142857,-234.05714285714285,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.0015873015873015873,11.88888888888889,159.4920634920635,589.6126984126984,806.1968253968254,364.0888888888889,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.2,-1.4,-27,-51.2,-25.6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.3,24.233333333333334,113.33333333333333,157.86666666666667,68.26666666666667,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-5.4,-81.86666666666666,-281.06666666666666,-341.3333333333333,-136.53333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.04285714285714286,17.1,183.65714285714284,546.7428571428571,614.4,234.05714285714285,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.0031746031746031746,-0.15555555555555556,-36.93015873015873,-337.26984126984127,-924.4444444444445,-988.2412698412699,-364.0888888888889,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.13333333333333333,59.733333333333334,332.8,546.1333333333333,273.06666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-21.2,-260.26666666666665,-921.6,-1228.8,-546.1333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,2,79.88571428571429,648.5333333333333,1896.8380952380953,2262.552380952381,936.2285714285714,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-7.015873015873016,-186.48888888888888,-1262.120634920635,-3319.0603174603175,-3692.9015873015874,-1456.3555555555556,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.0005772005772005772,15.806060606060607,349.617316017316,2133.1116883116883,5241.461471861472,5560.630303030303,2118.3353535353535,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.26666666666666666,-3.7333333333333334,-149.33333333333334,-554.6666666666666,-682.6666666666666,-273.06666666666666,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.4,64.13333333333334,541.8666666666667,1433.6,1501.8666666666666,546.1333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-7.771428571428571,-209.86666666666667,-1260.4952380952382,-2852.5714285714284,-2730.6666666666665,-936.2285714285714,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.031746031746031744,24.755555555555556,462.5015873015873,2365.765079365079,4892.444444444444,4421.079365079365,1456.3555555555556,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.0011544011544011544,-0.11313131313131314,-53.58268398268398,-839.8961038961039,-3909.818181818182,-7624.588744588745,-6619.79797979798,-2118.3353535353535,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.16666666666666666,191.66666666666666,1668.2666666666667,4753.066666666667,5461.333333333333,2184.5333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-41.5,-775.8095238095239,-4313.6,-9976.685714285713,-10142.47619047619,-3744.9142857142856,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,2.5,152.63492063492063,1872.888888888889,8569.092063492064,17664.812698412698,16644.06349206349,5825.422222222222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-8.762626262626263,-352.2020202020202,-3580.7676767676767,-14673.19595959596,-28117.59191919192,-25155.23232323232,-8473.341414141414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.0002775002775002775,19.731934731934732,655.7495837495837,5983.52047952048,22836.666267066266,41605.430303030305,35848.75213675214,11732.318881118881,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.3333333333333333,-7.666666666666667,-528.2,-3225.6,-7074.133333333333,-6553.6,-2184.5333333333333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.5,135.11904761904762,1809.8666666666666,7751.314285714286,14345.752380952381,12014.933333333332,3744.9142857142856,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-10.26984126984127,-436.8888888888889,-4089.930158730159,-14826.869841269841,-24894.577777777777,-19556.774603174603,-5825.422222222222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.025252525252525252,32.86363636363637,955.6767676767677,7544.371717171717,24809.761616161617,39106.45656565657,29391.90303030303,8473.341414141414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.000555000555000555,-0.08935508935508936,-71.26440226440226,-1727.040959040959,-12325.773426573427,-38017.645288045285,-57329.99658119658,-41714.91157731158,-11732.318881118881,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.2,489.6,6106.971428571429,26214.4,50556.34285714286,44938.97142857143,14979.657142857142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-71.8,-1901.8920634920635,-15197.155555555555,-53000.93968253968,-90398.06984126984,-74066.08253968254,-23301.68888888889,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,3,260.43463203463205,4506.052525252525,29564.416738816737,91759.85685425685,144822.26608946608,112271.77373737373,33893.36565656566,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-10.51048951048951,-596.8428904428904,-8522.413053613054,-49961.41351981352,-143888.94731934732,-215275.8303030303,-160341.69137529138,-46929.275524475524,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.0001554001554001554,23.661849261849262,1106.6579642579643,14141.066045066045,77056.03978243978,210652.15602175603,303084.9044289044,219003.28578088578,62572.367365967366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.4,-13.6,-1447.5428571428572,-13136,-44470.857142857145,-70217.14285714286,-52428.8,-14979.657142857142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.6,247.18412698412698,4825.422222222222,30428.749206349206,86497.11746031746,123062.04444444444,85716.92698412699,23301.68888888889,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-12.86926406926407,-795.3656565656565,-10742.07215007215,-56978.655122655124,-146297.53535353535,-194603.1468975469,-129218.45656565657,-33893.36565656566,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.02097902097902098,41.329137529137526,1733.909557109557,19631.14219114219,94030.1724941725,225862.41491841493,286647.4368298368,183806.32913752913,46929.275524475524,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.0003108003108003108,-0.07397047397047397,-89.75540015540015,-3126.114063714064,-31870.1898989899,-142693.88282828283,-326997.6515928516,-400854.2284382284,-250289.46946386946,-62572.367365967366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.23333333333333334,1074.7333333333333,18153.244444444445,108464.35555555555,307655.1111111111,449285.68888888886,326223.64444444445,93206.75555555556,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-114.1,-4069.7131313131313,-44104.92121212121,-214282.8606060606,-537693.0909090909,-723676.3151515152,-495690.4727272727,-135573.46262626263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,3.5,410.27630147630146,9526.587723387724,84649.39362859362,365700.5550893551,848556.257964258,1.0798214464646464e6,709153.4968142968,187717.1020979021,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-12.25897435897436,-936.1311577311577,-17890.690287490288,-141813.89526029525,-567884.4618492619,-1.2480050523698523e6,-1.524549659052059e6,-969871.6941724942,-250289.46946386946,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.0000959824489236254,27.593994241053064,1731.1486631016044,29547.359934183463,217402.40296174414,825519.0614561909,1.7431695357191828e6,2.0641979866721514e6,1.280893167256273e6,323904.019306184,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.4666666666666667,-21.933333333333334,-3355.6222222222223,-42348.08888888889,-203582.57777777777,-479869.15555555554,-594921.2444444444,-372827.02222222224,-93206.75555555556,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.7,410.7262626262626,11022.440404040404,96074.47272727273,386563.103030303,819299.296969697,946101.5272727272,563477.2040404041,135573.46262626263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-15.552602952602953,-1319.1589743589743,-24329.85236985237,-177655.00916860916,-643821.182905983,-1.273099178865579e6,-1.3992012382284382e6,-803012.0478632479,-187717.1020979021,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.017948717948717947,50.09052059052059,2871.1639471639473,44222.36891996892,290731.34296814294,983393.9045843045,1.851893577000777e6,1.9625562306138305e6,1.0950164289044288e6,250289.46946386946,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.0001919648978472508,-0.06315645139174551,-108.91493212669683,-5170.4839160839165,-71524.53607568901,-438562.81431509665,-1.4125950964486494e6,-2.565467062004662e6,-2.6439125666803783e6,-1.4428451769093652e6,-323904.019306184,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.26666666666666666,2116.266666666667,46478.36998556999,367133.99595959595,1.4218853217893217e6,3.00440476998557e6,3.5321728923520925e6,2.169175402020202e6,542293.8505050505,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-170.4,-7878.639405039405,-111119.03776223776,-714162.356043956,-2.447790332334332e6,-4.76751157962038e6,-5.287365042424242e6,-3.1077609125097124e6,-750868.4083916084,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,4,609.1538683538683,18291.647552447554,211297.13166833165,1.2068968343656345e6,3.8238280972360973e6,7.039391328671329e6,7.482612264180264e6,4.254920980885781e6,1.0011578778554779e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-14.007843137254902,-1385.7954019836372,-34183.56217377394,-351855.81673751085,-1.8614895882261528e6,-5.582810520261438e6,-9.861435769605558e6,-1.0149606059509119e7,-5.624151607952831e6,-1.295616077224736e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.0000635071842502183,31.527506549178376,2558.0482279330577,56272.57883911754,537113.6969927904,2.6926125869276235e6,7.7549386769432835e6,1.3272122169070559e7,1.3318034401472213e7,7.228173904516948e6,1.6365676764944035e6,0,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.5333333333333333,-33.06666666666667,-6906.606637806638,-115649.93939393939,-746992.1893217893,-2.4357735803751806e6,-4.414610876767676e6,-4.515080496392496e6,-2.440322327272727e6,-542293.8505050505,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.8,636.47881007881,22496.094483294484,259039.60572760573,1.3972491252747253e6,4.090821281118881e6,6.898882843023643e6,6.700457672105672e6,3.483195116705517e6,750868.4083916084,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-18.30773670773671,-2043.3143745143745,-49402.28837828838,-475220.8388944389,-2.3042702023310023e6,-6.28517082917083e6,-1.0076758327894328e7,-9.422355652525252e6,-4.75549991981352e6,-1.0011578778554779e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.01568627450980392,59.10452945747063,4444.078065725124,89495.53131313132,773530.6577448695,3.495176651510581e6,9.067520102966314e6,1.400317438010878e7,1.2718753849005897e7,6.2719596465652e6,1.295616077224736e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.0001270143685004366,-0.05512423592918949,-128.64458637337896,-7998.43481348373,-144411.5393015653,-1.162342659386434e6,-4.9947002896331735e6,-1.2482808925253488e7,-1.8729284982381087e7,-1.6625264914387986e7,-8.04645774276415e6,-1.6365676764944035e6,0,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.3,3839.4,106318.05314685314,1.0702797874125873e6,5.392764956643357e6,1.5350685180419581e7,2.580816845874126e7,2.539460421818182e7,1.3515631351048952e7,3.0034736335664336e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-242.7,-14124.181152181152,-251299.74452214452,-2.0592303781551782e6,-9.185474911222111e6,-2.4106659233033635e7,-3.8236604926806524e7,-3.601039741911422e7,-1.852142074032634e7,-4.0046315114219114e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,4.5,864.0628077804548,32599.88898944193,474679.1184031655,3.455516380591957e6,1.4245058289412549e7,3.533020329192376e7,5.370181410996846e7,4.892054909771013e7,2.449892218752228e7,5.182464308898944e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-15.756965944272446,-1961.5696724328304,-60708.62697178982,-786988.0535711966,-5.303549502574206e6,-2.0688066335863516e7,-4.921807658793219e7,-7.241782910112797e7,-6.427015135233064e7,-3.1503927772517268e7,-6.546270705977614e6,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.00004422821760283061,35.461919504643966,3616.1956285200868,99702.79558212686,1.1976321362253844e6,7.643730469367165e6,2.8621924200018764e7,6.595342171821161e7,9.458539786739412e7,8.219612447821817e7,3.9589351412340805e7,8.104906588353236e6,0,0,0,0,0,0,0,0,0,0,0,0}},{{0.6,-47.4,-13003.506293706294,-278936.1678321678,-2.3265602237762236e6,-9.980674506293707e6,-2.4597585633566435e7,-3.625286534265734e7,-3.158926858741259e7,-1.5017368167832168e7,-3.0034736335664336e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0.9,935.4623043623044,42143.00606060606,619613.8922410923,4.308818503096903e6,1.6579424074592074e7,3.799234747545788e7,5.314447145174825e7,4.452023938088578e7,2.0523736496037297e7,4.0046315114219114e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-21.12561556090968,-3003.887892499657,-92251.03664962489,-1.130768793872794e6,-7.0588418527355e6,-2.5277949085518405e7,-5.502439582942548e7,-7.405439677762237e7,-6.019829813355272e7,-2.7090154341971755e7,-5.182464308898944e6,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.01393188854489164,68.33903526813744,6531.570529779818,166762.43296022862,1.8339761297278572e6,1.0656330035982594e7,3.6261947787464544e7,7.597502823061767e7,9.92596311986317e7,7.879468948121847e7,3.477706312550607e7,6.546270705977614e6,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.00008845643520566122,-0.04891640866873065,-148.871487026905,-11752.440015711842,-268684.86844919785,-2.74861261174986e6,-1.5174070609897017e7,-4.97030496228197e7,-1.0110656940201923e8,-1.2902029170934741e8,-1.0047113019907235e8,-4.364180470651743e7,-8.104906588353236e6,0,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.3333333333333333,6533.333333333333,222654.46091686093,2.778624556954157e6,1.7600566104118105e7,6.443886523574203e7,1.4451080095726496e8,2.0156645274156955e8,1.7053055852804974e8,8.009263022843823e7,1.6018526045687646e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-333,-23825.97413044472,-521880.007239819,-5.303014873879062e6,-2.974522501247772e7,-1.0042604004409708e8,-2.1250665797888386e8,-2.837202903655926e8,-2.319741694631016e8,-1.0600495177293295e8,-2.0729857235595778e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,5,1181.999610984131,54754.40911616763,980895.6130251585,8.852088141103067e6,4.5880486491885826e7,1.4637328059863028e8,2.967933223074854e8,3.832574936190464e8,3.0507729190651166e8,1.3638063970786697e8,2.6185082823910456e7,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-17.506265664160402,-2679.1916209005994,-101698.47428388605,-1.6209314727333898e6,-1.3536137961823797e7,-6.6368244028934255e7,-2.0306241420633388e8,-3.984997390155933e8,-5.012577425662849e8,-3.9049673738068247e8,-1.7144994706131846e8,-3.2419626353412945e7,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.000032049433045529426,39.39695786781532,4934.437997592661,166727.4017375813,2.460969788432378e6,1.945561056293358e7,9.154241300341979e7,2.712219032798776e8,5.1868580194167066e8,6.387408437835916e8,4.888559794904897e8,2.114323457831279e8,3.946737121285054e7,0,0,0,0,0,0,0,0,0,0,0}},{{0.6666666666666666,-65.33333333333333,-22842.255167055166,-610794.4205128205,-6.384583827195027e6,-3.4760849444599845e7,-1.1109825668873349e8,-2.199600400907537e8,-2.733161006545454e8,-2.075734000087024e8,-8.810189325128205e7,-1.6018526045687646e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,1,1318.9482608894373,73805.46920791626,1.3491923253530783e6,1.1743463056410257e7,5.730339427900727e7,1.7019760844996572e8,3.196860685490927e8,3.8177487075555557e8,2.810897971178939e8,1.1636988039073084e8,2.0729857235595778e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-23.999221968262216,-4237.817551557489,-161226.06704008067,-2.4533664806920635e6,-1.9149318022051428e7,-8.689604748579635e7,-2.450198244808148e8,-4.4258655082519025e8,-5.1267962114181876e8,-3.683579087309619e8,-1.4947318111982217e8,-2.6185082823910456e7,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.012531328320802004,77.76920671347916,9214.54894194213,291039.0946701733,3.9691610755076366e6,2.8811933867454045e7,1.2415265791155085e8,3.367590805724054e8,5.902267861563345e8,6.673985861532614e8,4.701430309700768e8,1.8765976023802492e8,3.2419626353412945e7,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.00006409886609105885,-0.04397182213846637,-169.53941844936594,-16578.624554339185,-468446.0812958478,-5.9377916416310035e6,-4.0923115567559e7,-1.696412196057358e8,-4.465302941617743e8,-7.640784094103152e8,-8.472253347457047e8,-5.871720202796443e8,-2.3116603138955316e8,-3.946737121285054e7,0,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.36666666666666664,10559.266666666666,434294.7652086476,6.574489355455003e6,5.10204267471091e7,2.3250794534097537e8,6.64917593632177e8,1.2277649331804926e9,1.4624266471674209e9,1.0850784646757164e9,4.560568591831071e8,8.291942894238311e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-443.3,-38255.76555264481,-1.0114779064221641e6,-1.2470381821703581e7,-8.571332767814559e7,-3.6026736682270384e8,-9.722698334254823e8,-1.7186034725420127e9,-1.9784568926620624e9,-1.4283144396604905e9,-5.869822733026594e8,-1.0474033129564182e8,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,5.5,1569.961476844449,87625.69572649573,1.8939060047826958e6,2.0732385792547733e7,1.3166046654165429e8,5.228893340210738e8,1.352134487330338e9,2.311593394202756e9,2.5906866318906407e9,1.8295657646295648e9,7.381699538930948e8,1.2967850541365178e8,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-19.255693581780537,-3554.4014008396293,-162426.07358635293,-3.1217844988459083e6,-3.16126055748029e7,-1.8987086397373933e8,-7.230764038384147e8,-1.809469262049569e9,-3.0129885415469217e9,-3.304452922123214e9,-2.2917775413786182e9,-9.105686358393375e8,-1.5786948485140216e8,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.00002397297591805601,43.33244851258581,6541.62812737135,265926.5903814425,4.731094982759278e6,4.5340842546994835e7,2.612763288477679e8,9.633487135585018e8,2.348932232111619e9,3.828700312931434e9,4.124825501869743e9,2.8177588722517457e9,1.105086393959815e9,1.894433818216826e8,0,0,0,0,0,0,0,0,0,0}},{{0.7333333333333333,-87.26666666666667,-37956.79708396179,-1.2378745500251383e6,-1.5839376732026143e7,-1.06514876608547e8,-4.268125048599296e8,-1.084457648638713e9,-1.7937872069180493e9,-1.927228914871795e9,-1.297559501340573e9,-4.9751657365429866e8,-8.291942894238311e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,1.1,1798.4311052896192,122419.20256145643,2.723675026625387e6,2.8991573532491863e7,1.7462463657162815e8,6.49987059367659e8,1.5663069635696964e9,2.4893757054309864e9,2.5923743423070254e9,1.7021667641938875e9,6.393524389504802e8,1.0474033129564182e8,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-26.922953688897962,-5782.824037469239,-267059.29319830495,-4.940120546192026e6,-4.71164384933979e7,-2.6376188135589048e8,-9.316258847784076e8,-2.1581550271623797e9,-3.3260680887754226e9,-3.3792200077329974e9,-2.1743360218110523e9,-8.030092065999206e8,-1.2967850541365178e8,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.011387163561076604,87.37526544737474,12575.685027901907,481630.25459747476,7.978130346470807e6,7.071870426544951e7,3.7573583030587316e8,1.2761080113371363e9,2.867315117761134e9,4.312316120466565e9,4.2944103377974663e9,2.717461330888649e9,9.895033782650386e8,1.5786948485140216e8,0,0,0,0,0,0,0,0,0,0,0},{0,0,-0.00004794595183611202,-0.039938977879481315,-190.60366239225843,-22626.351358782555,-774685.3323404123,-1.1919507515836926e7,-1.0026023448105781e8,-5.122220252548393e8,-1.6875254790953407e9,-3.7006690484617324e9,-5.456117441460743e9,-5.344261556173933e9,-3.3347814351400876e9,-1.1998080848706565e9,-1.894433818216826e8,0,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.4,16358.4,798958.1317110135,1.4416265779644504e7,1.3432181467691442e8,7.434303361587911e8,2.626393853597904e9,6.143042747321345e9,9.628736625974842e9,1.0003891869771244e10,6.609352950962489e9,2.5137679510954037e9,4.189613251825673e8,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-575.6,-58965.4028822227,-1.851578588510492e6,-2.721337278865888e7,-2.246109735140044e8,-1.1467505597679276e9,-3.823590344956376e9,-8.562024604039784e9,-1.2971313192672047e10,-1.3113370455110611e10,-8.471497747887982e9,-3.1621604781636624e9,-5.187140216546071e8,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,6,2034.9461170318891,134714.58794018233,3.456620690885645e6,4.5099821439376034e7,3.4389086889063436e8,1.6588888433384745e9,5.299781267706849e9,1.1477806342984741e10,1.6928250138062456e10,1.6740562578044119e10,1.0617264990476751e10,3.9016315541846533e9,6.314779394056087e8,0,0,0,0,0,0,0,0,0,0,0},{0,0,0,-21.00521739130435,-4602.940974829003,-249320.1853983052,-5.686343886484196e6,-6.861345311881912e7,-4.947368541065237e8,-2.288195708861567e9,-7.073833639317552e9,-1.4920448268974035e10,-2.1533210358591484e10,-2.091140714317489e10,-1.3059753134332243e10,-4.736084545542065e9,-7.577735272867304e8,0,0,0,0,0,0,0,0,0,0},{0,0,0,0.00001840349666436623,47.2682769726248,8466.622898449223,407758.88048708765,8.605464337728756e6,9.82448816901423e7,6.795288568188525e8,3.042463166214668e9,9.163485366790909e9,1.8918381774570183e10,2.681818912368284e10,2.565065895730421e10,1.5811505960561546e10,5.669268611552575e9,8.981019582657546e8,0,0,0,0,0,0,0,0,0}},{{0.8,-113.6,-60265.06342202689,-2.354631489783282e6,-3.6188869743358806e7,-2.9423519790246165e8,-1.4410252993176384e9,-4.548903494657308e9,-9.579486167460339e9,-1.3604387251458832e10,-1.2876514478657967e10,-7.78768167803846e9,-2.7232486136866875e9,-4.189613251825673e8,0,0,0,0,0,0,0,0,0,0,0,0,0},{0,1.2,2385.605764445393,194164.23206487356,5.166394900690916e6,6.6000166193341576e7,4.804116328378407e8,2.1848240357089143e9,6.539431397703931e9,1.3229596648755936e10,1.8207931242597847e10,1.6804843678929035e10,9.955319107909575e9,3.4215174889909663e9,5.187140216546071e8,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-29.892234063778012,-7677.3315851704865,-423195.2594681369,-9.353395630081888e6,-1.069960803506276e8,-7.235025322877827e8,-3.121175266299493e9,-8.978155548848114e9,-1.7608717027453564e10,-2.363934658860129e10,-2.1376840213692146e10,-1.2449678653930527e10,-4.217370523887458e9,-6.314779394056087e8,0,0,0,0,0,0,0,0,0,0,0},{0,0,0.010434782608695653,97.14108009278826,16699.23576343072,762726.8199599064,1.5085840946795626e7,1.603035047267927e8,1.0283599406244267e9,4.2643450431212244e9,1.1894505365747297e10,2.2759909848626797e10,2.9943147410467827e10,2.6624309126235004e10,1.5285712870737015e10,5.114971309185431e9,7.577735272867304e8,0,0,0,0,0,0,0,0,0,0},{0,0,-0.00003680699332873246,-0.03658615136876006,-212.02777987521023,-30047.89230250005,-1.2262431435256745e6,-2.251696238611375e7,-2.2695429228591478e8,-1.3994804759815316e9,-5.627673799689461e9,-1.5316193575786037e10,-2.8723952643539726e10,-3.7161678742566864e10,-3.257762113150629e10,-1.8477746149163006e10,-6.118319590685452e9,-8.981019582657546e8,0,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.43333333333333335,24459.933333333334,1.39948310974227e6,2.9664356557875972e7,3.264766937613553e8,2.1527966210326242e9,9.174872352635342e9,2.63526819412877e10,5.20431450209414e10,7.080795804555496e10,6.521613086318431e10,3.8830607464800354e10,1.3486564563019785e10,2.0748560866184285e9,0,0,0,0,0,0,0,0,0,0,0,0},{0,0,-731.9,-87814.82467992813,-3.230537622359549e6,-5.578284651915676e7,-5.439079051073674e8,-3.308797228275689e9,-1.3310466229841167e10,-3.660457080636495e10,-6.987539486462099e10,-9.251142702281056e10,-8.331826353464978e10,-4.868864058693869e10,-1.6643954260047829e10,-2.5259117576224346e9,0,0,0,0,0,0,0,0,0,0,0},{0,0,6.5,2583.9516267845465,200215.24405318496,6.016616118581815e6,9.221263263214113e7,8.305750837148908e8,4.77383576908197e9,1.840021088352963e10,4.8939353849036934e10,9.094760672013042e10,1.177844008258246e11,1.0414198859975996e11,5.991259714028463e10,2.0207294060979477e10,3.0310941091469216e9,0,0,0,0,0,0,0,0,0,0},{0,0,0,-22.754814814814814,-5840.553656708876,-370080.7888040544,-9.881938796070835e6,-1.4003615801375034e8,-1.1925823709998772e9,-6.57143044116013e9,-2.4508050681444206e10,-6.348184946356478e10,-1.1543549489334048e11,-1.468037932397025e11,-1.27811573462042e11,-7.256032344847891e10,-2.4192621500783764e10,-3.5924078330630183e9,0,0,0,0,0,0,0,0,0},{0,0,0,0.00001443722583152868,51.20436448442445,10738.282242670764,604748.6713855794,1.493782547301189e7,2.0024139920202476e8,1.6355739069693673e9,8.723538381973366e9,3.1694134443060642e10,8.035017116564796e10,1.435061488294865e11,1.797385196878227e11,1.544460759994406e11,8.668740434615086e10,2.861538653232956e10,4.211788493935952e9,0,0,0,0,0,0,0,0}},{{0.8666666666666667,-144.73333333333332,-92115.75281787357,-4.24804535780092e6,-7.720394235745513e7,-7.459561839697425e8,-4.37688462512671e9,-1.675264548351156e10,-4.352291071881835e10,-7.819993218306961e10,-9.728719442636674e10,-8.229722149813876e10,-4.518485423006929e10,-1.4523992606328999e10,-2.0748560866184285e9,0,0,0,0,0,0,0,0,0,0,0,0},{0,1.3,3092.3493598562786,296618.58790897264,9.301895812628992e6,1.4042234137451884e8,1.2141829505065637e9,6.6136711412013e9,2.3997256897036137e10,5.988243978747334e10,1.0425835625270293e11,1.2646490694806935e11,1.0477864663163727e11,5.65370092624084e10,1.7906910138859047e10,2.5259117576224346e9,0,0,0,0,0,0,0,0,0,0,0},{0,0,-32.90325356909285,-9960.403453242889,-646128.1687916917,-1.6817577993811376e7,-2.272190859950398e8,-1.8244572021268456e9,-9.424164410318285e9,-3.2855536243018745e10,-7.94693874291209e10,-1.3493911256397678e11,-1.6035193404744455e11,-1.3059358460620116e11,-6.944791402530933e10,-2.1722841115552937e10,-3.0310941091469216e9,0,0,0,0,0,0,0,0,0,0},{0,0,0.00962962962962963,107.05323934367682,21670.89761846037,1.1640149545323383e6,2.7098524121223144e7,3.3995615473259085e8,2.5888012200866394e9,1.2850503978831438e10,4.34323908124913e10,1.0247227787993118e11,1.704876950572971e11,1.9917787189184882e11,1.5989240688923416e11,8.398305773017148e10,2.5988825417315273e10,3.5924078330630183e9,0,0,0,0,0,0,0,0,0},{0,0,-0.00002887445166305736,-0.033754233994114057,-233.78149683578326,-38998.16031069183,-1.8707910950575937e6,-4.041802774693853e7,-4.8079742512005436e8,-3.518362643932259e9,-1.6932117246290905e10,-5.582666431497299e10,-1.2906973332811464e11,-2.1113776786988696e11,-2.4316208621413403e11,-1.9281924836901074e11,-1.0020538726970265e11,-3.0721280779297535e10,-4.211788493935952e9,0,0,0,0,0,0,0,0}}},
-  {{{0,-0.4666666666666667,35489.066666666666,2.3512673864932396e6,5.783459782554564e7,7.417629589224231e8,5.737794526335927e9,2.8958539764775536e10,9.980418605461873e10,2.4087583664136777e11,4.1111360367982263e11,4.938686168666484e11,4.0842050111710443e11,2.2130873014861176e11,7.072552921342816e10,1.0103647030489738e10,0,0,0,0,0,0,0,0,0,0,0},{0,0,-914.2,-127000.05298477177,-5.410357632421346e6,-1.084187847239819e8,-1.2320553672292948e9,-8.793144231643013e9,-4.189268519105384e10,-1.3824796054280862e11,-3.2253689193271765e11,-5.3569991047103217e11,-6.2930263262471e11,-5.107830750947536e11,-2.7241958305957956e11,-8.588099975916278e10,-1.2124376436587687e10,0,0,0,0,0,0,0,0,0,0},{0,0,7,3223.9763957964633,289078.1147930231,1.0056934701494202e7,1.7885319900918955e8,1.8774039305941489e9,1.2659112178824976e10,5.778636226399293e10,1.8443310408086594e11,4.188943611564575e11,6.80570218646967e11,7.848818851678533e11,6.271698565745526e11,3.30024403976469e11,1.028326742214289e11,1.4369631332252073e10,0,0,0,0,0,0,0,0,0},{0,0,0,-24.504469987228607,-7282.983796526446,-533794.5211804865,-1.6496528391199792e7,-2.7121016480072916e8,-2.69139348470133e9,-1.7396960801336163e10,-7.683642125146432e10,-2.388197884303981e11,-5.3073846409068134e11,-8.467207746541761e11,-9.615174725410426e11,-7.581688663491782e11,-3.943770868588842e11,-1.2164636179544427e11,-1.6847153975743809e10,0,0,0,0,0,0,0,0},{0,0,0,0.000011535450912536563,55.140655048819674,13385.468430331828,871673.8196526119,2.4913415664470177e7,3.873820740702931e8,3.686591045638684e9,2.3063912016993534e10,9.92281083489501e10,3.018436477318775e11,6.588209340059844e11,1.0351031513181844e12,1.160082623098246e12,9.043453403023804e11,4.6572230892101843e11,1.4238562392402832e11,1.9564436875057327e10,0,0,0,0,0,0,0}},{{0.9333333333333333,-181.06666666666666,-136335.83965314535,-7.327933577454448e6,-1.5542659822206742e8,-1.7593665355350988e9,-1.2169475752962036e10,-5.541107203717101e10,-1.734553628583209e11,-3.823252362645737e11,-5.987312993848872e11,-6.626663891105165e11,-5.067610463730009e11,-2.5477706093710904e11,-7.577735272867303e10,-1.0103647030489738e10,0,0,0,0,0,0,0,0,0,0,0},{0,1.4,3930.705969543536,438914.5575660432,1.6021909399733834e7,2.821148285309416e8,2.8568306121554456e9,1.834034705520107e10,7.915174003764148e10,2.3795742789826575e11,5.0818633097929156e11,7.758814204731168e11,8.410097103451432e11,6.320268394606305e11,3.130867623573008e11,9.194318797745662e10,1.2124376436587687e10,0,0,0,0,0,0,0,0,0,0},{0,0,-35.952791592926204,-12671.688278689997,-955744.668589088,-2.8937820175670214e7,-4.558361881243446e8,-4.2852364908962717e9,-2.6082358434683636e10,-1.0813493285251514e11,-3.150596210807534e11,-6.56127990059077e11,-9.812778081103854e11,-1.045448978125867e12,-7.742480850836678e11,-3.7874643521238617e11,-1.1001748988755493e11,-1.4369631332252073e10,0,0,0,0,0,0,0,0,0},{0,0,0.008939974457215836,117.10041553054182,27577.685460833156,1.7212957303475374e6,4.6594371675881036e7,6.812809157261431e8,6.07243220002907e9,3.551011349027069e10,1.4269874524439893e11,4.054913031711275e11,8.273111760165848e11,1.2162825061370105e12,1.2771474457642676e12,9.341281376272004e11,4.520414263861544e11,1.3006993878331618e11,1.6847153975743809e10,0,0,0,0,0,0,0,0},{0,0,-0.000023070901825073126,-0.031330284678449304,-255.83925591764077,-49634.48688799174,-2.765829691982738e6,-6.945891513716699e7,-9.627476140344408e8,-8.244250951607839e9,-4.673088800021546e10,-1.8316187642444714e11,-5.0994384612902716e11,-1.022841420534557e12,-1.4821974712563923e12,-1.5372206353757112e12,-1.112343356234171e12,-5.3324678896895935e11,-1.5216784236155698e11,-1.9564436875057327e10,0,0,0,0,0,0,0}}},
-  {{{0,-0.5,50175,3.8110518751832955e6,1.076462696229007e8,1.5907243629794188e9,1.4251013900556408e10,8.39147841034878e10,3.408264309321651e11,9.827003704330287e11,2.041566817044961e12,3.065320744754241e12,3.2952209252682485e12,2.4722631961132183e12,1.2290545345785562e12,3.6373129309763055e11,4.8497505746350746e10,0,0,0,0,0,0,0,0,0,0},{0,0,-1124.5,-179081.18687280125,-8.746490101655236e6,-2.0128246173478386e8,-2.6356156253879805e9,-2.1787106957386932e10,-1.2111135286756642e11,-4.7103679933522406e11,-1.312930805324278e12,-2.654465838545084e12,-3.897567876302638e12,-4.1124050502739814e12,-3.036874638157322e12,-1.489333703666579e12,-4.355794497588909e11,-5.747852532900829e10,0,0,0,0,0,0,0,0,0},{0,0,7.5,3962.019044757294,407072.920718967,1.6232431369128535e7,3.3147987895103717e8,4.0090734366763234e9,3.13099625273733e10,1.6676035684980087e11,6.272725393185522e11,1.702120269314377e12,3.366309892830835e12,4.852504880352651e12,5.040497006172991e12,3.6725169792886714e12,1.7801426017692478e12,5.153247098462812e11,6.7388615902975235e10,0,0,0,0,0,0,0,0},{0,0,0,-26.25417130144605,-8945.976556539295,-751050.1272782461,-2.6597813264939196e7,-5.0203783424558866e8,-5.739732894683955e9,-4.2968855344066925e10,-2.214204398894586e11,-8.110701607930319e11,-2.1534160242155322e12,-4.1819214920925874e12,-5.935635976892781e12,-6.084107901642862e12,-4.381942913426506e12,-2.1025895514418992e12,-6.03236803647601e11,-7.825774750022931e10,0,0,0,0,0,0,0},{0,0,0,9.363190675760198e-6,59.07710774785302,16437.045563842872,1.2257532331766458e6,4.013768184797409e7,7.164271778242302e8,7.854094148649289e9,5.6903267984881676e10,2.856175070922272e11,1.0238847552212717e12,2.6698130647352876e12,5.105908405067799e12,7.152238271875518e12,7.247671528966757e12,5.167805995087918e12,2.457745328571359e12,6.99576833714171e11,9.011498196996101e10,0,0,0,0,0,0}},{{1,-223,-196278.75036659127,-1.2163480027372148e7,-2.9773689168561506e8,-3.901236201224221e9,-3.1389389329419144e10,-1.6743088681163474e11,-6.199947751483894e11,-1.6382802519391409e12,-3.132920728260574e12,-4.3465612386153613e12,-4.3323760798965054e12,-3.0231374871104106e12,-1.4018268987999307e12,-3.8798004597080597e11,-4.8497505746350746e10,0,0,0,0,0,0,0,0,0,0},{0,1.5,4912.873745602497,631897.2803378738,2.656490166119503e7,5.395585963900452e8,6.322823026301706e9,4.720796893278593e10,2.3863565691698135e11,8.485721474191187e11,2.172352790028894e12,4.049809894234472e12,5.50235200650019e12,5.38931258216232e12,3.7052589549104136e12,1.6963462050468354e12,4.643187124233951e11,5.747852532900829e10,0,0,0,0,0,0,0,0,0},{0,0,-39.038089514588414,-15851.374766259272,-1.3756719102298168e6,-4.7943245278919205e7,-8.708307769571735e8,-9.47113944257027e9,-6.703028125916526e10,-3.254547834230943e11,-1.1214448357099817e12,-2.7992820802386875e12,-5.111448386239666e12,-6.825434396193574e12,-6.587638039199097e12,-4.472282579818021e12,-2.0251695912105806e12,-5.4901901779776886e11,-6.7388615902975235e10,0,0,0,0,0,0,0,0},{0,0,0.008342602892102336,127.27291285612064,34507.8303268765,2.4771144537147037e6,7.715353799846987e7,1.3004413372683635e9,1.3407053636109262e10,9.11467268081413e10,4.288886516771684e11,1.4411578341601123e12,3.5239100414919814e12,6.3247528225204e12,8.32319236966487e12,7.933155759027074e12,5.327467452291677e12,2.3895346256094067e12,6.423656773977156e11,7.825774750022931e10,0,0,0,0,0,0,0},{0,0,-0.000018726381351520396,-0.029231881289723337,-278.179190366686,-62116.434369362025,-3.979701958366857e6,-1.1496637205380797e8,-1.8365386839217353e9,-1.8187049742974773e10,-1.198292372617549e11,-5.49880612073813e11,-1.810124500260231e12,-4.3508491817515527e12,-7.696337232599344e12,-1.000270962164139e13,-9.431448443943848e12,-6.273956282611874e12,-2.7906371863090767e12,-7.446343246991516e11,-9.011498196996101e10,0,0,0,0,0,0}}},
-  {{{0,-0.5333333333333333,69358.93333333333,5.9871611113645565e6,1.924439018268767e8,3.2448156139755497e9,3.330669577632881e10,2.2601945627174777e11,1.0662940872799772e12,3.608672101565586e12,8.923743251707213e12,1.6254636226822168e13,2.1772292854629945e13,2.117283786317375e13,1.453488209257297e13,6.674693753831088e12,1.8393128105282654e12,2.2991410131603317e11,0,0,0,0,0,0,0,0,0},{0,0,-1364.8,-247010.3969398599,-1.3710914253764993e7,-3.5907586422209996e8,-5.365095399350815e9,-5.081736342983615e10,-3.255698706535722e11,-1.470867065526843e12,-4.812414875990048e12,-1.1581712843876643e13,-2.0631072691303906e13,-2.7124046546863812e13,-2.5963317717947027e13,-1.758285432472868e13,-7.979604930158186e12,-2.1762558900431414e12,-2.6955446361190094e11,0,0,0,0,0,0,0,0},{0,0,8,4805.078378923909,560851.6328710681,2.5412128545875855e7,5.904978119526415e8,8.148894279740852e9,7.291974445465744e10,4.476097728118765e11,1.955793734114073e12,6.229626820644424e12,1.4665713663876832e13,2.56478138439078e13,3.319636806334255e13,3.135144116117232e13,2.098522418302309e13,9.426637994127908e12,2.547724446396354e12,3.1303099000091724e11,0,0,0,0,0,0,0},{0,0,0,-28.003910068426197,-10845.277747543556,-1.0340539156313771e6,-4.160211107138518e7,-8.934162310823445e8,-1.1653781015963501e10,-9.995712648139485e10,-5.936175304669795e11,-2.525790561524574e12,-7.87163260522547e12,-1.819637446847215e13,-3.1333388101515715e13,-4.001900002443862e13,-3.736019485586116e13,-2.4754756721440023e13,-1.1020607767604893e13,-2.954822829857143e12,-3.6045992787984406e11,0,0,0,0,0,0},{0,0,0,7.704568327482677e-6,63.01369198098898,19921.879208008424,1.6868344786841804e6,6.273964748932823e7,1.273959927266718e9,1.593305010069684e10,1.3225038205179854e11,7.649853076246484e11,3.185325437278451e12,9.749212126813445e12,2.219341094639236e13,3.771515415332075e13,4.76205488262829e13,4.401174323403532e13,2.890378760514151e13,1.2766176186368576e13,3.3986221771528154e12,4.1195420329125037e11,0,0,0,0,0}},{{1.0666666666666667,-270.93333333333334,-275873.1560624472,-1.9526615598641343e7,-5.463067917939428e8,-8.201340252473525e9,-7.590059501108307e10,-4.682825773172421e11,-2.0210768151063833e12,-6.288523857290183e12,-1.4356521317251836e13,-2.4229695665058094e13,-3.016739913942077e13,-2.7348748241932996e13,-1.7548912264512844e13,-7.551241265098464e12,-1.9542698611862817e12,-2.2991410131603317e11,0,0,0,0,0,0,0,0,0},{0,1.6,6051.193879719814,888285.5021747415,4.261058156357549e7,9.887753453648256e8,1.327213854827666e10,1.1396014858065186e11,6.662406988329823e11,2.7610060006323486e12,8.322298591918423e12,1.852086668895058e13,3.0609487847613902e13,3.744833590963831e13,3.344798330425991e13,2.11898795413883e13,9.017191413252525e12,2.311033121849092e12,2.6955446361190094e11,0,0,0,0,0,0,0,0},{0,0,-42.156757847819044,-19540.15290525303,-1.9336304731780519e6,-7.685712819702701e7,-1.594439517783882e9,-1.9858807743317722e10,-1.6160641862808392e11,-9.073615412262385e11,-3.643384657047884e12,-1.0707067507058748e13,-2.333725913033687e13,-3.790443110434288e13,-4.569379747197401e13,-4.029844176053195e13,-2.5250191501700312e13,-1.0641806906700912e13,-2.7042399413968125e12,-3.1303099000091724e11,0,0,0,0,0,0,0},{0,0,0.007820136852394917,137.56233770685833,42550.691954386595,3.4813989145593178e6,1.2363151215452614e8,2.3794672470258155e9,2.8087829807876396e10,2.19531539097911e11,1.1943955071569575e12,4.67634681344435e12,1.34610069080083e13,2.883661986591e13,4.615458622396285e13,5.4943021866992516e13,4.792868725397259e13,2.9744824442882992e13,1.2430432946055994e13,3.135052793797065e12,3.6045992787984406e11,0,0,0,0,0,0},{0,0,-0.000015409136654965353,-0.027397444972528398,-300.78237626127407,-76605.63532406824,-5.592621537223804e6,-1.841644469419035e8,-3.3586851599070764e9,-3.807661046434377e10,-2.883838211797314e11,-1.5299369967994255e12,-5.867608218199371e12,-1.6601437441364713e13,-3.5048526877146164e13,-5.5398397289151914e13,-6.523376765866994e13,-5.636627223479088e13,-3.46882547466682e13,-1.4388245861827873e13,-3.604599278798441e12,-4.1195420329125037e11,0,0,0,0,0}}},
-  {{{0,-0.5666666666666667,94002.06666666667,9.151311935305258e6,3.320851910459127e8,6.33521032186008e9,7.382275924950447e10,5.713935821593523e11,3.094041226242078e12,1.2118112094805514e13,3.5055579190329652e13,7.577080308439667e13,1.2277365554920727e14,1.4836959871768953e14,1.316939805223555e14,8.331707351347927e13,3.554854783594292e13,9.164851762804633e12,1.0782178544476038e12,0,0,0,0,0,0,0,0},{0,0,-1637.1,-334159.9205226142,-2.0918744937359024e7,-6.185177808929194e8,-1.0456566421124214e10,-1.1244319702124878e11,-8.217073662582078e11,-4.261136422965968e12,-1.613507388311211e13,-4.54274671317859e13,-9.60274321618125e13,-1.5272694341908484e14,-1.8167523305110694e14,-1.5908213959048006e14,-9.946452714264984e13,-4.200158523126891e13,-1.0730006712809219e13,-1.252123960003669e12,0,0,0,0,0,0,0},{0,0,8.5,5760.15335336423,758011.4560133434,3.872804138514868e7,1.0159241892397866e9,1.586238004713476e10,1.611446504457956e11,1.1282876946995315e12,5.658785050777512e12,2.0860295618072766e13,5.745164785582471e13,1.1922862068135155e14,1.8668579152657497e14,2.1910636544081044e14,1.8963108518772156e14,1.1735697816416962e14,4.9110491347309305e13,1.2445353299430406e13,1.4418397115193762e12,0,0,0,0,0,0},{0,0,0,-29.753679653679654,-12996.633706471774,-1.396745220816542e6,-6.3353746792567894e7,-1.5357532178764133e9,-2.2663668846309917e10,-2.2067759802151013e11,-1.4948161492516946e12,-7.300452192754711e12,-2.633115093534921e13,-7.12076759521055e13,-1.4550478401170806e14,-2.2481450876051734e14,-2.608206421034274e14,-2.2345389682757944e14,-1.3705312915212823e14,-5.689609265768836e13,-1.4315408564370951e13,-1.6478168131650015e12,0,0,0,0,0},{0,0,0,6.416135448393513e-6,66.95038440199731,23868.836113681442,2.2775814000040796e6,9.549105192520149e7,2.1884705815436573e9,3.0963237347720776e10,2.91743710502673e11,1.9247605684553428e12,9.198896562512525e12,3.258322450023937e13,8.677160313048934e13,1.749810194392509e14,2.6727116291968612e14,3.0697010372751906e14,2.6065987367419022e14,1.5860983054210656e14,6.537859338635338e13,1.6344561363015016e13,1.8704947608900017e12,0,0,0,0}},{{1.1333333333333333,-325.26666666666665,-379672.3372771824,-3.044289317860951e7,-9.653190181565726e8,-1.645654568518213e10,-1.7350035488585364e11,-1.224974862145457e12,-6.087121650396307e12,-2.198279146517062e13,-5.886931627391679e13,-1.1819629684730314e14,-1.7844037358940066e14,-2.014677026353088e14,-1.674879308472654e14,-9.947402064977933e13,-3.992880786963631e13,-9.703960690028434e12,-1.0782178544476038e12,0,0,0,0,0,0,0,0},{0,1.7,7358.141045228405,1.2228343356326213e6,6.639078335866816e7,1.7454206071277142e9,2.6599212141387142e10,2.601475592017887e11,1.740271415261319e12,8.302886018750533e12,2.904578302199949e13,7.582019351190167e13,1.490656602100751e14,2.211250836544858e14,2.4596589754150544e14,2.018771799198576e14,1.185708301208829e14,4.713181534517283e13,1.1356068692811053e13,1.252123960003669e12,0,0,0,0,0,0,0},{0,0,-45.30670672845925,-23779.18039507422,-2.661791803943833e6,-1.1969660677337208e8,-2.812574307228695e9,-3.9764345032168434e10,-3.685338752285082e11,-2.367394455421027e12,-1.0942906507013615e13,-3.73202401876562e13,-9.540709750646728e13,-1.843299072761322e14,-2.694183018006003e14,-2.9589668840921594e14,-2.401899624280804e14,-1.3971389256713602e14,-5.5062823051114625e13,-1.3166273155190094e13,-1.4418397115193762e12,0,0,0,0,0,0},{0,0,0.00735930735930736,147.96135233748615,51796.68308694178,4.792105916700205e6,1.9247997245947763e8,4.195150944550882e9,5.6203346619271835e10,5.002227932450558e11,3.113437647355672e12,1.403128377992629e13,4.686853664732211e13,1.1775423667475845e14,2.241800875868455e14,3.235464771315656e14,3.5146497769033325e14,2.825652031993201e14,1.6297151920138706e14,6.37448312874054e13,1.5139316970953451e13,1.6478168131650015e12,0,0,0,0,0},{0,0,-0.000012832270896787026,-0.025780032231645135,-323.6322744648659,-93265.65360101484,-7.69771425123931e6,-2.866519541825688e8,-5.919173280043663e9,-7.614963399570706e10,-6.566791772809753e11,-3.985094039738327e12,-1.7590885222630846e13,-5.775012578906397e13,-1.429804558962491e14,-2.6879959044347166e14,-3.8372757967297875e14,-4.1286846760141056e14,-3.291372259583687e14,-1.8840988086355138e14,-7.320015630019402e13,-1.7279808743460016e13,-1.8704947608900017e12,0,0,0,0}}},
-  {{{0,-0.6,125193.6,1.3652102441336416e7,5.554014600143847e8,1.1899676153316288e10,1.56165088407177e11,1.366540496131952e12,8.40861783023701e12,3.767209777990931e13,1.2572771066140053e14,3.1699683846911475e14,6.078847468910346e14,8.864741332485448e14,9.755540111565658e14,7.962880116350478e14,4.6711589143195694e14,1.8610613034936884e14,4.507646256013208e13,5.008495840014676e12,0,0,0,0,0,0,0},{0,0,-1943.4,-444350.0575188254,-3.1158621445006426e7,-1.0328718631043336e9,-1.9611734199856762e10,-2.3751855080120044e11,-1.9624234636460256e12,-1.1564556559203219e13,-5.009287309334422e13,-1.6271440389198622e14,-4.0123038305561994e14,-7.55244323016712e14,-1.0841303144905668e15,-1.1770068866194732e15,-9.494737901060278e14,-5.512548272291732e14,-2.1763242435124375e14,-5.228566111772896e13,-5.767358846077505e12,0,0,0,0,0,0},{0,0,9,6834.2430464192685,1.0071578139815058e6,5.7630935107687674e7,1.6947655536972034e9,2.971887868603432e10,3.400242318221734e11,2.691676008673227e12,1.5341040964447729e13,6.469277318651995e13,2.0556218578916944e14,4.9764013132721725e14,9.221943510366396e14,1.306119324762518e15,1.4015595146061295e15,1.1191029056445291e15,6.438857748567351e14,2.5216204623961334e14,6.0145313680522555e13,6.591267252660006e12,0,0,0,0,0},{0,0,0,-31.503474903474903,-15415.791203007979,-1.8549118704564322e6,-9.421570811376691e7,-2.5600544123712883e9,-4.242743900283097e10,-4.6525101895250854e11,-3.5629896100471016e12,-1.977415609780622e13,-8.158625551552306e13,-2.545518754366963e14,-6.067625924438578e14,-1.1095340952535998e15,-1.553365741029738e15,-1.650033451843795e15,-1.3057251452334125e15,-7.452766846539458e14,-2.8978473074627556e14,-6.867387907839006e13,-7.481979043560007e12,0,0,0,0},{0,0,0,5.4000054000054e-6,70.88716688716688,28306.784007021753,3.0236617450400395e6,1.4194238784983155e8,3.6460856395006375e9,5.792852759286986e10,6.146661187977393e11,4.584553043233062e12,2.4898101684512574e13,1.008823224117668e14,3.099519834507942e14,7.291125023795298e14,1.3180326124569462e15,1.826761435393357e15,1.9232229378190795e15,1.5098730462049652e15,8.556875473106161e14,3.305876811925353e14,7.788932029962469e13,8.4412071260677e12,0,0,0}},{{1.2,-386.4,-512904.0826728312,-4.6250508101108156e7,-1.6498943779538748e9,-3.1693433546401592e10,-3.774969633261728e11,-3.0222573837808267e12,-1.7114252146731506e13,-7.088860314805319e13,-2.195652433185797e14,-5.154436720771549e14,-9.229759888796809e14,-1.260086991646628e15,-1.3012905395960398e15,-9.989055197138905e14,-5.52186666361618e14,-2.0770526865943212e14,-4.758071048013942e13,-5.008495840014676e12,0,0,0,0,0,0,0},{0,1.8,8846.315037650835,1.652499890670798e6,1.0081815236953616e8,2.980852295984091e9,5.117658296341241e10,5.653923499515992e11,4.2884376326036885e12,2.3314343858552824e13,9.354089348013502e13,2.8240048108547756e14,6.491502225984054e14,1.142121460503862e15,1.5361570189811522e15,1.5661512339351905e15,1.188884318540835e15,6.508081678370406e14,2.4269387512646872e14,5.516934054076771e13,5.767358846077505e12,0,0,0,0,0,0},{0,0,-48.486092838536685,-28610.053294245357,-3.5971398670573817e6,-1.8170450901651797e8,-4.800628986511418e9,-7.645048609922267e10,-8.002747183060198e11,-5.828318542596038e12,-3.0696178946402035e13,-1.2005854798795881e14,-3.549510824718861e14,-8.017723301469554e14,-1.3898631564766085e15,-1.8456808435841622e15,-1.8609896441157935e15,-1.3990467910248515e15,-7.593074829663808e14,-2.8099884047000084e14,-6.3440947306852555e13,-6.591267252660006e12,0,0,0,0,0},{0,0,0.0069498069498069494,158.46348709704054,62337.20331735644,6.475875533245151e6,2.921192897693864e8,7.157442458806223e9,1.0799555655084192e11,1.0855125833750288e12,7.659196496678287e12,3.932659690536154e13,1.5063960727715928e14,4.376723566398628e14,9.741274125347245e14,1.6673482941700252e15,2.189911586818609e15,2.1868594523613995e15,1.630061509290193e15,8.779941332352192e14,3.227187992148031e14,7.241486860017006e13,7.481979043560007e12,0,0,0,0},{0,0,-0.0000108000108000108,-0.024343224343224345,-346.71430558980086,-112261.86290506809,-1.0402072220276337e7,-4.349568507848248e8,-1.009552791463289e10,-1.4625792737830328e11,-1.4242626335574956e12,-9.797394622514166e12,-4.9269031116791766e13,-1.8547288277928522e14,-5.3100005187471706e14,-1.167000294197266e15,-1.9756813909489115e15,-2.5700586158413735e15,-2.544779679266689e15,-1.882576246583223e15,-1.007168503518773e15,-3.6794961500620994e14,-8.210992386265853e13,-8.4412071260677e12,0,0,0}}},
-  {{{0,-0.6333333333333333,164158.73333333334,1.9930293177442875e7,9.033522147628825e8,2.159562943718983e10,3.1695435436427655e11,3.1117616133093535e12,2.1572888288816043e13,1.09484309701826e14,4.1677133450584825e14,1.2090804894217778e15,2.6979173704553415e15,4.645555959846248e15,6.155935299753043e15,6.217286496234509e15,4.696578395452082e15,2.568066717852626e15,9.596044046707916e14,2.191596361509452e14,2.306943538431002e13,0,0,0,0,0,0},{0,0,-2285.7,-581877.1667007137,-4.542712920857985e7,-1.6777496857464986e9,-3.554596419337812e10,-4.8146941932528937e11,-4.463236488322537e12,-2.963468073013338e13,-1.4541483616136725e14,-5.387724333982664e14,-1.528682077106105e15,-3.3483222279232085e15,-5.675362800076585e15,-7.419408932698538e15,-7.405721111493924e15,-5.536919691805194e15,-3.000077941416619e15,-1.1119673832339076e15,-2.5211597241424522e14,-2.6365069010640023e13,0,0,0,0,0},{0,0,9.5,8034.346639088207,1.3179673367617e6,8.39534763120524e7,2.750469750609688e9,5.381559497441904e10,6.886135692098751e11,6.116068398456957e12,3.927525531830635e13,1.87621875146192e14,6.800177457846064e14,1.8942591437198682e15,4.0847532803221355e15,6.831268665098625e15,8.82695090814349e15,8.720982640500069e15,6.461561639299811e15,3.4729854777955795e15,1.277987710634628e15,2.8787805081888025e14,2.9927916174240027e13,0,0,0,0},{0,0,0,-33.253291753291755,-18118.497367092852,-2.4263056561244098e6,-1.371723164151261e8,-4.1521251582654886e9,-7.677555171735455e10,-9.415385502549863e11,-8.089827546033466e12,-5.058607217578998e13,-2.364337668337472e14,-8.414253645683544e14,-2.307828334679184e15,-4.910703691264801e15,-8.118041289783834e15,-1.0383658748433438e16,-1.0167288912591014e16,-7.473149461470064e15,-3.9880042421706445e15,-1.4580506661137562e15,-3.2652123928561875e14,-3.37648285042708e13,0,0,0},{0,0,0,4.587809465858246e-6,74.82402515085442,33264.59142595566,3.9539347999028377e6,2.0657696267892247e8,5.910713251530081e9,1.0476957462492262e11,1.2431924580143315e12,1.0402955953492928e13,6.365382991017692e13,2.9216326172935256e14,1.0238733031895974e15,2.7713247980029775e15,5.829535183879195e15,9.540280533475378e15,1.209446128636118e16,1.1748726073620186e16,8.574250203286003e15,4.5463150567317e15,1.6525312353663298e15,3.6811898393680606e14,3.788249051698675e13,0,0}},{{1.2666666666666666,-454.73333333333335,-681521.0882190833,-6.866812258629e7,-2.7377423472293215e9,-5.885373059155742e10,-7.861999036201415e11,-7.081109305222594e12,-4.529513317348146e13,-2.1305179026514706e14,-7.544247442837826e14,-2.042292971648917e15,-4.264112494563583e15,-6.887192122673396e15,-8.579721224269423e15,-8.162941954518764e15,-5.819981799016939e15,-3.0089392479769985e15,-1.064858703611706e15,-2.3069435384310022e14,-2.306943538431002e13,0,0,0,0,0,0},{0,1.9,10528.43340142741,2.1966056588859563e6,1.496340808486337e8,4.94310202090654e9,9.495646973148334e10,1.1764390850983005e12,1.0037702723170137e13,6.163907586873927e13,2.808207197238787e14,9.692149606108888e14,2.56903911487428e15,5.27020715794106e15,8.385800766327233e15,1.0313148662287174e16,9.703156383423962e15,6.850671684428315e15,3.5112616134256495e15,1.2330819190015352e15,2.6529850691956525e14,2.6365069010640023e13,0,0,0,0,0},{0,0,-51.693278176413344,-34074.78014180465,-4.781836743440356e6,-2.6961591339264446e8,-7.957160824871687e9,-1.417663970015018e11,-1.6639977875868992e12,-1.3631292963271166e13,-8.108623737250361e13,-3.6010324340970756e14,-1.2170534965459422e15,-3.1699041795772295e15,-6.406817661291515e15,-1.006485817543921e16,-1.2241435673077942e16,-1.1405817498928164e16,-7.983798180042419e15,-4.0608079407256885e15,-1.4163152517613982e15,-3.0284200890600025e14,-2.9927916174240027e13,0,0,0,0},{0,0,0.006583506583506584,169.06299475396784,74264.58077013028,8.60869260141037e6,4.3336689596040046e8,1.1859561376200863e10,2.0016987814094357e11,2.255834083018215e12,1.7902005880230887e13,1.0381148852085344e14,4.5148680237416356e14,1.499482007722108e15,3.8480749449814715e15,7.679151287997549e15,1.1931083759742532e16,1.4371388164888972e16,1.3276270216445754e16,9.222548421515924e15,4.658972295533745e15,1.614980380412015e15,3.434036535377542e14,3.37648285042708e13,0,0,0},{0,0,-9.175618931716493e-6,-0.023058330375403547,-370.01552049520996,-133761.33977549043,-1.3827819745792182e7,-6.451738118427956e8,-1.6723378636699493e10,-2.709901673195793e11,-2.9584696444771226e12,-2.288771647820421e13,-1.2998082039545089e14,-5.555315701855969e14,-1.8179762075703875e15,-4.606611728235598e15,-9.092222501474912e15,-1.3990963605707124e16,-1.6709589472590812e16,-1.5319694204447672e16,-1.0570016078374418e16,-5.307109848412682e15,-1.8294877603627978e15,-3.8706022919529944e14,-3.788249051698675e13,0,0}}},
-  {{{0,-0.6666666666666666,212266.66666666666,2.853599258035219e7,1.4330114863456995e9,3.800258146404937e10,6.199274770948887e11,6.782860407787912e12,5.259010470068523e13,2.998352445442762e14,1.289474302995765e15,4.256253873967506e15,1.0902678302444068e16,2.1797926698136784e16,3.403776778865586e16,4.131592071162812e16,3.85489253454479e16,2.709770607257666e16,1.3874444112447926e16,4.881180309397506e15,1.054602760425601e15,1.054602760425601e14,0,0,0,0,0},{0,0,-2666,-751541.6624389548,-6.496750631920008e7,-2.6584414136368732e9,-6.248207318933823e10,-9.406826677470544e11,-9.718503789838549e12,-7.216907849489138e13,-3.978378205026157e14,-1.6653179634893145e15,-5.376204754295016e15,-1.3518436707709178e16,-2.6605608406951144e16,-4.0986885639172104e16,-4.9169772065455784e16,-4.540651511838149e16,-3.162877001568124e16,-1.6063591016532404e16,-5.610415428520925e15,-1.204242341296801e15,-1.1971166469696011e14,0,0,0,0},{0,0,10,9367.463398770313,1.701250849010266e6,1.1998124014091475e8,4.354863213182676e9,9.45208118958657e10,1.344305113466995e12,1.3306614989260633e13,9.556877985629884e13,5.12895265809024e14,2.1002083731150322e15,6.656579614385937e15,1.6478625548324368e16,3.1999232770493936e16,4.8724507460816184e16,5.785749736908936e16,5.294839315410694e16,3.65864067552318e16,1.844784707627131e16,6.401367498840126e15,1.365940789490955e15,1.350593140170832e14,0,0,0},{0,0,0,-35.00312695434646,-21120.499631781146,-3.13075780749621e6,-1.9594466391609663e8,-6.57050375487538e9,-1.3476651743799847e11,-1.8369043800571548e12,-1.7589435314077154e13,-1.2300981206774544e14,-6.45896597792679e14,-2.5969519006174225e15,-8.1043872896729e15,-1.979717247928791e16,-3.800085757405471e16,-5.727840617892459e16,-6.7406697825393336e16,-6.119592653276693e16,-4.198322456673902e16,-2.1032687680075924e16,-7.255685440992997e15,-1.5400055927557658e15,-1.51529962067947e14,0,0},{0,0,0,3.930803703917714e-6,78.76094777966587,38771.1275913068,5.100639029001081e6,2.949841095687273e8,9.349478097378347e9,1.8381938202018082e11,2.42419630975418e12,2.2606778024802125e13,1.547013295439825e14,7.976887641336864e14,3.1582328358075825e15,9.726354425919532e15,2.3487483127377148e16,4.463176708335417e16,6.667543951844797e16,7.784411667165024e16,7.0169853688251656e16,4.78314795584771e16,2.3823442630743476e16,8.174976337050191e15,1.7267367770533495e15,1.6914972509910362e14,0}},{{1.3333333333333333,-530.6666666666666,-892251.827371045,-9.987215970701566e7,-4.424126639899304e9,-1.0578643572033942e11,-1.5747287228400437e12,-1.5845717567057562e13,-1.1362682509291195e14,-6.01771280857198e14,-2.4125671241445005e15,-7.446002113664234e15,-1.7881405459744606e16,-3.35951258854644e16,-4.9401354974251736e16,-5.657957303847233e16,-4.9900402465368104e16,-3.3212859965007824e16,-1.612718315044587e16,-5.388707887852326e15,-1.107332898446881e15,-1.054602760425601e14,0,0,0,0,0},{0,2,12417.32487790964,2.877010547668333e6,2.1757735630149266e8,7.983815399399566e9,1.7056499979904105e11,2.354551408251009e12,2.244295896408418e13,1.5448897973201038e14,7.924454954576368e14,3.09644241377513e15,9.357141993333924e15,2.2077909573687176e16,4.086271515883938e16,5.931957879239599e16,6.7183171140618856e16,5.867380519673225e16,3.8715022071894504e16,1.8654226260365056e16,6.190090662038646e15,1.2640981736452812e15,1.1971166469696011e14,0,0,0,0},{0,0,-54.92679754062404,-40215.75896837982,-6.263591942903851e6,-3.919620881744125e8,-1.2847160247073557e10,-2.5452055340858438e11,-3.3284003694315527e12,-3.045760371601915e13,-2.0308431931952872e14,-1.0153938929148701e15,-3.8851031201166525e15,-1.1535964059895936e16,-2.6816071946032308e16,-4.9000640659284456e16,-7.0346216741010216e16,-7.889814086638738e16,-6.831336974290147e16,-4.473081072704507e16,-2.1405078738350924e16,-7.0590142722074e15,-1.4334704464994968e15,-1.350593140170832e14,0,0,0},{0,0,0.006253908692933083,179.75473573239677,87672.02030488498,1.127655502867755e7,6.299257811345832e8,1.9142375540966686e10,3.592377142778432e11,4.510116251939719e12,3.997869384169198e13,2.598472460491622e14,1.2722572790529712e15,4.783417939546741e15,1.3993927307709768e16,3.2117401194767464e16,5.8041145938566104e16,8.251977130024504e16,9.176083681396456e16,7.884587952758733e16,5.127529010535035e16,2.4385985285874588e16,7.99727636948314e15,1.6157705737897392e15,1.51529962067947e14,0,0},{0,0,-7.861607407835427e-6,-0.021902438238229502,-393.52434085950074,-157932.76854200763,-1.8113190266049244e7,-9.376913624338514e8,-2.698711715217962e10,-4.86188476940676e11,-5.912673590075985e12,-5.109028982891983e13,-3.251901708214681e14,-1.5646005583864498e15,-5.796048104691107e15,-1.6742037879323554e16,-3.800261305735843e16,-6.801536029880263e16,-9.587749223709138e16,-1.0580649570083427e17,-9.029733700258528e16,-5.8363106600548536e16,-2.7603025440299108e16,-9.006629152120784e15,-1.8113116396029015e15,-1.6914972509910362e14,0}}}
+  {{0,2,5,8,11},{14,16,19,23,27}},
+  {{31,34,38,42,46},{50,53,57,62,67}},
+  {{72,76,81,86,91},{96,100,105,111,117}},
+  {{123,128,134,140,146},{152,157,163,170,177}},
+  {{184,190,197,204,211},{218,224,231,239,247}},
+  {{255,262,270,278,286},{294,301,309,318,327}},
+  {{336,344,353,362,371},{380,388,397,407,417}},
+  {{427,436,446,456,466},{476,485,495,506,517}},
+  {{528,538,549,560,571},{582,592,603,615,627}},
+  {{639,650,662,674,686},{698,709,721,734,747}},
+  {{760,772,785,798,811},{824,836,849,863,877}},
+  {{891,904,918,932,946},{960,973,987,1002,1017}},
+  {{1032,1046,1061,1076,1091},{1106,1120,1135,1151,1167}},
+  {{1183,1198,1214,1230,1246},{1262,1277,1293,1310,1327}},
+  {{1344,1360,1377,1394,1411},{1428,1444,1461,1479,1497}},
+  {{1515,1532,1550,1568,1586},{1604,1621,1639,1658,1677}},
+  {{1696,1714,1733,1752,1771},{1790,1808,1827,1847,1867}},
+  {{1887,1906,1926,1946,1966},{1986,2005,2025,2046,2067}},
+  {{2088,2108,2129,2150,2171},{2192,2212,2233,2255,2277}},
+  {{2299,2320,2342,2364,2386},{2408,2429,2451,2474,2497}},
+  {{2520,2542,2565,2588,2611},{2634,2656,2679,2703,2727}}
  };
 
+
 static inline int max(int a, int b)
 {
   return a > b ? a : b;
 }
 
+/* Coefficients for modes m > 20 in the same layout as ReEI and ImEI, generated
+   for modes up to the highest requested so far */
+static struct effsource_mode_table * mode_table;
+static pthread_mutex_t mode_table_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Check that mode m can be computed, generating the coefficients for m > 20
+   up to m if they have not been yet. Returns 0 if m < 0 or the coefficients
+   cannot be allocated. */
+static int mode_supported(int m)
+{
+  if(m < 0)
+    return 0;
+  if(m <= 20)
+    return 1;
+
+  const struct effsource_mode_table * t = __atomic_load_n(&mode_table, __ATOMIC_ACQUIRE);
+  if(t != NULL && t->m_max >= m)
+    return 1;
+
+  pthread_mutex_lock(&mode_table_lock);
+  const int status = effsource_mode_table_grow(&mode_table, m, 1);
+  pthread_mutex_unlock(&mode_table_lock);
+  return status == 0;
+}
+
+/* Compute the time derivatives of the coefficients if this has not yet been
+   done since the last call to effsource_set_particle_ctx */
+static void particle_dt_require(struct effsource_ctx * ctx)
+{
+  if(__atomic_load_n(&ctx->dt_set, __ATOMIC_ACQUIRE))
+    return;
+
+  pthread_mutex_lock(&ctx->dt_lock);
+  if(!ctx->dt_set)
+  {
+    effsource_set_particle_dt(ctx);
+    __atomic_store_n(&ctx->dt_set, 1, __ATOMIC_RELEASE);
+  }
+  pthread_mutex_unlock(&ctx->dt_lock);
+}
+
+/* Coefficients of the polynomial in alpha/beta for mode m */
+static inline const double * ReEI_coeffs(int m, int i, int j)
+{
+  if(m<=20)
+    return ReEI+ReEIOffset[m][i][j];
+  const struct effsource_mode_table * t = __atomic_load_n(&mode_table, __ATOMIC_ACQUIRE);
+  return t->Re+t->ReOffset[m-21][i][j];
+}
+
+static inline const double * ImEI_coeffs(int m, int i, int j)
+{
+  if(m<=20)
+    return ImEI+ImEIOffset[m][i][j];
+  const struct effsource_mode_table * t = __atomic_load_n(&mode_table, __ATOMIC_ACQUIRE);
+  return t->Im+t->ImOffset[m-21][i][j];
+}
+
+/* Lowest and highest powers of dr in the coefficient of dtheta^(2b) Q^(2j) R^ri
+   in the numerator, see kerr-equatorial.h */
+static inline int num_dr_min(int j, int b)
+{
+  return max(6-2*(j+b), 0);
+}
+
+static inline int num_dr_max(int ri, int j, int b)
+{
+  return 9-ri-2*(j+b);
+}
+
+/* Evaluate the polynomials in dr multiplying dtheta^(2b) Q^(2j) R^ri in the
+   numerator. D[ri][d][j][b] is the value for d = 0 and, if derivs is non-zero,
+   its partial r, (r,r), t, (t,r) and (t,t) derivatives at fixed dr for
+   d = 1, ..., 5. Only the entries with j+b <= 4 are set. */
+static inline __attribute__ ((always_inline)) void numerator_dr(const struct effsource_ctx * ctx,
+  double dr, int derivs, double D[2][6][5][5])
+{
+#pragma GCC unroll 2
+  for(int ri=0; ri<2; ri++)
+#pragma GCC unroll 5
+    for(int j=0; j<5; j++)
+#pragma GCC unroll 5
+      for(int b=0; b<5-j; b++)
+      {
+        const int o = effsource_num_offset[ri][j][b];
+        const int k0 = num_dr_min(j, b), k1 = num_dr_max(ri, j, b);
+
+        if(!derivs)
+        {
+          D[ri][0][j][b] = effsource_poly(ctx->A+o, k0, k1, dr);
+          continue;
+        }
+
+        double P[3], dPdt[3];
+        effsource_poly_d2(ctx->A+o, k0, k1, dr, P);
+        effsource_poly_d2(ctx->dAdt+o, k0, k1, dr, dPdt);
+
+        D[ri][0][j][b] = P[0];
+        D[ri][1][j][b] = P[1];
+        D[ri][2][j][b] = P[2];
+        D[ri][3][j][b] = dPdt[0];
+        D[ri][4][j][b] = dPdt[1];
+        D[ri][5][j][b] = effsource_poly(ctx->d2Adt2+o, k0, k1, dr);
+      }
+}
+
+/* The powers dtheta^(2b) and their first and second derivatives, w[d][b] */
+static inline __attribute__ ((always_inline)) void numerator_dtheta(double dtheta, double w[3][5])
+{
+  const double dtheta2 = dtheta*dtheta;
+
+  w[0][0] = 1;
+  w[1][0] = 0;
+  w[2][0] = 0;
+#pragma GCC unroll 4
+  for(int b=1; b<5; b++)
+  {
+    w[0][b] = w[0][b-1]*dtheta2;
+    w[1][b] = 2*b*w[0][b-1]*dtheta;
+    w[2][b] = 2*b*(2*b-1)*w[0][b-1];
+  }
+}
+
+/* Combine the polynomials in dr with the powers of dtheta into the
+   coefficients of Q^(2j) in the real (ri=0) and imaginary (ri=1) parts of the
+   numerator. N[ri][d] holds the value for d = 0 and, if derivs is non-zero,
+   the partial r, (r,r), t, (t,r), (t,t), theta and (theta,theta) derivatives
+   for d = 1, ..., 7. */
+static inline __attribute__ ((always_inline)) void numerator_contract(double D[2][6][5][5],
+  double w[3][5], int derivs, double N[2][8][5])
+{
+  const int nd = derivs ? 6 : 1;
+
+#pragma GCC unroll 2
+  for(int ri=0; ri<2; ri++)
+#pragma GCC unroll 5
+    for(int j=0; j<5; j++)
+    {
+#pragma GCC unroll 6
+      for(int d=0; d<nd; d++)
+      {
+        double s = 0;
+#pragma GCC unroll 5
+        for(int b=0; b<5-j; b++)
+          s += D[ri][d][j][b]*w[0][b];
+        N[ri][d][j] = s;
+      }
+
+      if(!derivs)
+        continue;
+
+#pragma GCC unroll 2
+      for(int d=1; d<3; d++)
+      {
+        double s = 0;
+#pragma GCC unroll 5
+        for(int b=0; b<5-j; b++)
+          s += D[ri][0][j][b]*w[d][b];
+        N[ri][5+d][j] = s;
+      }
+    }
+}
+
+/* Coefficients of Q^(2j) in the numerator at the point displaced by
+   (dr, dtheta) from the particle, as computed by numerator_contract */
+static inline __attribute__ ((always_inline)) void numerator_eval(const struct effsource_ctx * ctx,
+  double dr, double dtheta, int derivs, double N[2][8][5])
+{
+  double D[2][6][5][5], w[3][5];
+
+  numerator_dr(ctx, dr, derivs, D);
+  numerator_dtheta(dtheta, w);
+  numerator_contract(D, w, derivs, N);
+}
+
+/* Evaluate sum_{j=0}^{4} a[j] u^j */
+static inline __attribute__ ((always_inline)) double numerator_poly(const double * a, double u)
+{
+  return a[0] + u*(a[1] + u*(a[2] + u*(a[3] + u*a[4])));
+}
+
+/* Evaluate the Q derivative divided by Q of sum_{j=0}^{4} a[j] Q^(2j) with u = Q^2 */
+static inline __attribute__ ((always_inline)) double numerator_poly_d(const double * a, double u)
+{
+  return 2*a[1] + u*(4*a[2] + u*(6*a[3] + u*8*a[4]));
+}
+
+/* Evaluate the second Q derivative of sum_{j=0}^{4} a[j] Q^(2j) with u = Q^2 */
+static inline __attribute__ ((always_inline)) double numerator_poly_d2(const double * a, double u)
+{
+  return 2*a[1] + u*(12*a[2] + u*(30*a[3] + u*56*a[4]));
+}
+
 /* Compute the singular field at the point x for the particle at xp */
-void effsource_PhiS(struct coordinate * x, double * PhiS)
+void effsource_PhiS_ctx(struct effsource_ctx * ctx, struct coordinate * x, double * PhiS)
 {
+  const double alpha20 = ctx->alpha20, alpha02 = ctx->alpha02, beta = ctx->beta, c = ctx->c;
+
   double A, alpha, rho2;
 
   double r      = x->r;
   double theta  = x->theta;
   double phi    = x->phi;
-  double rp     = xp.r;
-  double thetap = xp.theta;
-  double phip   = xp.phi;
+  double rp     = ctx->xp.r;
+  double thetap = ctx->xp.theta;
+  double phip   = ctx->xp.phi;
 
   double dr     = r - rp;
   double dtheta = theta - thetap;
@@ -101,140 +349,84 @@ void effsource_PhiS(struct coordinate * x, double * PhiS)
 
   double dphib  = dphi - c*dr;
 
-  double dr2 = dr*dr;
-  double dr4 = dr2*dr2;
-  double dr6 = dr4*dr2;
-  double dr8 = dr4*dr4;
-
-  double dtheta2  = dtheta*dtheta;
-  double dtheta4  = dtheta2*dtheta2;
-  double dtheta8  = dtheta4*dtheta4;
-
   double dQ  = sin(0.5*dphib);
   double dQ2 = dQ*dQ;
-  double dQ4 = dQ2*dQ2;
-  double dQ8 = dQ4*dQ4;
 
   double dR  = sin(dphib);
 
-  A = dQ8*(A0080 + A1080*dr) + (A6000 + A7000*dr)*dr6 + (A8000 + A9000*dr)*dr8 +
-   (A4200 + dr*(A5200 + dr*(A6200 + A7200*dr)))*dr4*dtheta2 +
-   ((A2400 + A3400*dr)*dr2 + (A4400 + A5400*dr)*dr4 + (A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta2)*
-    dtheta4 + dQ4*((A2040 + A3040*dr)*dr2 + (A4040 + A5040*dr)*dr4 +
-      (A0240 + dr*(A1240 + dr*(A2240 + A3240*dr)))*dtheta2 +
-      dQ2*(A0060 + A1060*dr + (A2060 + A3060*dr)*dr2 + (A0260 + A1260*dr)*dtheta2) + (A0440 + A1440*dr)*dtheta4) +
-   dQ2*((A4020 + dr*(A5020 + dr*(A6020 + A7020*dr)))*dr4 +
-      (A2220 + dr*(A3220 + dr*(A4220 + A5220*dr)))*dr2*dtheta2 +
-      (A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2)*dtheta4) +
-   (A0800 + A1800*dr)*dtheta8 + dR*(A0081*dQ8 + (A6001 + A7001*dr)*dr6 + A8001*dr8 +
-      (A4201 + dr*(A5201 + A6201*dr))*dr4*dtheta2 +
-      ((A2401 + A3401*dr)*dr2 + A4401*dr4 + (A0601 + dr*(A1601 + A2601*dr))*dtheta2)*dtheta4 +
-      dQ4*((A2041 + A3041*dr)*dr2 + A4041*dr4 + (A0241 + dr*(A1241 + A2241*dr))*dtheta2 +
-         dQ2*(A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2) + A0441*dtheta4) +
-      dQ2*((A4021 + dr*(A5021 + A6021*dr))*dr4 + (A2221 + dr*(A3221 + A4221*dr))*dr2*dtheta2 +
-         (A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2)*dtheta4) + A0801*dtheta8);
-
-  alpha = alpha20*dr2 + alpha02*dtheta2;
+  double N[2][8][5];
+  numerator_eval(ctx, dr, dtheta, 0, N);
+
+  A = numerator_poly(N[0][0], dQ2) + dR*numerator_poly(N[1][0], dQ2);
+
+  alpha = alpha20*(dr*dr) + alpha02*(dtheta*dtheta);
   rho2 = alpha + beta*dQ2;
 
   *PhiS = A/pow(rho2, 3.5);
 }
 
 /* Compute the singular field at the point x for the particle at xp */
-void effsource_PhiS_m(int m, struct coordinate * x, double * PhiS)
+void effsource_PhiS_m_ctx(struct effsource_ctx * ctx, int m, struct coordinate * x, double * PhiS)
 {
-  double ReA[5], ImA[5], num_re, num_im;
+  const double alpha20 = ctx->alpha20, alpha02 = ctx->alpha02, beta = ctx->beta, c = ctx->c;
+
+  double num_re, num_im;
 
   double r      = x->r;
   const double theta  = x->theta;
-  const double rp     = xp.r;
-  const double thetap = xp.theta;
+  const double rp     = ctx->xp.r;
+  const double thetap = ctx->xp.theta;
 
   const double dr     = r - rp;
   const double dtheta = theta - thetap;
 
-  double dr2 = dr*dr;
-  double dr4 = dr2*dr2;
-  double dr6 = dr4*dr2;
-  double dr8 = dr4*dr4;
-
-  double dtheta2  = dtheta*dtheta;
-  double dtheta4  = dtheta2*dtheta2;
-  double dtheta8  = dtheta4*dtheta4;
-
   /* Compute coefficients of powers of dQ and dR */
-  ReA[0] = (A6000 + A7000*dr)*dr6 + (A8000 + A9000*dr)*dr8 + (A4200 + dr*(A5200 + dr*(A6200 + A7200*dr)))*dr4*dtheta2 + ((A2400 + A3400*dr)*dr2 + (A4400 + A5400*dr)*dr4 + (A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta2)*dtheta4 + (A0800 + A1800*dr)*dtheta8;
-  ImA[0] = (A6001 + A7001*dr)*dr6 + A8001*dr8 + (A4201 + dr*(A5201 + A6201*dr))*dr4*dtheta2 + ((A2401 + A3401*dr)*dr2 + A4401*dr4 + (A0601 + dr*(A1601 + A2601*dr))*dtheta2)*dtheta4 + A0801*dtheta8;
-  ReA[1] = (A4020 + dr*(A5020 + dr*(A6020 + A7020*dr)))*dr4 + (A2220 + dr*(A3220 + dr*(A4220 + A5220*dr)))*dr2*dtheta2 + (A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2)*dtheta4;
-  ImA[1] = (A4021 + dr*(A5021 + A6021*dr))*dr4 + (A2221 + dr*(A3221 + A4221*dr))*dr2*dtheta2 + (A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2)*dtheta4;
-  ReA[2] = (A2040 + A3040*dr)*dr2 + (A4040 + A5040*dr)*dr4 + (A0240 + dr*(A1240 + dr*(A2240 + A3240*dr)))*dtheta2 + (A0440 + A1440*dr)*dtheta4;
-  ImA[2] = (A2041 + A3041*dr)*dr2 + A4041*dr4 + (A0241 + dr*(A1241 + A2241*dr))*dtheta2 + A0441*dtheta4;
-  ReA[3] = A0060 + A1060*dr + (A2060 + A3060*dr)*dr2 + (A0260 + A1260*dr)*dtheta2;
-  ImA[3] = A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2;
-  ReA[4] = A0080 + A1080*dr;
-  ImA[4] = A0081;
+  double N[2][8][5];
+  numerator_eval(ctx, dr, dtheta, 0, N);
+  const double * ReA = N[0][0], * ImA = N[1][0];
 
   /* Compute the argument of the elliptic integrals */
-  const double alpha = alpha20*dr2 + alpha02*dtheta2;
+  const double alpha = alpha20*(dr*dr) + alpha02*(dtheta*dtheta);
   const double C1 = alpha / beta;
-  double C[27];
-  C[0]  = 1;
-  C[1]  = C1;
-  C[2]  = C[1]*C[1];
-  C[3]  = C[2]*C[1];
-  C[4]  = C[2]*C[2];
-  C[5]  = C[3]*C[2];
-  C[6]  = C[3]*C[3];
-  C[7]  = C[4]*C[3];
-  C[8]  = C[4]*C[4];
-  C[9]  = C[5]*C[4];
-  C[10] = C[5]*C[5];
-  C[11] = C[6]*C[5];
-  C[12] = C[6]*C[6];
-  C[13] = C[7]*C[6];
-  C[14] = C[7]*C[7];
-  C[15] = C[8]*C[7];
-  C[16] = C[8]*C[8];
-  C[17] = C[9]*C[8];
-  C[18] = C[9]*C[9];
-  C[19] = C[10]*C[9];
-  C[20] = C[10]*C[10];
-  C[21] = C[11]*C[10];
-  C[22] = C[11]*C[11];
-  C[23] = C[12]*C[11];
-  C[24] = C[12]*C[12];
-  C[25] = C[13]*C[12];
-  C[26] = C[13]*C[13];
-
-  double gam = sqrt(1.0/(1.0+C1));
-  const double ellE = gsl_sf_ellint_Ecomp(gam, GSL_PREC_DOUBLE);
-  const double ellK = gsl_sf_ellint_Kcomp(gam, GSL_PREC_DOUBLE);
+  const double C2 = C1*C1;
+  const double C3 = C2*C1;
+
+  double ellK, ellE;
+  effsource_ellint_KE(1, &C1, &ellK, &ellE);
   const double ellip[2] = {ellK, ellE};
 
-  if(m>20)
-  {
-    printf("Support for computing mode %d has not yet been added.\n", m);
+  if(!mode_supported(m))
     return;
-  }
 
   num_re = 0;
   num_im = 0;
-  for(int i=0; i<2; i++)
+  if(effsource_mode_poly(m, C1))
+  {
+    for(int i=0; i<2; i++)
+      for(int j=0; j<5; j++)
+      {
+        num_re += ellip[i]*ReA[j]*effsource_poly(ReEI_coeffs(m,i,j), max(j-i,0), m+2+j, C1);
+        num_im += ellip[i]*ImA[j]*effsource_poly(ImEI_coeffs(m,i,j), max(j-i-1,0), m+1+j, C1);
+      }
+  }
+  else
+  {
+    double F_re[1][5][3], F_im[1][5][3];
+    effsource_mode_values(m, m, C1, ellK, ellE, F_re, F_im);
     for(int j=0; j<5; j++)
     {
-      for(int k=max(j-i,0); k<=m+2+j; k++)
-        num_re += ReEI[m][i][j][k]*ellip[i]*ReA[j]*C[k];
-      for(int k=max(j-i-1,0); k<=m+1+j; k++)
-        num_im += ImEI[m][i][j][k]*ellip[i]*ImA[j]*C[k];
+      num_re += ReA[j]*F_re[0][j][0];
+      num_im += ImA[j]*F_im[0][j][0];
     }
+  }
 
   /* m-modes for the rotated phi coordinate */
   double alpha_plus_beta_10 = alpha+beta;
   double alpha_plus_beta_05 = sqrt(alpha_plus_beta_10);
   double alpha_plus_beta_15 = alpha_plus_beta_10*alpha_plus_beta_05;
   double alpha_plus_beta_25 = alpha_plus_beta_10*alpha_plus_beta_15;
-  const double PhiSb_re = 4.0*num_re/(beta*C[3]*alpha_plus_beta_25);
-  const double PhiSb_im = -32.0*num_im/(beta*beta*C[2]*alpha_plus_beta_15);
+  const double PhiSb_re = 4.0*num_re/(beta*C3*alpha_plus_beta_25);
+  const double PhiSb_im = -32.0*num_im/(beta*beta*C2*alpha_plus_beta_15);
 
   /* m-modes for the regular Boyer-Lindquist phi coordinate */
   double sincmdr = sin(c*m*dr);
@@ -244,99 +436,65 @@ void effsource_PhiS_m(int m, struct coordinate * x, double * PhiS)
 
   /* Store calculated quantities into the arrays provided by the caller,
      including the phase factor exp(-i*m*phi_p) */
-  double cosmph = cos(m*xp.phi);
-  double sinmph = sin(m*xp.phi);
+  double cosmph = cos(m*ctx->xp.phi);
+  double sinmph = sin(m*ctx->xp.phi);
 
   PhiS[0] = RePhiS*cosmph + ImPhiS*sinmph;
   PhiS[1] = ImPhiS*cosmph - RePhiS*sinmph;
 }
 
-/* Compute the singular field, its derivatives and its d'Alembertian */
-void effsource_calc(struct coordinate * x,
-  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+/* Numerator of the singular field and its partial derivatives with respect to
+   dr, dtheta, Q = sin(dphib/2), R = sin(dphib) and t at fixed dr, Q and R */
+struct calc_partials {
+  double A, dA_dr, d2A_dr2, dA_dth, d2A_dth2, dA_dQ, dA_dR, d2A_dQ2, d2A_dQR, d2A_dQr, d2A_dRr;
+  double dA_dt, d2A_dt2, d2A_dtQ, d2A_dtR, d2A_dtr;
+};
+
+/* Compute the singular field, its derivatives and its d'Alembertian at a point
+   from the partial derivatives of the numerator, Q, R and their phi
+   derivatives, and s2 = rho^2 and its square root. Component k of each output
+   is stored at index k*stride. */
+static inline __attribute__ ((always_inline)) void calc_finish(const struct effsource_ctx * ctx,
+  double r, double dr, double dtheta, double dQ, double dQ_dph, double dR, double dR_dph,
+  double sinth2, double sin2th, double cos2th, const struct calc_partials * p, double s2,
+  double sqrts2, int stride, double * restrict PhiS, double * restrict dPhiS_dx,
+  double * restrict d2PhiS_dx2, double * restrict src)
 {
-  double A, dA_dr, d2A_dr2, dA_dth, d2A_dth2, dA_dQ, dA_dR, dA_dph;
-  double d2A_dQ2, d2A_dQR, d2A_dQr, d2A_dRr, d2A_dph2, dA_dt, d2A_dt2, d2A_dtQ, d2A_dtR, d2A_dtph, d2A_dtr;
-  double s2, sqrts2, s2_15, s2_25, s2_35, s2_45, s2_55, ds2_dr, d2s2_dr2, ds2_dth;
+  const double a = ctx->a, alpha20 = ctx->alpha20, alpha02 = ctx->alpha02, beta = ctx->beta,
+               c = ctx->c, dalphadt20 = ctx->dalphadt20, dalphadt02 = ctx->dalphadt02,
+               dbetadt = ctx->dbetadt, dcdt = ctx->dcdt, d2alphadt220 = ctx->d2alphadt220,
+               d2alphadt202 = ctx->d2alphadt202, d2betadt2 = ctx->d2betadt2, d2cdt2 = ctx->d2cdt2,
+               rt = ctx->rt, rtt = ctx->rtt, phit = ctx->phit, phitt = ctx->phitt;
+
+  double A = p->A, dA_dr = p->dA_dr, d2A_dr2 = p->d2A_dr2, dA_dth = p->dA_dth,
+         d2A_dth2 = p->d2A_dth2, dA_dQ = p->dA_dQ, dA_dR = p->dA_dR, d2A_dQ2 = p->d2A_dQ2,
+         d2A_dQR = p->d2A_dQR, d2A_dQr = p->d2A_dQr, d2A_dRr = p->d2A_dRr, dA_dt = p->dA_dt,
+         d2A_dt2 = p->d2A_dt2, d2A_dtQ = p->d2A_dtQ, d2A_dtR = p->d2A_dtR, d2A_dtr = p->d2A_dtr;
+  double dA_dph, d2A_dph2, d2A_dtph;
+  double s2_15, s2_25, s2_35, s2_45, s2_55, ds2_dr, d2s2_dr2, ds2_dth;
   double d2s2_dth2, ds2_dQ, ds2_dph, d2s2_dQ2, d2s2_dph2, ds2_dt, d2s2_dt2, d2s2_dtQ, d2s2_dtph, d2s2_dtr;
 
   double dPhiS_dt, dPhiS_dr, dPhiS_dth, dPhiS_dph, d2PhiS_dt2, d2PhiS_dtr, d2PhiS_dtth;
   double d2PhiS_dtph, d2PhiS_dr2, d2PhiS_drth, d2PhiS_drph, d2PhiS_dth2, d2PhiS_dthph, d2PhiS_dph2;
 
-  double r      = x->r;
-  double theta  = x->theta;
-  double phi    = x->phi;
-  double rp     = xp.r;
-  double thetap = xp.theta;
-  double phip   = xp.phi;
-
-  double dr     = r - rp;
-  double dtheta = theta - thetap;
-  double dphi   = phi - phip;
-
-  double dphib  = dphi - c*dr;
-
-  double dr2 = dr*dr;
-  double dr3 = dr2*dr;
-  double dr4 = dr2*dr2;
-  double dr5 = dr3*dr2;
-  double dr6 = dr4*dr2;
-  double dr7 = dr4*dr3;
-  double dr8 = dr4*dr4;
-
-  double dtheta2  = dtheta*dtheta;
-  double dtheta4  = dtheta2*dtheta2;
-  double dtheta6  = dtheta4*dtheta2;
-  double dtheta8  = dtheta4*dtheta4;
-
-  double dQ  = sin(0.5*dphib);
-  double dQ2 = dQ*dQ;
-  double dQ4 = dQ2*dQ2;
-  double dQ6 = dQ4*dQ2;
-  double dQ8 = dQ4*dQ4;
-
-  double dR  = sin(dphib);
+  const double dr2     = dr*dr;
+  const double dtheta2 = dtheta*dtheta;
+  const double dQ2     = dQ*dQ;
 
-  double dQ_dph = 0.5*cos(0.5*dphib);
   double dQ_dr  = -c*dQ_dph;
   double dQ_dt  = -dQ_dph*(dr*dcdt - c*rt + phit);
-  double dR_dph = cos(dphib);
   double dR_dr  = -c*dR_dph;
   double dR_dt  = -dR_dph*(dr*dcdt - c*rt + phit);
 
-  double d2Q_dph2 = -0.25*sin(0.5*dphib);
+  double d2Q_dph2 = -0.25*dQ;
   double d2Q_dr2  = c*c*d2Q_dph2;
   double d2Q_dt2  = d2Q_dph2*(dr*dcdt + phit - c*rt)*(dr*dcdt + phit - c*rt) - dQ_dph*(-2.0*dcdt*rt + dr*d2cdt2 + phitt - c*rtt);
   double d2Q_dtph = -d2Q_dph2*(dr*dcdt + phit - c*rt);
-  double d2R_dph2 = -sin(dphib);
+  double d2R_dph2 = -dR;
   double d2R_dr2  = c*c*d2R_dph2;
   double d2R_dt2  = d2R_dph2*(dr*dcdt + phit - c*rt)*(dr*dcdt + phit - c*rt) - dR_dph*(-2.0*dcdt*rt + dr*d2cdt2 + phitt - c*rtt);
   double d2R_dtph = -d2R_dph2*(dr*dcdt + phit - c*rt);
 
-  /* A */
-  A         = dQ8*(A0080 + A1080*dr) + (A6000 + A7000*dr)*dr6 + (A8000 + A9000*dr)*dr8 + (A4200 + dr*(A5200 + dr*(A6200 + A7200*dr)))*dr4*dtheta2 + ((A2400 + A3400*dr)*dr2 + (A4400 + A5400*dr)*dr4 + (A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta2)* dtheta4 + dQ4*((A2040 + A3040*dr)*dr2 + (A4040 + A5040*dr)*dr4 + (A0240 + dr*(A1240 + dr*(A2240 + A3240*dr)))*dtheta2 + dQ2*(A0060 + A1060*dr + (A2060 + A3060*dr)*dr2 + (A0260 + A1260*dr)*dtheta2) + (A0440 + A1440*dr)*dtheta4) + dQ2*((A4020 + dr*(A5020 + dr*(A6020 + A7020*dr)))*dr4 + (A2220 + dr*(A3220 + dr*(A4220 + A5220*dr)))*dr2*dtheta2 + (A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2)*dtheta4) + (A0800 + A1800*dr)*dtheta8 + dR*(A0081*dQ8 + (A6001 + A7001*dr)*dr6 + A8001*dr8 + (A4201 + dr*(A5201 + A6201*dr))*dr4*dtheta2 + ((A2401 + A3401*dr)*dr2 + A4401*dr4 + (A0601 + dr*(A1601 + A2601*dr))*dtheta2)*dtheta4 + dQ4*((A2041 + A3041*dr)*dr2 + A4041*dr4 + (A0241 + dr*(A1241 + A2241*dr))*dtheta2 + dQ2*(A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2) + A0441*dtheta4) + dQ2*((A4021 + dr*(A5021 + A6021*dr))*dr4 + (A2221 + dr*(A3221 + A4221*dr))*dr2*dtheta2 + (A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2)*dtheta4) + A0801*dtheta8);
-
-  /* dA/dx */
-  dA_dr     = A1080*dQ8 + 6*(A6000 + A7000*dr)*dr5 + A7000*dr6 + 8*(A8000 + A9000*dr)*dr7 + A9000*dr8 +  4*(A4200 + dr*(A5200 + dr*(A6200 + A7200*dr)))*dr3*dtheta2 + (A5200 + dr*(2*A6200 + 3*A7200*dr))*dr4*dtheta2 +  (2*A2400*dr + 3*A3400*dr2 + 4*A4400*dr3 + 5*A5400*dr4 + A1600*dtheta2 + 2*A2600*dr*dtheta2 + 3*A3600*dr2*dtheta2)*dtheta4 +  dQ4*(2*dr*(A2040 + A3040*dr) + A3040*dr2 + 4*(A4040 + A5040*dr)*dr3 + A5040*dr4 + (A1240 + dr*(2*A2240 + 3*A3240*dr))*dtheta2 +  dQ2*(A1060 + 2*A2060*dr + 3*A3060*dr2 + A1260*dtheta2) + A1440*dtheta4) +  dR*(6*(A6001 + A7001*dr)*dr5 + A7001*dr6 + 8*A8001*dr7 + 4*(A4201 + dr*(A5201 + A6201*dr))*dr3*dtheta2 + (A5201 + 2*A6201*dr)*dr4*dtheta2 +  dQ4*(dQ2*(A1061 + 2*A2061*dr) + 2*dr*(A2041 + A3041*dr) + A3041*dr2 + 4*A4041*dr3 + (A1241 + 2*A2241*dr)*dtheta2) +  (2*A2401*dr + 3*A3401*dr2 + 4*A4401*dr3 + A1601*dtheta2 + 2*A2601*dr*dtheta2)*dtheta4 +  dQ2*(4*A4021*dr3 + 5*A5021*dr4 + 6*A6021*dr5 + 2*A2221*dr*dtheta2 + 3*A3221*dr2*dtheta2 + 4*A4221*dr3*dtheta2 + A1421*dtheta4 +  2*A2421*dr*dtheta4)) + dQ2*(4*A4020*dr3 + 5*A5020*dr4 + 6*A6020*dr5 + 7*A7020*dr6 + 2*A2220*dr*dtheta2 + 3*A3220*dr2*dtheta2 +  4*A4220*dr3*dtheta2 + 5*A5220*dr4*dtheta2 + A1420*dtheta4 + 2*A2420*dr*dtheta4 + 3*A3420*dr2*dtheta4 + A1620*dtheta6) + A1800*dtheta8;
-  dA_dth    = 2*dtheta*((A4200 + dr*(A5200 + dr*(A6200 + A7200*dr)))*dr4 +  dQ4*(A0240 + A1240*dr + dQ2*(A0260 + A1260*dr) + (A2240 + A3240*dr)*dr2 + 2*(A0440 + A1440*dr)*dtheta2) +  2*dtheta2*((A2400 + A3400*dr)*dr2 + (A4400 + A5400*dr)*dr4 + (A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta2) +  (A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta4 + dQ2* ((A2220 + A3220*dr)*dr2 + (A4220 + A5220*dr)*dr4 + 2*dtheta2*(A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2) +  (A0620 + A1620*dr)*dtheta4) + 4*(A0800 + A1800*dr)*dtheta6 +  dR*((A4201 + dr*(A5201 + A6201*dr))*dr4 + dQ4*(A0241 + A0261*dQ2 + A1241*dr + A2241*dr2 + 2*A0441*dtheta2) +  2*dtheta2*((A2401 + A3401*dr)*dr2 + A4401*dr4 + (A0601 + dr*(A1601 + A2601*dr))*dtheta2) + (A0601 + dr*(A1601 + A2601*dr))*dtheta4 +  dQ2*((A2221 + A3221*dr)*dr2 + A4221*dr4 + 2*dtheta2*(A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2) + A0621*dtheta4) + 4*A0801*dtheta6));
-  dA_dQ     = 2*dQ*(4*dQ6*(A0080 + A1080*dr) + (A4020 + dr*(A5020 + dr*(A6020 + A7020*dr)))*dr4 + (A2220 + dr*(A3220 + dr*(A4220 + A5220*dr)))*dr2*dtheta2 +  dQ4*(A0060 + A1060*dr + (A2060 + A3060*dr)*dr2 + (A0260 + A1260*dr)*dtheta2) +  (A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2)*dtheta4 +  2*dQ2*((A2040 + A3040*dr)*dr2 + (A4040 + A5040*dr)*dr4 + (A0240 + dr*(A1240 + dr*(A2240 + A3240*dr)))*dtheta2 +  dQ2*(A0060 + A1060*dr + (A2060 + A3060*dr)*dr2 + (A0260 + A1260*dr)*dtheta2) + (A0440 + A1440*dr)*dtheta4) +  dR*(4*A0081*dQ6 + (A4021 + dr*(A5021 + A6021*dr))*dr4 + (A2221 + dr*(A3221 + A4221*dr))*dr2*dtheta2 +  dQ4*(A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2) + (A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2)*dtheta4 +  2*dQ2*((A2041 + A3041*dr)*dr2 + A4041*dr4 + (A0241 + dr*(A1241 + A2241*dr))*dtheta2 + dQ2*(A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2) +  A0441*dtheta4)));
-  dA_dR     = A0081*dQ8 + (A6001 + A7001*dr)*dr6 + A8001*dr8 + (A4201 + dr*(A5201 + A6201*dr))*dr4*dtheta2 +  ((A2401 + A3401*dr)*dr2 + A4401*dr4 + (A0601 + dr*(A1601 + A2601*dr))*dtheta2)*dtheta4 +  dQ4*((A2041 + A3041*dr)*dr2 + A4041*dr4 + (A0241 + dr*(A1241 + A2241*dr))*dtheta2 + dQ2*(A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2) +  A0441*dtheta4) + dQ2*((A4021 + dr*(A5021 + A6021*dr))*dr4 + (A2221 + dr*(A3221 + A4221*dr))*dr2*dtheta2 +  (A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2)*dtheta4) + A0801*dtheta8;
-  dA_dt     = dQ8*(dAdt0080 + dAdt1080*dr) + (dAdt6000 + dAdt7000*dr)*dr6 + (dAdt8000 + dAdt9000*dr)*dr8 + (dAdt4200 + dr*(dAdt5200 + dr*(dAdt6200 + dAdt7200*dr)))*dr4*dtheta2 + ((dAdt2400 + dAdt3400*dr)*dr2 + (dAdt4400 + dAdt5400*dr)*dr4 + (dAdt0600 + dr*(dAdt1600 + dr*(dAdt2600 + dAdt3600*dr)))*dtheta2)*dtheta4 + dQ4*((dAdt2040 + dAdt3040*dr)*dr2 + (dAdt4040 + dAdt5040*dr)*dr4 + (dAdt0240 + dr*(dAdt1240 + dr*(dAdt2240 + dAdt3240*dr)))*dtheta2 + dQ2*(dAdt0060 + dAdt1060*dr + (dAdt2060 + dAdt3060*dr)*dr2 + (dAdt0260 + dAdt1260*dr)*dtheta2) + (dAdt0440 + dAdt1440*dr)*dtheta4) + dQ2*((dAdt4020 + dr*(dAdt5020 + dr*(dAdt6020 + dAdt7020*dr)))*dr4 + (dAdt2220 + dr*(dAdt3220 + dr*(dAdt4220 + dAdt5220*dr)))*dr2*dtheta2 + (dAdt0420 + dAdt1420*dr + (dAdt2420 + dAdt3420*dr)*dr2 + (dAdt0620 + dAdt1620*dr)*dtheta2)*dtheta4) + (dAdt0800 + dAdt1800*dr)*dtheta8 + dR*(dAdt0081*dQ8 + (dAdt6001 + dAdt7001*dr)*dr6 + dAdt8001*dr8 + (dAdt4201 + dr*(dAdt5201 + dAdt6201*dr))*dr4*dtheta2 + ((dAdt2401 + dAdt3401*dr)*dr2 + dAdt4401*dr4 + (dAdt0601 + dr*(dAdt1601 + dAdt2601*dr))*dtheta2)*dtheta4 + dQ4*((dAdt2041 + dAdt3041*dr)*dr2 + dAdt4041*dr4 + (dAdt0241 + dr*(dAdt1241 + dAdt2241*dr))*dtheta2 + dQ2*(dAdt0061 + dAdt1061*dr + dAdt2061*dr2 + dAdt0261*dtheta2) + dAdt0441*dtheta4) + dQ2*((dAdt4021 + dr*(dAdt5021 + dAdt6021*dr))*dr4 + (dAdt2221 + dr*(dAdt3221 + dAdt4221*dr))*dr2*dtheta2 + (dAdt0421 + dAdt1421*dr + dAdt2421*dr2 + dAdt0621*dtheta2)*dtheta4) + dAdt0801*dtheta8);
-
-  /* d^2A/dx^2 */
-  d2A_dr2   = 2*(A2040*dQ4 + A2060*dQ6 + 3*A3040*dQ4*dr + 3*A3060*dQ6*dr + A2041*dQ4*dR + A2061*dQ6*dR + 3*A3041*dQ4*dr*dR + 6*A4020*dQ2*dr2 + 6*A4040*dQ4*dr2 +  6*A4021*dQ2*dR*dr2 + 6*A4041*dQ4*dR*dr2 + 10*A5020*dQ2*dr3 + 10*A5040*dQ4*dr3 + 10*A5021*dQ2*dR*dr3 + 15*A6000*dr4 + 15*A6020*dQ2*dr4 +  15*A6001*dR*dr4 + 15*A6021*dQ2*dR*dr4 + 21*A7000*dr5 + 21*A7020*dQ2*dr5 + 21*A7001*dR*dr5 + 28*A8000*dr6 + 28*A8001*dR*dr6 + 36*A9000*dr7 +  A2220*dQ2*dtheta2 + A2240*dQ4*dtheta2 + 3*A3220*dQ2*dr*dtheta2 + 3*A3240*dQ4*dr*dtheta2 + A2221*dQ2*dR*dtheta2 + A2241*dQ4*dR*dtheta2 +  3*A3221*dQ2*dr*dR*dtheta2 + 6*A4200*dr2*dtheta2 + 6*A4220*dQ2*dr2*dtheta2 + 6*A4201*dR*dr2*dtheta2 + 6*A4221*dQ2*dR*dr2*dtheta2 +  10*A5200*dr3*dtheta2 + 10*A5220*dQ2*dr3*dtheta2 + 10*A5201*dR*dr3*dtheta2 + 15*A6200*dr4*dtheta2 + 15*A6201*dR*dr4*dtheta2 +  21*A7200*dr5*dtheta2 + A2400*dtheta4 + A2420*dQ2*dtheta4 + 3*A3400*dr*dtheta4 + 3*A3420*dQ2*dr*dtheta4 + A2401*dR*dtheta4 +  A2421*dQ2*dR*dtheta4 + 3*A3401*dr*dR*dtheta4 + 6*A4400*dr2*dtheta4 + 6*A4401*dR*dr2*dtheta4 + 10*A5400*dr3*dtheta4 + A2600*dtheta6 +  3*A3600*dr*dtheta6 + A2601*dR*dtheta6);
-  d2A_dth2  = 2*((A4200 + dr*(A5200 + dr*(A6200 + A7200*dr)))*dr4 + dQ4*(A0240 + A1240*dr + dQ2*(A0260 + A1260*dr) + (A2240 + A3240*dr)*dr2 +  6*(A0440 + A1440*dr)*dtheta2) + 6*dtheta2*((A2400 + A3400*dr)*dr2 + (A4400 + A5400*dr)*dr4 +  (A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta2) + 9*(A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta4 +  dQ2*((A2220 + A3220*dr)*dr2 + (A4220 + A5220*dr)*dr4 + 6*dtheta2*(A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2) +  9*(A0620 + A1620*dr)*dtheta4) + 28*(A0800 + A1800*dr)*dtheta6 +  dR*((A4201 + dr*(A5201 + A6201*dr))*dr4 + dQ4*(A0241 + A0261*dQ2 + A1241*dr + A2241*dr2 + 6*A0441*dtheta2) +  6*dtheta2*((A2401 + A3401*dr)*dr2 + A4401*dr4 + (A0601 + dr*(A1601 + A2601*dr))*dtheta2) + 9*(A0601 + dr*(A1601 + A2601*dr))*dtheta4 +  dQ2*(A2221*dr2 + A3221*dr3 + A4221*dr4 + 6*A0421*dtheta2 + 6*A1421*dr*dtheta2 + 6*A2421*dr2*dtheta2 + 15*A0621*dtheta4) + 28*A0801*dtheta6));
-  d2A_dQ2   = 2*(28*dQ6*(A0080 + A1080*dr) + (A4020 + dr*(A5020 + dr*(A6020 + A7020*dr)))*dr4 + (A2220 + dr*(A3220 + dr*(A4220 + A5220*dr)))*dr2*dtheta2 +  9*dQ4*(A0060 + A1060*dr + (A2060 + A3060*dr)*dr2 + (A0260 + A1260*dr)*dtheta2) +  (A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2)*dtheta4 +  6*dQ2*((A2040 + A3040*dr)*dr2 + (A4040 + A5040*dr)*dr4 + (A0240 + dr*(A1240 + dr*(A2240 + A3240*dr)))*dtheta2 +  dQ2*(A0060 + A1060*dr + (A2060 + A3060*dr)*dr2 + (A0260 + A1260*dr)*dtheta2) + (A0440 + A1440*dr)*dtheta4) +  dR*(28*A0081*dQ6 + (A4021 + dr*(A5021 + A6021*dr))*dr4 + (A2221 + dr*(A3221 + A4221*dr))*dr2*dtheta2 +  9*dQ4*(A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2) + (A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2)*dtheta4 +  6*dQ2*((A2041 + A3041*dr)*dr2 + A4041*dr4 + (A0241 + dr*(A1241 + A2241*dr))*dtheta2 + dQ2*(A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2) +  A0441*dtheta4)));
-  d2A_dQR   = 2*dQ*(4*A0081*dQ6 + (A4021 + dr*(A5021 + A6021*dr))*dr4 + (A2221 + dr*(A3221 + A4221*dr))*dr2*dtheta2 +  dQ4*(A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2) + (A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2)*dtheta4 +  2*dQ2*((A2041 + A3041*dr)*dr2 + A4041*dr4 + (A0241 + dr*(A1241 + A2241*dr))*dtheta2 + dQ2*(A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2) +  A0441*dtheta4));
-
-  d2A_dtQ   = 2*dQ*(4*dQ6*(dAdt0080 + dAdt1080*dr) + (dAdt4020 + dr*(dAdt5020 + dr*(dAdt6020 + dAdt7020*dr)))*dr4 + (dAdt2220 + dr*(dAdt3220 + dr*(dAdt4220 + dAdt5220*dr)))*dr2*dtheta2 + dQ4*(dAdt0060 + dAdt1060*dr + (dAdt2060 + dAdt3060*dr)*dr2 + (dAdt0260 + dAdt1260*dr)*dtheta2) + (dAdt0420 + dAdt1420*dr + (dAdt2420 + dAdt3420*dr)*dr2 + (dAdt0620 + dAdt1620*dr)*dtheta2)*dtheta4 + 2*dQ2*((dAdt2040 + dAdt3040*dr)*dr2 + (dAdt4040 + dAdt5040*dr)*dr4 + (dAdt0240 + dr*(dAdt1240 + dr*(dAdt2240 + dAdt3240*dr)))*dtheta2 + dQ2*(dAdt0060 + dAdt1060*dr + (dAdt2060 + dAdt3060*dr)*dr2 + (dAdt0260 + dAdt1260*dr)*dtheta2) + (dAdt0440 + dAdt1440*dr)*dtheta4) + dR*(4*dAdt0081*dQ6 + (dAdt4021 + dr*(dAdt5021 + dAdt6021*dr))*dr4 + (dAdt2221 + dr*(dAdt3221 + dAdt4221*dr))*dr2*dtheta2 + dQ4*(dAdt0061 + dAdt1061*dr + dAdt2061*dr2 + dAdt0261*dtheta2) + (dAdt0421 + dAdt1421*dr + dAdt2421*dr2 + dAdt0621*dtheta2)*dtheta4 + 2*dQ2*((dAdt2041 + dAdt3041*dr)*dr2 + dAdt4041*dr4 + (dAdt0241 + dr*(dAdt1241 + dAdt2241*dr))*dtheta2 + dQ2*(dAdt0061 + dAdt1061*dr + dAdt2061*dr2 + dAdt0261*dtheta2) + dAdt0441*dtheta4)));
-  d2A_dtR   = dAdt0081*dQ8 + (dAdt6001 + dAdt7001*dr)*dr6 + dAdt8001*dr8 + (dAdt4201 + dr*(dAdt5201 + dAdt6201*dr))*dr4*dtheta2 + ((dAdt2401 + dAdt3401*dr)*dr2 + dAdt4401*dr4 + (dAdt0601 + dr*(dAdt1601 + dAdt2601*dr))*dtheta2)*dtheta4 + dQ4*((dAdt2041 + dAdt3041*dr)*dr2 + dAdt4041*dr4 + (dAdt0241 + dr*(dAdt1241 + dAdt2241*dr))*dtheta2 + dQ2*(dAdt0061 + dAdt1061*dr + dAdt2061*dr2 + dAdt0261*dtheta2) + dAdt0441*dtheta4) + dQ2*((dAdt4021 + dr*(dAdt5021 + dAdt6021*dr))*dr4 + (dAdt2221 + dr*(dAdt3221 + dAdt4221*dr))*dr2*dtheta2 + (dAdt0421 + dAdt1421*dr + dAdt2421*dr2 + dAdt0621*dtheta2)*dtheta4) + dAdt0801*dtheta8;
-  d2A_dtr   = dAdt1080*dQ8 + 6*(dAdt6000 + dAdt7000*dr)*dr5 + dAdt7000*dr6 + 8*(dAdt8000 + dAdt9000*dr)*dr7 + dAdt9000*dr8 + 4*(dAdt4200 + dr*(dAdt5200 + dr*(dAdt6200 + dAdt7200*dr)))*dr3*dtheta2 + (dAdt5200 + dr*(2*dAdt6200 + 3*dAdt7200*dr))*dr4*dtheta2 + (2*dAdt2400*dr + 3*dAdt3400*dr2 + 4*dAdt4400*dr3 + 5*dAdt5400*dr4 + dAdt1600*dtheta2 + 2*dAdt2600*dr*dtheta2 + 3*dAdt3600*dr2*dtheta2)*dtheta4 + dQ4*(2*dr*(dAdt2040 + dAdt3040*dr) + dAdt3040*dr2 + 4*(dAdt4040 + dAdt5040*dr)*dr3 + dAdt5040*dr4 + (dAdt1240 + dr*(2*dAdt2240 + 3*dAdt3240*dr))*dtheta2 + dQ2*(dAdt1060 + 2*dAdt2060*dr + 3*dAdt3060*dr2 + dAdt1260*dtheta2) + dAdt1440*dtheta4) + dR*(6*(dAdt6001 + dAdt7001*dr)*dr5 + dAdt7001*dr6 + 8*dAdt8001*dr7 + 4*(dAdt4201 + dr*(dAdt5201 + dAdt6201*dr))*dr3*dtheta2 + (dAdt5201 + 2*dAdt6201*dr)*dr4*dtheta2 + dQ4*(dQ2*(dAdt1061 + 2*dAdt2061*dr) + 2*dr*(dAdt2041 + dAdt3041*dr) + dAdt3041*dr2 + 4*dAdt4041*dr3 + (dAdt1241 + 2*dAdt2241*dr)*dtheta2) + (2*dAdt2401*dr + 3*dAdt3401*dr2 + 4*dAdt4401*dr3 + dAdt1601*dtheta2 + 2*dAdt2601*dr*dtheta2)*dtheta4 + dQ2*(4*dAdt4021*dr3 + 5*dAdt5021*dr4 + 6*dAdt6021*dr5 + 2*dAdt2221*dr*dtheta2 + 3*dAdt3221*dr2*dtheta2 + 4*dAdt4221*dr3*dtheta2 + dAdt1421*dtheta4 + 2*dAdt2421*dr*dtheta4)) + dQ2*(4*dAdt4020*dr3 + 5*dAdt5020*dr4 + 6*dAdt6020*dr5 + 7*dAdt7020*dr6 + 2*dAdt2220*dr*dtheta2 + 3*dAdt3220*dr2*dtheta2 + 4*dAdt4220*dr3*dtheta2 + 5*dAdt5220*dr4*dtheta2 + dAdt1420*dtheta4 + 2*dAdt2420*dr*dtheta4 + 3*dAdt3420*dr2*dtheta4 + dAdt1620*dtheta6) + dAdt1800*dtheta8;
-
-  d2A_dQr   = 2*dQ*(3*A1060*dQ4 + 4*A1080*dQ6 + 4*A2040*dQ2*dr + 6*A2060*dQ4*dr + 3*A1061*dQ4*dR + 4*A2041*dQ2*dr*dR + 6*A2061*dQ4*dr*dR + 6*A3040*dQ2*dr2 + 9*A3060*dQ4*dr2 + 6*A3041*dQ2*dR*dr2 + 4*A4020*dr3 + 8*A4040*dQ2*dr3 + 4*A4021*dR*dr3 + 8*A4041*dQ2*dR*dr3 + 5*A5020*dr4 + 10*A5040*dQ2*dr4 + 5*A5021*dR*dr4 + 6*A6020*dr5 + 6*A6021*dR*dr5 + 7*A7020*dr6 + 2*A1240*dQ2*dtheta2 + 3*A1260*dQ4*dtheta2 + 2*A2220*dr*dtheta2 + 4*A2240*dQ2*dr*dtheta2 + 2*A1241*dQ2*dR*dtheta2 + 2*A2221*dr*dR*dtheta2 + 4*A2241*dQ2*dr*dR*dtheta2 + 3*A3220*dr2*dtheta2 + 6*A3240*dQ2*dr2*dtheta2 + 3*A3221*dR*dr2*dtheta2 + 4*A4220*dr3*dtheta2 + 4*A4221*dR*dr3*dtheta2 + 5*A5220*dr4*dtheta2 + A1420*dtheta4 + 2*A1440*dQ2*dtheta4 + 2*A2420*dr*dtheta4 + A1421*dR*dtheta4 + 2*A2421*dr*dR*dtheta4 + 3*A3420*dr2*dtheta4 + A1620*dtheta6);
-  d2A_dRr   = 6*(A6001 + A7001*dr)*dr5 + A7001*dr6 + 8*A8001*dr7 + 4*(A4201 + dr*(A5201 + A6201*dr))*dr3*dtheta2 + (A5201 + 2*A6201*dr)*dr4*dtheta2 + dQ4*(dQ2*(A1061 + 2*A2061*dr) + 2*dr*(A2041 + A3041*dr) + A3041*dr2 + 4*A4041*dr3 + (A1241 + 2*A2241*dr)*dtheta2) + (2*A2401*dr + 3*A3401*dr2 + 4*A4401*dr3 + A1601*dtheta2 + 2*A2601*dr*dtheta2)*dtheta4 + dQ2*(4*A4021*dr3 + 5*A5021*dr4 + 6*A6021*dr5 + 2*A2221*dr*dtheta2 + 3*A3221*dr2*dtheta2 + 4*A4221*dr3*dtheta2 + A1421*dtheta4 + 2*A2421*dr*dtheta4);
-  d2A_dt2   = dQ8*(d2Adt20080 + d2Adt21080*dr) + (d2Adt26000 + d2Adt27000*dr)*dr6 + (d2Adt28000 + d2Adt29000*dr)*dr8 + (d2Adt24200 + dr*(d2Adt25200 + dr*(d2Adt26200 + d2Adt27200*dr)))*dr4*dtheta2 + ((d2Adt22400 + d2Adt23400*dr)*dr2 + (d2Adt24400 + d2Adt25400*dr)*dr4 + (d2Adt20600 + dr*(d2Adt21600 + dr*(d2Adt22600 + d2Adt23600*dr)))*dtheta2)*dtheta4 + dQ4*((d2Adt22040 + d2Adt23040*dr)*dr2 + (d2Adt24040 + d2Adt25040*dr)*dr4 + (d2Adt20240 + dr*(d2Adt21240 + dr*(d2Adt22240 + d2Adt23240*dr)))*dtheta2 + dQ2*(d2Adt20060 + d2Adt21060*dr + (d2Adt22060 + d2Adt23060*dr)*dr2 + (d2Adt20260 + d2Adt21260*dr)*dtheta2) + (d2Adt20440 + d2Adt21440*dr)*dtheta4) + dQ2*((d2Adt24020 + dr*(d2Adt25020 + dr*(d2Adt26020 + d2Adt27020*dr)))*dr4 + (d2Adt22220 + dr*(d2Adt23220 + dr*(d2Adt24220 + d2Adt25220*dr)))*dr2*dtheta2 + (d2Adt20420 + d2Adt21420*dr + (d2Adt22420 + d2Adt23420*dr)*dr2 + (d2Adt20620 + d2Adt21620*dr)*dtheta2)*dtheta4) + (d2Adt20800 + d2Adt21800*dr)*dtheta8 + dR*(d2Adt20081*dQ8 + (d2Adt26001 + d2Adt27001*dr)*dr6 + d2Adt28001*dr8 + (d2Adt24201 + dr*(d2Adt25201 + d2Adt26201*dr))*dr4*dtheta2 + ((d2Adt22401 + d2Adt23401*dr)*dr2 + d2Adt24401*dr4 + (d2Adt20601 + dr*(d2Adt21601 + d2Adt22601*dr))*dtheta2)*dtheta4 + dQ4*((d2Adt22041 + d2Adt23041*dr)*dr2 + d2Adt24041*dr4 + (d2Adt20241 + dr*(d2Adt21241 + d2Adt22241*dr))*dtheta2 + dQ2*(d2Adt20061 + d2Adt21061*dr + d2Adt22061*dr2 + d2Adt20261*dtheta2) + d2Adt20441*dtheta4) + dQ2*((d2Adt24021 + dr*(d2Adt25021 + d2Adt26021*dr))*dr4 + (d2Adt22221 + dr*(d2Adt23221 + d2Adt24221*dr))*dr2*dtheta2 + (d2Adt20421 + d2Adt21421*dr + d2Adt22421*dr2 + d2Adt20621*dtheta2)*dtheta4) + d2Adt20801*dtheta8);
-
   /* Convert partial derivatives to total derivatives */
   double DA_Dt    = dA_dt + dA_dQ*dQ_dt + dA_dR*dR_dt - dA_dr*rt;
   double DA_Dr    = dA_dr + dA_dQ*dQ_dr + dA_dR*dR_dr;
@@ -357,7 +515,6 @@ void effsource_calc(struct coordinate * x,
   d2A_dt2  = D2A_Dt2;
 
   /* s */
-  s2         = alpha20*dr2 + alpha02*dtheta2 + beta*dQ2;
 
   /* ds/dx */
   ds2_dr     = 2*alpha20*dr;
@@ -391,7 +548,6 @@ void effsource_calc(struct coordinate * x,
   d2s2_dtph = D2s2_Dtph;
   d2s2_dt2  = D2s2_Dt2;
 
-  sqrts2     = sqrt(s2);
   s2_15      = s2*sqrts2;
   s2_25      = s2*s2_15;
   s2_35      = s2*s2_25;
@@ -425,17 +581,13 @@ void effsource_calc(struct coordinate * x,
   d2PhiS_dthph = NAN;
 
   /* Box[PhiS] */
-  double sinth  = sin(theta);
-  double sinth2 = sinth*sinth;
-  double sin2th = sin(2*theta);
-  double cos2th = cos(2*theta);
   double r2 = r*r;
   double r3 = r2*r;
   double r4 = r2*r2;
   double a2 = a*a;
   double a4 = a2*a2;
 
-  *src = -((2*a2*dPhiS_dr - a2*d2PhiS_dph2 - a4*d2PhiS_dr2 - a2*d2PhiS_dth2 - 4*dPhiS_dr*r - 2*a2*dPhiS_dr*r +
+  src[0] = -((2*a2*dPhiS_dr - a2*d2PhiS_dph2 - a4*d2PhiS_dr2 - a2*d2PhiS_dth2 - 4*dPhiS_dr*r - 2*a2*dPhiS_dr*r +
          4*d2PhiS_dph2*r + 2*a*d2PhiS_dtph*r + 4*a2*d2PhiS_dr2*r + 2*d2PhiS_dth2*r + 6*dPhiS_dr*r2 - 2*d2PhiS_dph2*r2 - 4*d2PhiS_dr2*r2 -
          2*a2*d2PhiS_dr2*r2 - d2PhiS_dth2*r2 - 2*dPhiS_dr*r3 + 4*d2PhiS_dr2*r3 - d2PhiS_dr2*r4 +
          (a4*d2PhiS_dt2 + 4*a*d2PhiS_dtph*r + 2*d2PhiS_dt2*r4 + a2*d2PhiS_dt2*r*(2 + 3*r))*sinth2 +
@@ -445,174 +597,143 @@ void effsource_calc(struct coordinate * x,
          dPhiS_dth*r2*sin2th))/((sinth2*(a2 + (-2 + r)*r)*(a2 + 2*r2 + a2*cos2th)));
 
   dPhiS_dx[0] = dPhiS_dt;
-  dPhiS_dx[1] = dPhiS_dr;
-  dPhiS_dx[2] = dPhiS_dth;
-  dPhiS_dx[3] = dPhiS_dph;
+  dPhiS_dx[stride] = dPhiS_dr;
+  dPhiS_dx[2*stride] = dPhiS_dth;
+  dPhiS_dx[3*stride] = dPhiS_dph;
 
-  *PhiS = phi_s;
+  PhiS[0] = phi_s;
 
   d2PhiS_dx2[0] = d2PhiS_dt2;
-  d2PhiS_dx2[1] = d2PhiS_dtr;
-  d2PhiS_dx2[2] = d2PhiS_dtth;
-  d2PhiS_dx2[3] = d2PhiS_dtph;
-  d2PhiS_dx2[4] = d2PhiS_dr2;
-  d2PhiS_dx2[5] = d2PhiS_drth;
-  d2PhiS_dx2[6] = d2PhiS_drph;
-  d2PhiS_dx2[7] = d2PhiS_dth2;
-  d2PhiS_dx2[8] = d2PhiS_dthph;
-  d2PhiS_dx2[9] = d2PhiS_dph2;
+  d2PhiS_dx2[stride] = d2PhiS_dtr;
+  d2PhiS_dx2[2*stride] = d2PhiS_dtth;
+  d2PhiS_dx2[3*stride] = d2PhiS_dtph;
+  d2PhiS_dx2[4*stride] = d2PhiS_dr2;
+  d2PhiS_dx2[5*stride] = d2PhiS_drth;
+  d2PhiS_dx2[6*stride] = d2PhiS_drph;
+  d2PhiS_dx2[7*stride] = d2PhiS_dth2;
+  d2PhiS_dx2[8*stride] = d2PhiS_dthph;
+  d2PhiS_dx2[9*stride] = d2PhiS_dph2;
 }
 
-/* Compute the 2D singular field, its derivatives and its d'Alembertian */
-void effsource_calc_m(int m, struct coordinate * x,
+/* Numerator of the singular field and its partial derivatives from the
+   coefficients N of powers of Q computed by numerator_eval */
+static inline __attribute__ ((always_inline)) void calc_partials_eval(double N[2][8][5],
+  double Q, double R, struct calc_partials * p)
+{
+  const double Q2 = Q*Q;
+
+  p->A        = numerator_poly(N[0][0], Q2) + R*numerator_poly(N[1][0], Q2);
+  p->dA_dr    = numerator_poly(N[0][1], Q2) + R*numerator_poly(N[1][1], Q2);
+  p->d2A_dr2  = numerator_poly(N[0][2], Q2) + R*numerator_poly(N[1][2], Q2);
+  p->dA_dth   = numerator_poly(N[0][6], Q2) + R*numerator_poly(N[1][6], Q2);
+  p->d2A_dth2 = numerator_poly(N[0][7], Q2) + R*numerator_poly(N[1][7], Q2);
+  p->dA_dQ    = Q*(numerator_poly_d(N[0][0], Q2) + R*numerator_poly_d(N[1][0], Q2));
+  p->dA_dR    = numerator_poly(N[1][0], Q2);
+  p->d2A_dQ2  = numerator_poly_d2(N[0][0], Q2) + R*numerator_poly_d2(N[1][0], Q2);
+  p->d2A_dQR  = Q*numerator_poly_d(N[1][0], Q2);
+  p->d2A_dQr  = Q*(numerator_poly_d(N[0][1], Q2) + R*numerator_poly_d(N[1][1], Q2));
+  p->d2A_dRr  = numerator_poly(N[1][1], Q2);
+  p->dA_dt    = numerator_poly(N[0][3], Q2) + R*numerator_poly(N[1][3], Q2);
+  p->d2A_dt2  = numerator_poly(N[0][5], Q2) + R*numerator_poly(N[1][5], Q2);
+  p->d2A_dtQ  = Q*(numerator_poly_d(N[0][3], Q2) + R*numerator_poly_d(N[1][3], Q2));
+  p->d2A_dtR  = numerator_poly(N[1][3], Q2);
+  p->d2A_dtr  = numerator_poly(N[0][4], Q2) + R*numerator_poly(N[1][4], Q2);
+}
+
+/* Numerator of the singular field and its partial derivatives at a point */
+static inline __attribute__ ((always_inline)) void calc_partials_init(const struct effsource_ctx * ctx,
+  double dr, double dtheta, double dQ, double dR, struct calc_partials * p)
+{
+  double N[2][8][5];
+
+  numerator_eval(ctx, dr, dtheta, 1, N);
+  calc_partials_eval(N, dQ, dR, p);
+}
+
+/* Compute the singular field, its derivatives and its d'Alembertian */
+void effsource_calc_ctx(struct effsource_ctx * ctx, struct coordinate * x,
   double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
 {
-  const double r      = x->r;
-  const double theta  = x->theta;
-  const double rp     = xp.r;
-  const double thetap = xp.theta;
+  particle_dt_require(ctx);
 
-  const double dr     = r - rp;
-  const double dtheta = theta - thetap;
+  const double c = ctx->c;
 
-  double dr2 = dr*dr;
-  double dr3 = dr2*dr;
-  double dr4 = dr2*dr2;
-  double dr5 = dr3*dr2;
-  double dr6 = dr4*dr2;
-  double dr7 = dr4*dr3;
-  double dr8 = dr4*dr4;
-
-  const double dtheta2  = dtheta*dtheta;
-  const double dtheta3  = dtheta2*dtheta;
-  const double dtheta4  = dtheta2*dtheta2;
-  const double dtheta5  = dtheta3*dtheta2;
-  const double dtheta6  = dtheta4*dtheta2;
-  const double dtheta7  = dtheta4*dtheta3;
-  const double dtheta8  = dtheta4*dtheta4;
+  struct calc_partials p;
 
-  /* Coefficients of sin(dphi/2), sin(dphi) in the numerator */
+  double r      = x->r;
+  double theta  = x->theta;
+  double phi    = x->phi;
+  double rp     = ctx->xp.r;
+  double thetap = ctx->xp.theta;
+  double phip   = ctx->xp.phi;
+
+  double dr     = r - rp;
+  double dtheta = theta - thetap;
+  double dphi   = phi - phip;
+
+  double dphib  = dphi - c*dr;
+
+  double dQ  = sin(0.5*dphib);
+  double dR  = sin(dphib);
+
+  double dQ_dph = 0.5*cos(0.5*dphib);
+  double dR_dph = cos(dphib);
+
+  calc_partials_init(ctx, dr, dtheta, dQ, dR, &p);
+
+  /* Angular factors appearing in Box[PhiS] */
+  double sinth  = sin(theta);
+  double sinth2 = sinth*sinth;
+  double sin2th = sin(2*theta);
+  double cos2th = cos(2*theta);
+
+  /* s */
+  double s2 = ctx->alpha20*(dr*dr) + ctx->alpha02*(dtheta*dtheta) + ctx->beta*(dQ*dQ);
+
+  calc_finish(ctx, r, dr, dtheta, dQ, dQ_dph, dR, dR_dph, sinth2, sin2th, cos2th, &p, s2,
+    sqrt(s2), 1, PhiS, dPhiS_dx, d2PhiS_dx2, src);
+}
+
+/* Number of points processed together by effsource_calc_m_batch_ctx and
+   effsource_calc_m_grid_ctx, and passed to the callbacks of their _fn versions */
+#define MODE_POINT_BLOCK EFFSOURCE_LANES
+
+/* Quantities at a point (r, theta) which are common to all m-modes */
+struct mode_point {
+  double r, dr;
+  double sinth2, sin2th, cos2th;
+
+  /* Coefficients of sin(dphi/2), sin(dphi) in the numerator and their derivatives */
   double ReA[5], ImA[5], dReA_dt[5], dImA_dt[5], dReA_dr[5], dImA_dr[5], dReA_dtheta[5], dImA_dtheta[5];
-  double d2ReA_dt2[5], d2ImA_dt2[5], d2ReA_dtr[5], d2ImA_dtr[5], d2ReA_dr2[5], d2ImA_dr2[5], d2ReA_dtheta2[5], d2ImA_dtheta2[5];
-
-  ReA[0] = (A6000 + A7000*dr)*dr6 + (A8000 + A9000*dr)*dr8 + (A4200 + dr*(A5200 + dr*(A6200 + A7200*dr)))*dr4*dtheta2 + ((A2400 + A3400*dr)*dr2 + (A4400 + A5400*dr)*dr4 + (A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta2)*dtheta4 + (A0800 + A1800*dr)*dtheta8;
-  ImA[0] = (A6001 + A7001*dr)*dr6 + A8001*dr8 + (A4201 + dr*(A5201 + A6201*dr))*dr4*dtheta2 + ((A2401 + A3401*dr)*dr2 + A4401*dr4 + (A0601 + dr*(A1601 + A2601*dr))*dtheta2)*dtheta4 + A0801*dtheta8;
-  ReA[1] = (A4020 + dr*(A5020 + dr*(A6020 + A7020*dr)))*dr4 + (A2220 + dr*(A3220 + dr*(A4220 + A5220*dr)))*dr2*dtheta2 + (A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2)*dtheta4;
-  ImA[1] = (A4021 + dr*(A5021 + A6021*dr))*dr4 + (A2221 + dr*(A3221 + A4221*dr))*dr2*dtheta2 + (A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2)*dtheta4;
-  ReA[2] = (A2040 + A3040*dr)*dr2 + (A4040 + A5040*dr)*dr4 + (A0240 + dr*(A1240 + dr*(A2240 + A3240*dr)))*dtheta2 + (A0440 + A1440*dr)*dtheta4;
-  ImA[2] = (A2041 + A3041*dr)*dr2 + A4041*dr4 + (A0241 + dr*(A1241 + A2241*dr))*dtheta2 + A0441*dtheta4;
-  ReA[3] = A0060 + A1060*dr + (A2060 + A3060*dr)*dr2 + (A0260 + A1260*dr)*dtheta2;
-  ImA[3] = A0061 + A1061*dr + A2061*dr2 + A0261*dtheta2;
-  ReA[4] = A0080 + A1080*dr;
-  ImA[4] = A0081;
-
-  /* t derivatives of coefficients */
-  dReA_dt[0] = (dAdt6000 + dAdt7000*dr)*dr6 + (dAdt8000 + dAdt9000*dr)*dr8 + (dAdt4200 + dr*(dAdt5200 + dr*(dAdt6200 + dAdt7200*dr)))*dr4*dtheta2 + ((dAdt2400 + dAdt3400*dr)*dr2 + (dAdt4400 + dAdt5400*dr)*dr4 + (dAdt0600 + dr*(dAdt1600 + dr*(dAdt2600 + dAdt3600*dr)))*dtheta2)*dtheta4 + (dAdt0800 + dAdt1800*dr)*dtheta8;
-  dImA_dt[0] = (dAdt6001 + dAdt7001*dr)*dr6 + dAdt8001*dr8 + (dAdt4201 + dr*(dAdt5201 + dAdt6201*dr))*dr4*dtheta2 + ((dAdt2401 + dAdt3401*dr)*dr2 + dAdt4401*dr4 + (dAdt0601 + dr*(dAdt1601 + dAdt2601*dr))*dtheta2)*dtheta4 + dAdt0801*dtheta8;
-  dReA_dt[1] = (dAdt4020 + dr*(dAdt5020 + dr*(dAdt6020 + dAdt7020*dr)))*dr4 + (dAdt2220 + dr*(dAdt3220 + dr*(dAdt4220 + dAdt5220*dr)))*dr2*dtheta2 + (dAdt0420 + dAdt1420*dr + (dAdt2420 + dAdt3420*dr)*dr2 + (dAdt0620 + dAdt1620*dr)*dtheta2)*dtheta4;
-  dImA_dt[1] = (dAdt4021 + dr*(dAdt5021 + dAdt6021*dr))*dr4 + (dAdt2221 + dr*(dAdt3221 + dAdt4221*dr))*dr2*dtheta2 + (dAdt0421 + dAdt1421*dr + dAdt2421*dr2 + dAdt0621*dtheta2)*dtheta4;
-  dReA_dt[2] = (dAdt2040 + dAdt3040*dr)*dr2 + (dAdt4040 + dAdt5040*dr)*dr4 + (dAdt0240 + dr*(dAdt1240 + dr*(dAdt2240 + dAdt3240*dr)))*dtheta2 + (dAdt0440 + dAdt1440*dr)*dtheta4;
-  dImA_dt[2] = (dAdt2041 + dAdt3041*dr)*dr2 + dAdt4041*dr4 + (dAdt0241 + dr*(dAdt1241 + dAdt2241*dr))*dtheta2 + dAdt0441*dtheta4;
-  dReA_dt[3] = dAdt0060 + dAdt1060*dr + (dAdt2060 + dAdt3060*dr)*dr2 + (dAdt0260 + dAdt1260*dr)*dtheta2;
-  dImA_dt[3] = dAdt0061 + dAdt1061*dr + dAdt2061*dr2 + dAdt0261*dtheta2;
-  dReA_dt[4] = dAdt0080 + dAdt1080*dr;
-  dImA_dt[4] = dAdt0081;
-
-  /* t,r derivatives of coefficients */
-  d2ReA_dtr[0] = 6*dAdt6000*dr5 + 7*dAdt7000*dr6 + 8*dAdt8000*dr7 + 9*dAdt9000*dr8 + 4*dAdt4200*dr3*dtheta2 + 5*dAdt5200*dr4*dtheta2 + 6*dAdt6200*dr5*dtheta2 + 7*dAdt7200*dr6*dtheta2 + 2*dAdt2400*dr*dtheta4 + 3*dAdt3400*dr2*dtheta4 + 4*dAdt4400*dr3*dtheta4 + 5*dAdt5400*dr4*dtheta4 + dAdt1600*dtheta6 + 2*dAdt2600*dr*dtheta6 + 3*dAdt3600*dr2*dtheta6 + dAdt1800*dtheta8;
-  d2ImA_dtr[0] = 6*dAdt6001*dr5 + 7*dAdt7001*dr6 + 8*dAdt8001*dr7 + 4*dAdt4201*dr3*dtheta2 + 5*dAdt5201*dr4*dtheta2 + 6*dAdt6201*dr5*dtheta2 + 2*dAdt2401*dr*dtheta4 + 3*dAdt3401*dr2*dtheta4 + 4*dAdt4401*dr3*dtheta4 + dAdt1601*dtheta6 + 2*dAdt2601*dr*dtheta6;
-  d2ReA_dtr[1] = 4*dAdt4020*dr3 + 5*dAdt5020*dr4 + 6*dAdt6020*dr5 + 7*dAdt7020*dr6 + 2*dAdt2220*dr*dtheta2 + 3*dAdt3220*dr2*dtheta2 + 4*dAdt4220*dr3*dtheta2 + 5*dAdt5220*dr4*dtheta2 + dAdt1420*dtheta4 + 2*dAdt2420*dr*dtheta4 + 3*dAdt3420*dr2*dtheta4 + dAdt1620*dtheta6;
-  d2ImA_dtr[1] = 4*dAdt4021*dr3 + 5*dAdt5021*dr4 + 6*dAdt6021*dr5 + 2*dAdt2221*dr*dtheta2 + 3*dAdt3221*dr2*dtheta2 + 4*dAdt4221*dr3*dtheta2 + dAdt1421*dtheta4 + 2*dAdt2421*dr*dtheta4;
-  d2ReA_dtr[2] = 2*dAdt2040*dr + 3*dAdt3040*dr2 + 4*dAdt4040*dr3 + 5*dAdt5040*dr4 + dAdt1240*dtheta2 + 2*dAdt2240*dr*dtheta2 + 3*dAdt3240*dr2*dtheta2 + dAdt1440*dtheta4;
-  d2ImA_dtr[2] = 2*dAdt2041*dr + 3*dAdt3041*dr2 + 4*dAdt4041*dr3 + dAdt1241*dtheta2 + 2*dAdt2241*dr*dtheta2;
-  d2ReA_dtr[3] = dAdt1060 + 2*dAdt2060*dr + 3*dAdt3060*dr2 + dAdt1260*dtheta2;
-  d2ImA_dtr[3] = dAdt1061 + 2*dAdt2061*dr;
-  d2ReA_dtr[4] = dAdt1080;
-  d2ImA_dtr[4] = 0;
-
-  /* t,t derivatives of coefficients */
-  d2ReA_dt2[0] = (d2Adt26000 + d2Adt27000*dr)*dr6 + (d2Adt28000 + d2Adt29000*dr)*dr8 + (d2Adt24200 + dr*(d2Adt25200 + dr*(d2Adt26200 + d2Adt27200*dr)))*dr4*dtheta2 + ((d2Adt22400 + d2Adt23400*dr)*dr2 + (d2Adt24400 + d2Adt25400*dr)*dr4 + (d2Adt20600 + dr*(d2Adt21600 + dr*(d2Adt22600 + d2Adt23600*dr)))*dtheta2)*dtheta4 + (d2Adt20800 + d2Adt21800*dr)*dtheta8;
-  d2ImA_dt2[0] = (d2Adt26001 + d2Adt27001*dr)*dr6 + d2Adt28001*dr8 + (d2Adt24201 + dr*(d2Adt25201 + d2Adt26201*dr))*dr4*dtheta2 + ((d2Adt22401 + d2Adt23401*dr)*dr2 + d2Adt24401*dr4 + (d2Adt20601 + dr*(d2Adt21601 + d2Adt22601*dr))*dtheta2)*dtheta4 + d2Adt20801*dtheta8;
-  d2ReA_dt2[1] = (d2Adt24020 + dr*(d2Adt25020 + dr*(d2Adt26020 + d2Adt27020*dr)))*dr4 + (d2Adt22220 + dr*(d2Adt23220 + dr*(d2Adt24220 + d2Adt25220*dr)))*dr2*dtheta2 + (d2Adt20420 + d2Adt21420*dr + (d2Adt22420 + d2Adt23420*dr)*dr2 + (d2Adt20620 + d2Adt21620*dr)*dtheta2)*dtheta4;
-  d2ImA_dt2[1] = (d2Adt24021 + dr*(d2Adt25021 + d2Adt26021*dr))*dr4 + (d2Adt22221 + dr*(d2Adt23221 + d2Adt24221*dr))*dr2*dtheta2 + (d2Adt20421 + d2Adt21421*dr + d2Adt22421*dr2 + d2Adt20621*dtheta2)*dtheta4;
-  d2ReA_dt2[2] = (d2Adt22040 + d2Adt23040*dr)*dr2 + (d2Adt24040 + d2Adt25040*dr)*dr4 + (d2Adt20240 + dr*(d2Adt21240 + dr*(d2Adt22240 + d2Adt23240*dr)))*dtheta2 + (d2Adt20440 + d2Adt21440*dr)*dtheta4;
-  d2ImA_dt2[2] = (d2Adt22041 + d2Adt23041*dr)*dr2 + d2Adt24041*dr4 + (d2Adt20241 + dr*(d2Adt21241 + d2Adt22241*dr))*dtheta2 + d2Adt20441*dtheta4;
-  d2ReA_dt2[3] = d2Adt20060 + d2Adt21060*dr + (d2Adt22060 + d2Adt23060*dr)*dr2 + (d2Adt20260 + d2Adt21260*dr)*dtheta2;
-  d2ImA_dt2[3] = d2Adt20061 + d2Adt21061*dr + d2Adt22061*dr2 + d2Adt20261*dtheta2;
-  d2ReA_dt2[4] = d2Adt20080 + d2Adt21080*dr;
-  d2ImA_dt2[4] = d2Adt20081;
-
-  /* r derivatives of coefficients */
-  dReA_dr[0] = 6*A6000*dr5 + 7*A7000*dr6 + 8*A8000*dr7 + 9*A9000*dr8 + 4*A4200*dr3*dtheta2 + 5*A5200*dr4*dtheta2 + 6*A6200*dr5*dtheta2 + 7*A7200*dr6*dtheta2 + 2*A2400*dr*dtheta4 + 3*A3400*dr2*dtheta4 + 4*A4400*dr3*dtheta4 + 5*A5400*dr4*dtheta4 + A1600*dtheta6 + 2*A2600*dr*dtheta6 + 3*A3600*dr2*dtheta6 + A1800*dtheta8;
-  dImA_dr[0] = 6*A6001*dr5 + 7*A7001*dr6 + 8*A8001*dr7 + 4*A4201*dr3*dtheta2 + 5*A5201*dr4*dtheta2 + 6*A6201*dr5*dtheta2 + 2*A2401*dr*dtheta4 + 3*A3401*dr2*dtheta4 + 4*A4401*dr3*dtheta4 + A1601*dtheta6 + 2*A2601*dr*dtheta6;
-  dReA_dr[1] = 4*A4020*dr3 + 5*A5020*dr4 + 6*A6020*dr5 + 7*A7020*dr6 + 2*A2220*dr*dtheta2 + 3*A3220*dr2*dtheta2 + 4*A4220*dr3*dtheta2 + 5*A5220*dr4*dtheta2 + A1420*dtheta4 + 2*A2420*dr*dtheta4 + 3*A3420*dr2*dtheta4 + A1620*dtheta6;
-  dImA_dr[1] = 4*A4021*dr3 + 5*A5021*dr4 + 6*A6021*dr5 + 2*A2221*dr*dtheta2 + 3*A3221*dr2*dtheta2 + 4*A4221*dr3*dtheta2 + A1421*dtheta4 + 2*A2421*dr*dtheta4;
-  dReA_dr[2] = 2*A2040*dr + 3*A3040*dr2 + 4*A4040*dr3 + 5*A5040*dr4 + A1240*dtheta2 + 2*A2240*dr*dtheta2 + 3*A3240*dr2*dtheta2 + A1440*dtheta4;
-  dImA_dr[2] = 2*A2041*dr + 3*A3041*dr2 + 4*A4041*dr3 + A1241*dtheta2 + 2*A2241*dr*dtheta2;
-  dReA_dr[3] = A1060 + 2*A2060*dr + 3*A3060*dr2 + A1260*dtheta2;
-  dImA_dr[3] = A1061 + 2*A2061*dr;
-  dReA_dr[4] = A1080;
-  dImA_dr[4] = 0;
-
-  /* r,r derivatives of coefficients */
-  d2ReA_dr2[0] = 2*(15*A6000*dr4 + 21*A7000*dr5 + 28*A8000*dr6 + 36*A9000*dr7 + 6*A4200*dr2*dtheta2 + 10*A5200*dr3*dtheta2 + 15*A6200*dr4*dtheta2 + 21*A7200*dr5*dtheta2 + A2400*dtheta4 + 3*A3400*dr*dtheta4 + 6*A4400*dr2*dtheta4 + 10*A5400*dr3*dtheta4 + A2600*dtheta6 + 3*A3600*dr*dtheta6);
-  d2ImA_dr2[0] = 2*(15*A6001*dr4 + 21*A7001*dr5 + 28*A8001*dr6 + 6*A4201*dr2*dtheta2 + 10*A5201*dr3*dtheta2 + 15*A6201*dr4*dtheta2 + A2401*dtheta4 + 3*A3401*dr*dtheta4 + 6*A4401*dr2*dtheta4 + A2601*dtheta6);
-  d2ReA_dr2[1] = 2*(6*A4020*dr2 + 10*A5020*dr3 + 15*A6020*dr4 + 21*A7020*dr5 + A2220*dtheta2 + 3*A3220*dr*dtheta2 + 6*A4220*dr2*dtheta2 + 10*A5220*dr3*dtheta2 + A2420*dtheta4 + 3*A3420*dr*dtheta4);
-  d2ImA_dr2[1] = 2*(6*A4021*dr2 + 10*A5021*dr3 + 15*A6021*dr4 + A2221*dtheta2 + 3*A3221*dr*dtheta2 + 6*A4221*dr2*dtheta2 + A2421*dtheta4);
-  d2ReA_dr2[2] = 2*(A2040 + 3*A3040*dr + 6*A4040*dr2 + 10*A5040*dr3 + A2240*dtheta2 + 3*A3240*dr*dtheta2);
-  d2ImA_dr2[2] = 2*(A2041 + 3*A3041*dr + 6*A4041*dr2 + A2241*dtheta2);
-  d2ReA_dr2[3] = 2*(A2060 + 3*A3060*dr);
-  d2ImA_dr2[3] = 2*A2061;
-  d2ReA_dr2[4] = 0;
-  d2ImA_dr2[4] = 0;
-
-  /* theta derivatives of coefficients */
-  dReA_dtheta[0] = 2*(A4200 + dr*(A5200 + dr*(A6200 + A7200*dr)))*dr4*dtheta + 4*((A2400 + A3400*dr)*dr2 + (A4400 + A5400*dr)*dr4 + (A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta2)*dtheta3 + 2*(A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta5 + 8*(A0800 + A1800*dr)*dtheta7;
-  dImA_dtheta[0] = 2*(A4201 + dr*(A5201 + A6201*dr))*dr4*dtheta + 4*((A2401 + A3401*dr)*dr2 + A4401*dr4 + (A0601 + dr*(A1601 + A2601*dr))*dtheta2)*dtheta3 + 2*(A0601 + dr*(A1601 + A2601*dr))*dtheta5 + 8*A0801*dtheta7;
-  dReA_dtheta[1] = 2*dtheta*((A2220 + A3220*dr)*dr2 + (A4220 + A5220*dr)*dr4 + 2*dtheta2*(A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2) + (A0620 + A1620*dr)*dtheta4);
-  dImA_dtheta[1] = 2*dtheta*((A2221 + A3221*dr)*dr2 + A4221*dr4 + 2*dtheta2*(A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2) + A0621*dtheta4);
-  dReA_dtheta[2] = 2*dtheta*(A0240 + A1240*dr + (A2240 + A3240*dr)*dr2 + 2*(A0440 + A1440*dr)*dtheta2);
-  dImA_dtheta[2] = 2*dtheta*(A0241 + A1241*dr + A2241*dr2 + 2*A0441*dtheta2);
-  dReA_dtheta[3] = 2*(A0260 + A1260*dr)*dtheta;
-  dImA_dtheta[3] = 2*A0261*dtheta;
-  dReA_dtheta[4] = 0;
-  dImA_dtheta[4] = 0;
-
-  /* theta,theta derivatives of coefficients */
-  d2ReA_dtheta2[0] = 2*((A4200 + dr*(A5200 + dr*(A6200 + A7200*dr)))*dr4 + 6*dtheta2*((A2400 + A3400*dr)*dr2 + (A4400 + A5400*dr)*dr4 + (A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta2) + 9*(A0600 + dr*(A1600 + dr*(A2600 + A3600*dr)))*dtheta4 + 28*(A0800 + A1800*dr)*dtheta6);
-  d2ImA_dtheta2[0] = 2*((A4201 + dr*(A5201 + A6201*dr))*dr4 + 6*dtheta2*((A2401 + A3401*dr)*dr2 + A4401*dr4 + (A0601 + dr*(A1601 + A2601*dr))*dtheta2) + 9*(A0601 + dr*(A1601 + A2601*dr))*dtheta4 + 28*A0801*dtheta6);
-  d2ReA_dtheta2[1] = 2*((A2220 + A3220*dr)*dr2 + (A4220 + A5220*dr)*dr4 + 6*dtheta2*(A0420 + A1420*dr + (A2420 + A3420*dr)*dr2 + (A0620 + A1620*dr)*dtheta2) + 9*(A0620 + A1620*dr)*dtheta4);
-  d2ImA_dtheta2[1] = 2*((A2221 + A3221*dr)*dr2 + A4221*dr4 + 6*dtheta2*(A0421 + A1421*dr + A2421*dr2 + A0621*dtheta2) + 9*A0621*dtheta4);
-  d2ReA_dtheta2[2] = 2*(A0240 + A1240*dr + (A2240 + A3240*dr)*dr2 + 6*(A0440 + A1440*dr)*dtheta2);
-  d2ImA_dtheta2[2] = 2*(A0241 + A1241*dr + A2241*dr2 + 6*A0441*dtheta2);
-  d2ReA_dtheta2[3] = 2*(A0260 + A1260*dr);
-  d2ImA_dtheta2[3] = 2*A0261;
-  d2ReA_dtheta2[4] = 0;
-  d2ImA_dtheta2[4] = 0;
-
-  /* t derivatives of coefficients - add terms from derivatives of Delta r */
-  dReA_dt[0] -= dReA_dr[0]*rt;
-  dImA_dt[0] -= dImA_dr[0]*rt;
-  dReA_dt[1] -= dReA_dr[1]*rt;
-  dImA_dt[1] -= dImA_dr[1]*rt;
-  dReA_dt[2] -= dReA_dr[2]*rt;
-  dImA_dt[2] -= dImA_dr[2]*rt;
-  dReA_dt[3] -= dReA_dr[3]*rt;
-  dImA_dt[3] -= dImA_dr[3]*rt;
-  dReA_dt[4] -= dReA_dr[4]*rt;
-  dImA_dt[4] -= dImA_dr[4]*rt;
-
-  /* t,t derivatives of coefficients - add terms from derivatives of Delta r */
-  d2ReA_dt2[0] += - dReA_dr[0]*rtt + d2ReA_dr2[0]*rt*rt - 2*d2ReA_dtr[0]*rt;
-  d2ImA_dt2[0] += - dImA_dr[0]*rtt + d2ImA_dr2[0]*rt*rt - 2*d2ImA_dtr[0]*rt;
-  d2ReA_dt2[1] += - dReA_dr[1]*rtt + d2ReA_dr2[1]*rt*rt - 2*d2ReA_dtr[1]*rt;
-  d2ImA_dt2[1] += - dImA_dr[1]*rtt + d2ImA_dr2[1]*rt*rt - 2*d2ImA_dtr[1]*rt;
-  d2ReA_dt2[2] += - dReA_dr[2]*rtt + d2ReA_dr2[2]*rt*rt - 2*d2ReA_dtr[2]*rt;
-  d2ImA_dt2[2] += - dImA_dr[2]*rtt + d2ImA_dr2[2]*rt*rt - 2*d2ImA_dtr[2]*rt;
-  d2ReA_dt2[3] += - dReA_dr[3]*rtt + d2ReA_dr2[3]*rt*rt - 2*d2ReA_dtr[3]*rt;
-  d2ImA_dt2[3] += - dImA_dr[3]*rtt + d2ImA_dr2[3]*rt*rt - 2*d2ImA_dtr[3]*rt;
-  d2ReA_dt2[4] += - dReA_dr[4]*rtt + d2ReA_dr2[4]*rt*rt - 2*d2ReA_dtr[4]*rt;
-  d2ImA_dt2[4] += - dImA_dr[4]*rtt + d2ImA_dr2[4]*rt*rt - 2*d2ImA_dtr[4]*rt;
+  double d2ReA_dt2[5], d2ImA_dt2[5], d2ReA_dr2[5], d2ImA_dr2[5], d2ReA_dtheta2[5], d2ImA_dtheta2[5];
+
+  /* alpha/beta and its derivatives */
+  double C1, dC1_dr, d2C1_dr2, dC1_dtheta, d2C1_dtheta2, dC1_dt, d2C1_dt2;
+
+  /* Elliptic integrals and their derivatives */
+  double ellip[2], dellip_dr[2], dellip_dtheta[2], dellip_dt[2], d2ellip_dr2[2], d2ellip_dtheta2[2], d2ellip_dt2[2];
+
+  /* Denominators and their derivatives */
+  double DenRePhiSb, dDenRePhiSb_dr, dDenRePhiSb_dtheta, dDenRePhiSb_dt, d2DenRePhiSb_dr2,
+         d2DenRePhiSb_dtheta2, d2DenRePhiSb_dt2, DenImPhiSb, dDenImPhiSb_dr, dDenImPhiSb_dtheta,
+         dDenImPhiSb_dt, d2DenImPhiSb_dr2, d2DenImPhiSb_dtheta2, d2DenImPhiSb_dt2;
+};
+
+/* Compute alpha/beta, the denominators and their derivatives at the point
+   displaced by (dr, dtheta) from the particle */
+static void mode_point_denom(const struct effsource_ctx * ctx, double dr, double dtheta,
+  struct mode_point * p)
+{
+  const double alpha20 = ctx->alpha20, alpha02 = ctx->alpha02, beta = ctx->beta,
+               dalphadt20 = ctx->dalphadt20, dalphadt02 = ctx->dalphadt02, dbetadt = ctx->dbetadt,
+               d2alphadt220 = ctx->d2alphadt220, d2alphadt202 = ctx->d2alphadt202,
+               d2betadt2 = ctx->d2betadt2, rt = ctx->rt, rtt = ctx->rtt, dC1_dt02 = ctx->dC1_dt02,
+               dC1_dt10 = ctx->dC1_dt10, dC1_dt20 = ctx->dC1_dt20, d2C1_dt200 = ctx->d2C1_dt200,
+               d2C1_dt202 = ctx->d2C1_dt202, d2C1_dt210 = ctx->d2C1_dt210,
+               d2C1_dt220 = ctx->d2C1_dt220;
+
+  const double dr2     = dr*dr;
+  const double dtheta2 = dtheta*dtheta;
 
   /* alpha term appearing in the denominator */
   double alpha = alpha20*dr2 + alpha02*dtheta2;
@@ -629,34 +750,8 @@ void effsource_calc_m(int m, struct coordinate * x,
   const double beta_inv = 1.0 / beta;
   const double C1 = alpha * beta_inv;
 
-  double C[27];
-  C[0]  = 1;
-  C[1]  = C1;
-  C[2]  = C1*C1;
-  C[3]  = C[2]*C[1];
-  C[4]  = C[2]*C[2];
-  C[5]  = C[3]*C[2];
-  C[6]  = C[3]*C[3];
-  C[7]  = C[4]*C[3];
-  C[8]  = C[4]*C[4];
-  C[9]  = C[5]*C[4];
-  C[10] = C[5]*C[5];
-  C[11] = C[6]*C[5];
-  C[12] = C[6]*C[6];
-  C[13] = C[7]*C[6];
-  C[14] = C[7]*C[7];
-  C[15] = C[8]*C[7];
-  C[16] = C[8]*C[8];
-  C[17] = C[9]*C[8];
-  C[18] = C[9]*C[9];
-  C[19] = C[10]*C[9];
-  C[20] = C[10]*C[10];
-  C[21] = C[11]*C[10];
-  C[22] = C[11]*C[11];
-  C[23] = C[12]*C[11];
-  C[24] = C[12]*C[12];
-  C[25] = C[13]*C[12];
-  C[26] = C[13]*C[13];
+  const double C2 = C1*C1;
+  const double C3 = C2*C1;
 
   double dC1_dr       = dalpha_dr * beta_inv;
   double d2C1_dr2     = d2alpha_dr2 * beta_inv;
@@ -665,185 +760,105 @@ void effsource_calc_m(int m, struct coordinate * x,
   double dC1_dt       = dC1_dt02*dtheta2 + dC1_dt10*dr + dC1_dt20*dr2;
   double d2C1_dt2     = d2C1_dt200 + d2C1_dt202*dtheta2 + d2C1_dt210*dr + d2C1_dt220*dr2;
 
-  double dC_dr[27];
-  dC_dr[0]  = 0;
-  dC_dr[1]  = 1*C[0]*dC1_dr;
-  dC_dr[2]  = 2*C[1]*dC1_dr;
-  dC_dr[3]  = 3*C[2]*dC1_dr;
-  dC_dr[4]  = 4*C[3]*dC1_dr;
-  dC_dr[5]  = 5*C[4]*dC1_dr;
-  dC_dr[6]  = 6*C[5]*dC1_dr;
-  dC_dr[7]  = 7*C[6]*dC1_dr;
-  dC_dr[8]  = 8*C[7]*dC1_dr;
-  dC_dr[9]  = 9*C[8]*dC1_dr;
-  dC_dr[10] = 10*C[9]*dC1_dr;
-  dC_dr[11] = 11*C[10]*dC1_dr;
-  dC_dr[12] = 12*C[11]*dC1_dr;
-  dC_dr[13] = 13*C[12]*dC1_dr;
-  dC_dr[14] = 14*C[13]*dC1_dr;
-  dC_dr[15] = 15*C[14]*dC1_dr;
-  dC_dr[16] = 16*C[15]*dC1_dr;
-  dC_dr[17] = 17*C[16]*dC1_dr;
-  dC_dr[18] = 18*C[17]*dC1_dr;
-  dC_dr[19] = 19*C[18]*dC1_dr;
-  dC_dr[20] = 20*C[19]*dC1_dr;
-  dC_dr[21] = 21*C[20]*dC1_dr;
-  dC_dr[22] = 22*C[21]*dC1_dr;
-  dC_dr[23] = 23*C[22]*dC1_dr;
-  dC_dr[24] = 24*C[23]*dC1_dr;
-  dC_dr[25] = 25*C[24]*dC1_dr;
-  dC_dr[26] = 26*C[25]*dC1_dr;
-
-  double d2C_dr2[27];
-  d2C_dr2[0]  = 0;
-  d2C_dr2[1]  = d2C1_dr2;
-  d2C_dr2[2]  = 2*1*C[0]*dC1_dr*dC1_dr + 2*C[1]*d2C1_dr2;
-  d2C_dr2[3]  = 3*2*C[1]*dC1_dr*dC1_dr + 3*C[2]*d2C1_dr2;
-  d2C_dr2[4]  = 4*3*C[2]*dC1_dr*dC1_dr + 4*C[3]*d2C1_dr2;
-  d2C_dr2[5]  = 5*4*C[3]*dC1_dr*dC1_dr + 5*C[4]*d2C1_dr2;
-  d2C_dr2[6]  = 6*5*C[4]*dC1_dr*dC1_dr + 6*C[5]*d2C1_dr2;
-  d2C_dr2[7]  = 7*6*C[5]*dC1_dr*dC1_dr + 7*C[6]*d2C1_dr2;
-  d2C_dr2[8]  = 8*7*C[6]*dC1_dr*dC1_dr + 8*C[7]*d2C1_dr2;
-  d2C_dr2[9]  = 9*8*C[7]*dC1_dr*dC1_dr + 9*C[8]*d2C1_dr2;
-  d2C_dr2[10] = 10*9*C[8]*dC1_dr*dC1_dr + 10*C[9]*d2C1_dr2;
-  d2C_dr2[11] = 11*10*C[9]*dC1_dr*dC1_dr + 11*C[10]*d2C1_dr2;
-  d2C_dr2[12] = 12*11*C[10]*dC1_dr*dC1_dr + 12*C[11]*d2C1_dr2;
-  d2C_dr2[13] = 13*12*C[11]*dC1_dr*dC1_dr + 13*C[12]*d2C1_dr2;
-  d2C_dr2[14] = 14*13*C[12]*dC1_dr*dC1_dr + 14*C[13]*d2C1_dr2;
-  d2C_dr2[15] = 15*14*C[13]*dC1_dr*dC1_dr + 15*C[14]*d2C1_dr2;
-  d2C_dr2[16] = 16*15*C[14]*dC1_dr*dC1_dr + 16*C[15]*d2C1_dr2;
-  d2C_dr2[17] = 17*16*C[15]*dC1_dr*dC1_dr + 17*C[16]*d2C1_dr2;
-  d2C_dr2[18] = 18*17*C[16]*dC1_dr*dC1_dr + 18*C[17]*d2C1_dr2;
-  d2C_dr2[19] = 19*18*C[17]*dC1_dr*dC1_dr + 19*C[18]*d2C1_dr2;
-  d2C_dr2[20] = 20*19*C[18]*dC1_dr*dC1_dr + 20*C[19]*d2C1_dr2;
-  d2C_dr2[21] = 21*20*C[19]*dC1_dr*dC1_dr + 21*C[20]*d2C1_dr2;
-  d2C_dr2[22] = 22*21*C[20]*dC1_dr*dC1_dr + 22*C[21]*d2C1_dr2;
-  d2C_dr2[23] = 23*22*C[21]*dC1_dr*dC1_dr + 23*C[22]*d2C1_dr2;
-  d2C_dr2[24] = 24*23*C[22]*dC1_dr*dC1_dr + 24*C[23]*d2C1_dr2;
-  d2C_dr2[25] = 25*24*C[23]*dC1_dr*dC1_dr + 25*C[24]*d2C1_dr2;
-  d2C_dr2[26] = 26*25*C[24]*dC1_dr*dC1_dr + 26*C[25]*d2C1_dr2;
-
-  double dC_dtheta[27];
-  dC_dtheta[0]  = 0;
-  dC_dtheta[1]  = 1*C[0]*dC1_dtheta;
-  dC_dtheta[2]  = 2*C[1]*dC1_dtheta;
-  dC_dtheta[3]  = 3*C[2]*dC1_dtheta;
-  dC_dtheta[4]  = 4*C[3]*dC1_dtheta;
-  dC_dtheta[5]  = 5*C[4]*dC1_dtheta;
-  dC_dtheta[6]  = 6*C[5]*dC1_dtheta;
-  dC_dtheta[7]  = 7*C[6]*dC1_dtheta;
-  dC_dtheta[8]  = 8*C[7]*dC1_dtheta;
-  dC_dtheta[9]  = 9*C[8]*dC1_dtheta;
-  dC_dtheta[10] = 10*C[9]*dC1_dtheta;
-  dC_dtheta[11] = 11*C[10]*dC1_dtheta;
-  dC_dtheta[12] = 12*C[11]*dC1_dtheta;
-  dC_dtheta[13] = 13*C[12]*dC1_dtheta;
-  dC_dtheta[14] = 14*C[13]*dC1_dtheta;
-  dC_dtheta[15] = 15*C[14]*dC1_dtheta;
-  dC_dtheta[16] = 16*C[15]*dC1_dtheta;
-  dC_dtheta[17] = 17*C[16]*dC1_dtheta;
-  dC_dtheta[18] = 18*C[17]*dC1_dtheta;
-  dC_dtheta[19] = 19*C[18]*dC1_dtheta;
-  dC_dtheta[20] = 20*C[19]*dC1_dtheta;
-  dC_dtheta[21] = 21*C[20]*dC1_dtheta;
-  dC_dtheta[22] = 22*C[21]*dC1_dtheta;
-  dC_dtheta[23] = 23*C[22]*dC1_dtheta;
-  dC_dtheta[24] = 24*C[23]*dC1_dtheta;
-  dC_dtheta[25] = 25*C[24]*dC1_dtheta;
-  dC_dtheta[26] = 26*C[25]*dC1_dtheta;
-
-  double d2C_dtheta2[27];
-  d2C_dtheta2[0]  = 0;
-  d2C_dtheta2[1]  = d2C1_dtheta2;
-  d2C_dtheta2[2]  = 2*1*C[0]*dC1_dtheta*dC1_dtheta + 2*C[1]*d2C1_dtheta2;
-  d2C_dtheta2[3]  = 3*2*C[1]*dC1_dtheta*dC1_dtheta + 3*C[2]*d2C1_dtheta2;
-  d2C_dtheta2[4]  = 4*3*C[2]*dC1_dtheta*dC1_dtheta + 4*C[3]*d2C1_dtheta2;
-  d2C_dtheta2[5]  = 5*4*C[3]*dC1_dtheta*dC1_dtheta + 5*C[4]*d2C1_dtheta2;
-  d2C_dtheta2[6]  = 6*5*C[4]*dC1_dtheta*dC1_dtheta + 6*C[5]*d2C1_dtheta2;
-  d2C_dtheta2[7]  = 7*6*C[5]*dC1_dtheta*dC1_dtheta + 7*C[6]*d2C1_dtheta2;
-  d2C_dtheta2[8]  = 8*7*C[6]*dC1_dtheta*dC1_dtheta + 8*C[7]*d2C1_dtheta2;
-  d2C_dtheta2[9]  = 9*8*C[7]*dC1_dtheta*dC1_dtheta + 9*C[8]*d2C1_dtheta2;
-  d2C_dtheta2[10] = 10*9*C[8]*dC1_dtheta*dC1_dtheta + 10*C[9]*d2C1_dtheta2;
-  d2C_dtheta2[11] = 11*10*C[9]*dC1_dtheta*dC1_dtheta + 11*C[10]*d2C1_dtheta2;
-  d2C_dtheta2[12] = 12*11*C[10]*dC1_dtheta*dC1_dtheta + 12*C[11]*d2C1_dtheta2;
-  d2C_dtheta2[13] = 13*12*C[11]*dC1_dtheta*dC1_dtheta + 13*C[12]*d2C1_dtheta2;
-  d2C_dtheta2[14] = 14*13*C[12]*dC1_dtheta*dC1_dtheta + 14*C[13]*d2C1_dtheta2;
-  d2C_dtheta2[15] = 15*14*C[13]*dC1_dtheta*dC1_dtheta + 15*C[14]*d2C1_dtheta2;
-  d2C_dtheta2[16] = 16*15*C[14]*dC1_dtheta*dC1_dtheta + 16*C[15]*d2C1_dtheta2;
-  d2C_dtheta2[17] = 17*16*C[15]*dC1_dtheta*dC1_dtheta + 17*C[16]*d2C1_dtheta2;
-  d2C_dtheta2[18] = 18*17*C[16]*dC1_dtheta*dC1_dtheta + 18*C[17]*d2C1_dtheta2;
-  d2C_dtheta2[19] = 19*18*C[17]*dC1_dtheta*dC1_dtheta + 19*C[18]*d2C1_dtheta2;
-  d2C_dtheta2[20] = 20*19*C[18]*dC1_dtheta*dC1_dtheta + 20*C[19]*d2C1_dtheta2;
-  d2C_dtheta2[21] = 21*20*C[19]*dC1_dtheta*dC1_dtheta + 21*C[20]*d2C1_dtheta2;
-  d2C_dtheta2[22] = 22*21*C[20]*dC1_dtheta*dC1_dtheta + 22*C[21]*d2C1_dtheta2;
-  d2C_dtheta2[23] = 23*22*C[21]*dC1_dtheta*dC1_dtheta + 23*C[22]*d2C1_dtheta2;
-  d2C_dtheta2[24] = 24*23*C[22]*dC1_dtheta*dC1_dtheta + 24*C[23]*d2C1_dtheta2;
-  d2C_dtheta2[25] = 25*24*C[23]*dC1_dtheta*dC1_dtheta + 25*C[24]*d2C1_dtheta2;
-  d2C_dtheta2[26] = 26*25*C[24]*dC1_dtheta*dC1_dtheta + 26*C[25]*d2C1_dtheta2;
-
-  double dC_dt[27];
-  dC_dt[0]  = 0;
-  dC_dt[1]  = 1*C[0]*dC1_dt;
-  dC_dt[2]  = 2*C[1]*dC1_dt;
-  dC_dt[3]  = 3*C[2]*dC1_dt;
-  dC_dt[4]  = 4*C[3]*dC1_dt;
-  dC_dt[5]  = 5*C[4]*dC1_dt;
-  dC_dt[6]  = 6*C[5]*dC1_dt;
-  dC_dt[7]  = 7*C[6]*dC1_dt;
-  dC_dt[8]  = 8*C[7]*dC1_dt;
-  dC_dt[9]  = 9*C[8]*dC1_dt;
-  dC_dt[10] = 10*C[9]*dC1_dt;
-  dC_dt[11] = 11*C[10]*dC1_dt;
-  dC_dt[12] = 12*C[11]*dC1_dt;
-  dC_dt[13] = 13*C[12]*dC1_dt;
-  dC_dt[14] = 14*C[13]*dC1_dt;
-  dC_dt[15] = 15*C[14]*dC1_dt;
-  dC_dt[16] = 16*C[15]*dC1_dt;
-  dC_dt[17] = 17*C[16]*dC1_dt;
-  dC_dt[18] = 18*C[17]*dC1_dt;
-  dC_dt[19] = 19*C[18]*dC1_dt;
-  dC_dt[20] = 20*C[19]*dC1_dt;
-  dC_dt[21] = 21*C[20]*dC1_dt;
-  dC_dt[22] = 22*C[21]*dC1_dt;
-  dC_dt[23] = 23*C[22]*dC1_dt;
-  dC_dt[24] = 24*C[23]*dC1_dt;
-  dC_dt[25] = 25*C[24]*dC1_dt;
-  dC_dt[26] = 26*C[25]*dC1_dt;
-
-  double d2C_dt2[27];
-  d2C_dt2[0]  = 0;
-  d2C_dt2[1]  = d2C1_dt2;
-  d2C_dt2[2]  = 2*1*C[0]*dC1_dt*dC1_dt + 2*C[1]*d2C1_dt2;
-  d2C_dt2[3]  = 3*2*C[1]*dC1_dt*dC1_dt + 3*C[2]*d2C1_dt2;
-  d2C_dt2[4]  = 4*3*C[2]*dC1_dt*dC1_dt + 4*C[3]*d2C1_dt2;
-  d2C_dt2[5]  = 5*4*C[3]*dC1_dt*dC1_dt + 5*C[4]*d2C1_dt2;
-  d2C_dt2[6]  = 6*5*C[4]*dC1_dt*dC1_dt + 6*C[5]*d2C1_dt2;
-  d2C_dt2[7]  = 7*6*C[5]*dC1_dt*dC1_dt + 7*C[6]*d2C1_dt2;
-  d2C_dt2[8]  = 8*7*C[6]*dC1_dt*dC1_dt + 8*C[7]*d2C1_dt2;
-  d2C_dt2[9]  = 9*8*C[7]*dC1_dt*dC1_dt + 9*C[8]*d2C1_dt2;
-  d2C_dt2[10] = 10*9*C[8]*dC1_dt*dC1_dt + 10*C[9]*d2C1_dt2;
-  d2C_dt2[11] = 11*10*C[9]*dC1_dt*dC1_dt + 11*C[10]*d2C1_dt2;
-  d2C_dt2[12] = 12*11*C[10]*dC1_dt*dC1_dt + 12*C[11]*d2C1_dt2;
-  d2C_dt2[13] = 13*12*C[11]*dC1_dt*dC1_dt + 13*C[12]*d2C1_dt2;
-  d2C_dt2[14] = 14*13*C[12]*dC1_dt*dC1_dt + 14*C[13]*d2C1_dt2;
-  d2C_dt2[15] = 15*14*C[13]*dC1_dt*dC1_dt + 15*C[14]*d2C1_dt2;
-  d2C_dt2[16] = 16*15*C[14]*dC1_dt*dC1_dt + 16*C[15]*d2C1_dt2;
-  d2C_dt2[17] = 17*16*C[15]*dC1_dt*dC1_dt + 17*C[16]*d2C1_dt2;
-  d2C_dt2[18] = 18*17*C[16]*dC1_dt*dC1_dt + 18*C[17]*d2C1_dt2;
-  d2C_dt2[19] = 19*18*C[17]*dC1_dt*dC1_dt + 19*C[18]*d2C1_dt2;
-  d2C_dt2[20] = 20*19*C[18]*dC1_dt*dC1_dt + 20*C[19]*d2C1_dt2;
-  d2C_dt2[21] = 21*20*C[19]*dC1_dt*dC1_dt + 21*C[20]*d2C1_dt2;
-  d2C_dt2[22] = 22*21*C[20]*dC1_dt*dC1_dt + 22*C[21]*d2C1_dt2;
-  d2C_dt2[23] = 23*22*C[21]*dC1_dt*dC1_dt + 23*C[22]*d2C1_dt2;
-  d2C_dt2[24] = 24*23*C[22]*dC1_dt*dC1_dt + 24*C[23]*d2C1_dt2;
-  d2C_dt2[25] = 25*24*C[23]*dC1_dt*dC1_dt + 25*C[24]*d2C1_dt2;
-  d2C_dt2[26] = 26*25*C[24]*dC1_dt*dC1_dt + 26*C[25]*d2C1_dt2;
+  p->C1           = C1;
+  p->dC1_dr       = dC1_dr;
+  p->d2C1_dr2     = d2C1_dr2;
+  p->dC1_dtheta   = dC1_dtheta;
+  p->d2C1_dtheta2 = d2C1_dtheta2;
+  p->dC1_dt       = dC1_dt;
+  p->d2C1_dt2     = d2C1_dt2;
+
+  /* Denominator - there is a different denominator for real and imaginary parts */
+  double alpha_plus_beta_10 = alpha+beta;
+  double alpha_plus_beta_05 = sqrt(alpha_plus_beta_10);
+  double alpha_plus_beta_15 = alpha_plus_beta_10*alpha_plus_beta_05;
+  double alpha_plus_beta_20 = alpha_plus_beta_10*alpha_plus_beta_10;
+  double alpha_plus_beta_25 = alpha_plus_beta_10*alpha_plus_beta_15;
+
+  double beta_2 = beta*beta;
+
+  p->DenRePhiSb         = beta*C3*alpha_plus_beta_25/4.0;
+  p->dDenRePhiSb_dr     = beta*(6.0*C2*alpha_plus_beta_25*dC1_dr + C3*5.0*alpha_plus_beta_15*dalpha_dr)/8.0;
+  p->dDenRePhiSb_dtheta = beta*(6.0*C2*alpha_plus_beta_25*dC1_dtheta + C3*5.0*alpha_plus_beta_15*dalpha_dtheta)/8.0;
+  p->dDenRePhiSb_dt     = (alpha_plus_beta_15*C2*(6*dC1_dt*beta*alpha_plus_beta_10 + 5*(dalpha_dt + dbetadt)*beta*C1 + 2*dbetadt*alpha_plus_beta_10*C1))/8.0;
+  p->d2DenRePhiSb_dr2   = beta*C1*alpha_plus_beta_05*(24*alpha_plus_beta_20*dC1_dr*dC1_dr + 60.0*C1*(alpha+beta)*dalpha_dr*dC1_dr + C1*(12.0*alpha_plus_beta_20*d2C1_dr2 + 5.0*C1*(3.0*dalpha_dr*dalpha_dr + 2.0*(alpha+beta)*d2alpha_dr2)))/16.0;
+  p->d2DenRePhiSb_dtheta2  = beta*C1*alpha_plus_beta_05*(24*alpha_plus_beta_20*dC1_dtheta*dC1_dtheta + 60.0*C1*(alpha+beta)*dalpha_dtheta*dC1_dtheta + C1*(12.0*alpha_plus_beta_20*d2C1_dtheta2 + 5.0*C1*(3.0*dalpha_dtheta*dalpha_dtheta + 2.0*(alpha+beta)*d2alpha_dtheta2)))/16.0;
+  p->d2DenRePhiSb_dt2   = (alpha_plus_beta_05*C1*(4*alpha_plus_beta_20*C2*d2betadt2 + 10*beta*alpha_plus_beta_10*C2*(d2alpha_dt2 + d2betadt2) + 12*beta*alpha_plus_beta_20*C1*d2C1_dt2 + 20*alpha_plus_beta_10*C2*dbetadt*(dalpha_dt + dbetadt) + 15*beta*C2*(dalpha_dt + dbetadt)*(dalpha_dt + dbetadt) + 24*alpha_plus_beta_20*C1*dbetadt*dC1_dt + 60*beta*alpha_plus_beta_10*C1*(dalpha_dt + dbetadt)*dC1_dt + 24*beta*alpha_plus_beta_20*dC1_dt*dC1_dt))/16.0;
+
+  p->DenImPhiSb           = -(beta_2*C2*alpha_plus_beta_15)/32.0;
+  p->dDenImPhiSb_dr       = -(beta_2*C1*alpha_plus_beta_05*(4.0*alpha_plus_beta_10*dC1_dr + 3*C1*dalpha_dr))/64.;
+  p->dDenImPhiSb_dtheta   = -(beta_2*C1*alpha_plus_beta_05*(4.0*alpha_plus_beta_10*dC1_dtheta + 3*C1*dalpha_dtheta))/64.;
+  p->dDenImPhiSb_dt       = (beta*alpha_plus_beta_05*C1*(-4*dC1_dt*beta*alpha_plus_beta_10 - 3*(dalpha_dt + dbetadt)*beta*C1 - 4*dbetadt*alpha_plus_beta_10*C1))/64.0;
+  p->d2DenImPhiSb_dr2     = -(beta_2*(C1*(8*alpha_plus_beta_20*d2C1_dr2 + 3.0*C1*(2.0*alpha_plus_beta_10*d2alpha_dr2 + dalpha_dr*dalpha_dr)) + 24.0*alpha_plus_beta_10*C1*dalpha_dr*dC1_dr + 8.0*alpha_plus_beta_20*dC1_dr*dC1_dr))/(128.*alpha_plus_beta_05);
+  p->d2DenImPhiSb_dtheta2 = -(beta_2*(C1*(8*alpha_plus_beta_20*d2C1_dtheta2 + 3.0*C1*(2.0*alpha_plus_beta_10*d2alpha_dtheta2 + dalpha_dtheta*dalpha_dtheta)) + 24.0*alpha_plus_beta_10*C1*dalpha_dtheta*dC1_dtheta + 8.0*alpha_plus_beta_20*dC1_dtheta*dC1_dtheta))/(128.*alpha_plus_beta_05);
+  p->d2DenImPhiSb_dt2     = (-3*beta_2*C2*dalpha_dt*dalpha_dt - (8*alpha*alpha + 40*alpha*beta + 35*beta_2)*C2*dbetadt*dbetadt - 8*beta*alpha_plus_beta_10*(4*alpha + 7*beta)*C1*dbetadt*dC1_dt - 6*beta*C1*dalpha_dt*((4*alpha + 5*beta)*C1*dbetadt + 4*beta*alpha_plus_beta_10*dC1_dt) + 2*beta*alpha_plus_beta_10*(C1*(-(C1*(3*beta*d2alpha_dt2 + (4*alpha + 7*beta)*d2betadt2)) - 4*beta*alpha_plus_beta_10*d2C1_dt2) - 4*beta*alpha_plus_beta_10*dC1_dt*dC1_dt))/(128*alpha_plus_beta_05);
+}
+
+/* Store the coefficients of sin(dphi/2), sin(dphi) in the numerator computed
+   by numerator_eval or numerator_contract at the point */
+static void mode_point_numerator(const struct effsource_ctx * ctx, double N[2][8][5],
+  struct mode_point * p)
+{
+  const double rt = ctx->rt, rtt = ctx->rtt;
+  double * const A[2][7] = {
+    {p->ReA, p->dReA_dr, p->d2ReA_dr2, p->dReA_dt, p->d2ReA_dt2, p->dReA_dtheta, p->d2ReA_dtheta2},
+    {p->ImA, p->dImA_dr, p->d2ImA_dr2, p->dImA_dt, p->d2ImA_dt2, p->dImA_dtheta, p->d2ImA_dtheta2}};
+
+  for(int ri=0; ri<2; ri++)
+    for(int j=0; j<5; j++)
+    {
+      A[ri][0][j] = N[ri][0][j];
+      A[ri][1][j] = N[ri][1][j];
+      A[ri][2][j] = N[ri][2][j];
+
+      /* t derivatives - add terms from derivatives of Delta r */
+      A[ri][3][j] = N[ri][3][j] - N[ri][1][j]*rt;
+      A[ri][4][j] = N[ri][5][j] + (- N[ri][1][j]*rtt + N[ri][2][j]*rt*rt - 2*N[ri][4][j]*rt);
+
+      A[ri][5][j] = N[ri][6][j];
+      A[ri][6][j] = N[ri][7][j];
+    }
+}
+
+/* Compute the m-independent quantities at the point (r, theta), except for the
+   elliptic integrals which are added by mode_point_ellip */
+static void mode_point_init(const struct effsource_ctx * ctx, double r, double theta,
+  struct mode_point * p)
+{
+  const double rp     = ctx->xp.r;
+  const double thetap = ctx->xp.theta;
+
+  const double dr     = r - rp;
+  const double dtheta = theta - thetap;
+
+  /* Coefficients of sin(dphi/2), sin(dphi) in the numerator */
+  double N[2][8][5];
+  numerator_eval(ctx, dr, dtheta, 1, N);
+  mode_point_numerator(ctx, N, p);
+
+  mode_point_denom(ctx, dr, dtheta, p);
+
+  /* Angular factors appearing in Box[PhiS] */
+  const double sinth = sin(theta);
+  p->sinth2 = sinth*sinth;
+  p->sin2th = sin(2.0*theta);
+  p->cos2th = cos(2.0*theta);
+
+  p->r  = r;
+  p->dr = dr;
+}
+
+/* Store the elliptic integrals ellK = K(k) and ellE = E(k), k = 1/sqrt(1+C1),
+   at the point and compute their derivatives */
+static void mode_point_ellip(struct mode_point * p, double ellK, double ellE)
+{
+  const double C1 = p->C1, dC1_dr = p->dC1_dr, d2C1_dr2 = p->d2C1_dr2,
+               dC1_dtheta = p->dC1_dtheta, d2C1_dtheta2 = p->d2C1_dtheta2,
+               dC1_dt = p->dC1_dt, d2C1_dt2 = p->d2C1_dt2;
 
   /* Elliptic integrals */
-  double gam = sqrt(1.0/(1.0+C1));
-  double ellE = gsl_sf_ellint_Ecomp(gam, GSL_PREC_DOUBLE);
-  double ellK = gsl_sf_ellint_Kcomp(gam, GSL_PREC_DOUBLE);
-  const double ellip[2] = {ellK, ellE};
+  p->ellip[0] = ellK;
+  p->ellip[1] = ellE;
 
   /* Derivatives of elliptic integrals */
   double dellE_dC   = (ellK - ellE)/(2.*(1+C1));
@@ -865,179 +880,129 @@ void effsource_calc_m(int m, struct coordinate * x,
   double d2ellK_dtheta2 = d2ellK_dC2 * dC1_dtheta * dC1_dtheta + dellK_dC * d2C1_dtheta2;
   double d2ellK_dt2     = d2ellK_dC2 * dC1_dt * dC1_dt + dellK_dC * d2C1_dt2;
 
-  const double dellip_dr[2] = {dellK_dr, dellE_dr};
-  const double dellip_dtheta[2] = {dellK_dtheta, dellE_dtheta};
-  const double dellip_dt[2] = {dellK_dt, dellE_dt};
-
-  const double d2ellip_dr2[2] = {d2ellK_dr2, d2ellE_dr2};
-  const double d2ellip_dtheta2[2] = {d2ellK_dtheta2, d2ellE_dtheta2};
-  const double d2ellip_dt2[2] = {d2ellK_dt2, d2ellE_dt2};
+  p->dellip_dr[0] = dellK_dr;
+  p->dellip_dr[1] = dellE_dr;
+  p->dellip_dtheta[0] = dellK_dtheta;
+  p->dellip_dtheta[1] = dellE_dtheta;
+  p->dellip_dt[0] = dellK_dt;
+  p->dellip_dt[1] = dellE_dt;
+
+  p->d2ellip_dr2[0] = d2ellK_dr2;
+  p->d2ellip_dr2[1] = d2ellE_dr2;
+  p->d2ellip_dtheta2[0] = d2ellK_dtheta2;
+  p->d2ellip_dtheta2[1] = d2ellE_dtheta2;
+  p->d2ellip_dt2[0] = d2ellK_dt2;
+  p->d2ellip_dt2[1] = d2ellE_dt2;
+}
 
-  if(m>20)
+/* Compute the m-mode from the m-independent quantities at a point. The phase
+   factors exp(-i*m*phi_p) and exp(i*m*c*dr) are supplied by the caller, as
+   may be the values from effsource_mode_values for this mode, F_re and F_im,
+   if the polynomials in C1 are not used; if they are NULL they are computed
+   when needed. Component k of each output is stored at index k*stride. */
+static void calc_m_mode(const struct effsource_ctx * ctx, const struct mode_point * p,
+  int m, double cosmph, double sinmph, double coscmdr, double sincmdr,
+  double (*F_re)[3], double (*F_im)[3], int stride, double * restrict PhiS, double * restrict dPhiS_dx, double * restrict d2PhiS_dx2,
+  double * restrict src)
+{
+  const double a = ctx->a, c = ctx->c, dcdt = ctx->dcdt, d2cdt2 = ctx->d2cdt2, rt = ctx->rt,
+               rtt = ctx->rtt, phit = ctx->phit, phitt = ctx->phitt;
+  const double r = p->r, dr = p->dr, sinth2 = p->sinth2, sin2th = p->sin2th, cos2th = p->cos2th;
+  const double *ReA = p->ReA, *ImA = p->ImA, *dReA_dt = p->dReA_dt, *dImA_dt = p->dImA_dt,
+               *dReA_dr = p->dReA_dr, *dImA_dr = p->dImA_dr, *dReA_dtheta = p->dReA_dtheta,
+               *dImA_dtheta = p->dImA_dtheta, *d2ReA_dt2 = p->d2ReA_dt2, *d2ImA_dt2 = p->d2ImA_dt2,
+               *d2ReA_dr2 = p->d2ReA_dr2, *d2ImA_dr2 = p->d2ImA_dr2,
+               *d2ReA_dtheta2 = p->d2ReA_dtheta2, *d2ImA_dtheta2 = p->d2ImA_dtheta2;
+  const double *ellip = p->ellip, *dellip_dr = p->dellip_dr, *dellip_dtheta = p->dellip_dtheta,
+               *dellip_dt = p->dellip_dt, *d2ellip_dr2 = p->d2ellip_dr2,
+               *d2ellip_dtheta2 = p->d2ellip_dtheta2, *d2ellip_dt2 = p->d2ellip_dt2;
+  const double DenRePhiSb = p->DenRePhiSb, dDenRePhiSb_dr = p->dDenRePhiSb_dr,
+               dDenRePhiSb_dtheta = p->dDenRePhiSb_dtheta, dDenRePhiSb_dt = p->dDenRePhiSb_dt,
+               d2DenRePhiSb_dr2 = p->d2DenRePhiSb_dr2,
+               d2DenRePhiSb_dtheta2 = p->d2DenRePhiSb_dtheta2,
+               d2DenRePhiSb_dt2 = p->d2DenRePhiSb_dt2, DenImPhiSb = p->DenImPhiSb,
+               dDenImPhiSb_dr = p->dDenImPhiSb_dr, dDenImPhiSb_dtheta = p->dDenImPhiSb_dtheta,
+               dDenImPhiSb_dt = p->dDenImPhiSb_dt, d2DenImPhiSb_dr2 = p->d2DenImPhiSb_dr2,
+               d2DenImPhiSb_dtheta2 = p->d2DenImPhiSb_dtheta2,
+               d2DenImPhiSb_dt2 = p->d2DenImPhiSb_dt2;
+
+  /* Numerator. The polynomial in C1 = alpha/beta for each (i, j) is evaluated
+     together with its first and second derivatives and composed with the jet
+     of C1 in the (r, theta, t) directions. The numerator jet then follows by
+     multiplying with the jet of the prefactor ellip[i]*A[j]. Away from the
+     particle the sum over i of ellip[i] times the polynomial is instead taken
+     from effsource_mode_values. */
+  const double C1Jet[7] = {p->C1, p->dC1_dr, p->d2C1_dr2, p->dC1_dtheta, p->d2C1_dtheta2,
+    p->dC1_dt, p->d2C1_dt2};
+  const double C1 = p->C1;
+
+  double NumRe[7] = {0}, NumIm[7] = {0};
+  if(!effsource_mode_poly(m, C1))
   {
-    printf("Support for computing mode %d has not yet been added.\n", m);
-    return;
-  }
-
-  /* Numerator */
-  double NumRePhiSb = 0, NumImPhiSb = 0;
-  for(int i=0; i<2; i++)
-    for(int j=0; j<5; j++)
-    {
-      double fac1 = ellip[i]*ReA[j];
-      for(int k=max(j-i,0); k<=m+2+j; k++)
-        NumRePhiSb += ReEI[m][i][j][k]*fac1*C[k];
-      double fac2 = ellip[i]*ImA[j];
-      for(int k=max(j-i-1,0); k<=m+1+j; k++)
-        NumImPhiSb += ImEI[m][i][j][k]*fac2*C[k];
-    }
-
-  double dNumRePhiSb_dr = 0, dNumImPhiSb_dr = 0;
-  for(int i=0; i<2; i++)
-    for(int j=0; j<5; j++)
-    {
-      double fac1 = (dellip_dr[i]*ReA[j] + ellip[i]*dReA_dr[j]);
-      double fac2 = ellip[i]*ReA[j];
-      for(int k=max(j-i,0); k<=m+2+j; k++)
-        dNumRePhiSb_dr += ReEI[m][i][j][k]*
-            (C[k]*fac1 + fac2*dC_dr[k]);
-      double fac3 = (dellip_dr[i]*ImA[j] + ellip[i]*dImA_dr[j]);
-      double fac4 = ellip[i]*ImA[j];
-      for(int k=max(j-i-1,0); k<=m+1+j; k++)
-        dNumImPhiSb_dr += ImEI[m][i][j][k]*
-            (C[k]*fac3 + fac4*dC_dr[k]);
-    }
-
-  double d2NumRePhiSb_dr2 = 0, d2NumImPhiSb_dr2 = 0;
-  for(int i=0; i<2; i++)
-    for(int j=0; j<5; j++)
+    double F[2][1][5][3];
+    if(F_re == NULL)
     {
-      double fac1 = (d2ellip_dr2[i]*ReA[j] + 2.0*dellip_dr[i]*dReA_dr[j] + ellip[i]*d2ReA_dr2[j]);
-      double fac2 = (dellip_dr[i]*ReA[j] + ellip[i]*dReA_dr[j]);
-      double fac3 = ellip[i]*ReA[j];
-      for(int k=max(j-i,0); k<=m+2+j; k++)
-        d2NumRePhiSb_dr2 += ReEI[m][i][j][k]*
-          (C[k]*fac1
-           + 2.0*dC_dr[k]*fac2
-           + fac3*d2C_dr2[k]);
-      double fac4 = (d2ellip_dr2[i]*ImA[j] + 2.0*dellip_dr[i]*dImA_dr[j] + ellip[i]*d2ImA_dr2[j]);
-      double fac5 = (dellip_dr[i]*ImA[j] + ellip[i]*dImA_dr[j]);
-      double fac6 = ellip[i]*ImA[j];
-      for(int k=max(j-i-1,0); k<=m+1+j; k++)
-        d2NumImPhiSb_dr2 += ImEI[m][i][j][k]*
-          (C[k]*fac4
-           + 2.0*dC_dr[k]*fac5
-           + fac6*d2C_dr2[k]);
+      effsource_mode_values(m, m, C1, ellip[0], ellip[1], F[0], F[1]);
+      F_re = F[0][0];
+      F_im = F[1][0];
     }
 
-  double dNumRePhiSb_dtheta = 0, dNumImPhiSb_dtheta = 0;
-  for(int i=0; i<2; i++)
     for(int j=0; j<5; j++)
     {
-      double fac1 = (dellip_dtheta[i]*ReA[j] + ellip[i]*dReA_dtheta[j]);
-      double fac2 = ellip[i]*ReA[j];
-      for(int k=max(j-i,0); k<=m+2+j; k++)
-        dNumRePhiSb_dtheta += ReEI[m][i][j][k]*
-            (C[k]*fac1 + fac2*dC_dtheta[k]);
-      double fac3 = (dellip_dtheta[i]*ImA[j] + ellip[i]*dImA_dtheta[j]);
-      double fac4 = ellip[i]*ImA[j];
-      for(int k=max(j-i-1,0); k<=m+1+j; k++)
-        dNumImPhiSb_dtheta += ImEI[m][i][j][k]*
-            (C[k]*fac3 + fac4*dC_dtheta[k]);
-    }
+      const double ReAJet[7] = {ReA[j], dReA_dr[j], d2ReA_dr2[j],
+        dReA_dtheta[j], d2ReA_dtheta2[j], dReA_dt[j], d2ReA_dt2[j]};
+      const double ImAJet[7] = {ImA[j], dImA_dr[j], d2ImA_dr2[j],
+        dImA_dtheta[j], d2ImA_dtheta2[j], dImA_dt[j], d2ImA_dt2[j]};
+      double S[7];
 
-  double d2NumRePhiSb_dtheta2 = 0, d2NumImPhiSb_dtheta2 = 0;
-  for(int i=0; i<2; i++)
-    for(int j=0; j<5; j++)
-    {
-      double fac1 = (d2ellip_dtheta2[i]*ReA[j] + 2.0*dellip_dtheta[i]*dReA_dtheta[j] + ellip[i]*d2ReA_dtheta2[j]);
-      double fac2 = (dellip_dtheta[i]*ReA[j] + ellip[i]*dReA_dtheta[j]);
-      double fac3 = ellip[i]*ReA[j];
-      for(int k=max(j-i,0); k<=m+2+j; k++)
-        d2NumRePhiSb_dtheta2 += ReEI[m][i][j][k]*
-          (C[k]*fac1
-           + 2.0*dC_dtheta[k]*fac2
-           + fac3*d2C_dtheta2[k]);
-      double fac4 = (d2ellip_dtheta2[i]*ImA[j] + 2.0*dellip_dtheta[i]*dImA_dtheta[j] + ellip[i]*d2ImA_dtheta2[j]);
-      double fac5 = (dellip_dtheta[i]*ImA[j] + ellip[i]*dImA_dtheta[j]);
-      double fac6 = ellip[i]*ImA[j];
-      for(int k=max(j-i-1,0); k<=m+1+j; k++)
-        d2NumImPhiSb_dtheta2 += ImEI[m][i][j][k]*
-          (C[k]*fac4
-           + 2.0*dC_dtheta[k]*fac5
-           + fac6*d2C_dtheta2[k]);
-    }
+      effsource_jet_compose(3, F_re[j], C1Jet, S);
+      effsource_jet_mul_add(3, ReAJet, S, NumRe);
 
-  double dNumRePhiSb_dt = 0, dNumImPhiSb_dt = 0;
-  for(int i=0; i<2; i++)
-    for(int j=0; j<5; j++)
-    {
-      double fac1 = (dellip_dt[i]*ReA[j] + ellip[i]*dReA_dt[j]);
-      double fac2 = ellip[i]*ReA[j];
-      for(int k=max(j-i,0); k<=m+2+j; k++)
-        dNumRePhiSb_dt += ReEI[m][i][j][k]*
-            (C[k]*fac1 + fac2*dC_dt[k]);
-      double fac3 = (dellip_dt[i]*ImA[j] + ellip[i]*dImA_dt[j]);
-      double fac4 = ellip[i]*ImA[j];
-      for(int k=max(j-i-1,0); k<=m+1+j; k++)
-        dNumImPhiSb_dt += ImEI[m][i][j][k]*
-            (C[k]*fac3 + fac4*dC_dt[k]);
+      effsource_jet_compose(3, F_im[j], C1Jet, S);
+      effsource_jet_mul_add(3, ImAJet, S, NumIm);
     }
-
-  double d2NumRePhiSb_dt2 = 0, d2NumImPhiSb_dt2 = 0;
-  for(int i=0; i<2; i++)
-    for(int j=0; j<5; j++)
+  }
+  else
+  {
+    for(int i=0; i<2; i++)
     {
-      double fac1 = (d2ellip_dt2[i]*ReA[j] + 2.0*dellip_dt[i]*dReA_dt[j] + ellip[i]*d2ReA_dt2[j]);
-      double fac2 = (dellip_dt[i]*ReA[j] + ellip[i]*dReA_dt[j]);
-      double fac3 = ellip[i]*ReA[j];
-      for(int k=max(j-i,0); k<=m+2+j; k++)
-        d2NumRePhiSb_dt2 += ReEI[m][i][j][k]*
-          (C[k]*fac1
-           + 2.0*dC_dt[k]*fac2
-           + fac3*d2C_dt2[k]);
-      double fac4 = (d2ellip_dt2[i]*ImA[j] + 2.0*dellip_dt[i]*dImA_dt[j] + ellip[i]*d2ImA_dt2[j]);
-      double fac5 = (dellip_dt[i]*ImA[j] + ellip[i]*dImA_dt[j]);
-      double fac6 = ellip[i]*ImA[j];
-      for(int k=max(j-i-1,0); k<=m+1+j; k++)
-        d2NumImPhiSb_dt2 += ImEI[m][i][j][k]*
-          (C[k]*fac4
-           + 2.0*dC_dt[k]*fac5
-           + fac6*d2C_dt2[k]);
+      const double ellipJet[7] = {ellip[i], dellip_dr[i], d2ellip_dr2[i],
+        dellip_dtheta[i], d2ellip_dtheta2[i], dellip_dt[i], d2ellip_dt2[i]};
+
+      for(int j=0; j<5; j++)
+      {
+        const double ReAJet[7] = {ReA[j], dReA_dr[j], d2ReA_dr2[j],
+          dReA_dtheta[j], d2ReA_dtheta2[j], dReA_dt[j], d2ReA_dt2[j]};
+        const double ImAJet[7] = {ImA[j], dImA_dr[j], d2ImA_dr2[j],
+          dImA_dtheta[j], d2ImA_dtheta2[j], dImA_dt[j], d2ImA_dt2[j]};
+        double fac1[7] = {0}, fac2[7] = {0}, P[3], S[7];
+
+        effsource_jet_mul_add(3, ellipJet, ReAJet, fac1);
+        effsource_poly_d2(ReEI_coeffs(m,i,j), max(j-i,0), m+2+j, C1, P);
+        effsource_jet_compose(3, P, C1Jet, S);
+        effsource_jet_mul_add(3, fac1, S, NumRe);
+
+        effsource_jet_mul_add(3, ellipJet, ImAJet, fac2);
+        effsource_poly_d2(ImEI_coeffs(m,i,j), max(j-i-1,0), m+1+j, C1, P);
+        effsource_jet_compose(3, P, C1Jet, S);
+        effsource_jet_mul_add(3, fac2, S, NumIm);
+      }
     }
+  }
 
-  /* Denominator - there is a different denominator for real and imaginary parts */
-  double alpha_plus_beta_10 = alpha+beta;
-  double alpha_plus_beta_05 = sqrt(alpha_plus_beta_10);
-  double alpha_plus_beta_15 = alpha_plus_beta_10*alpha_plus_beta_05;
-  double alpha_plus_beta_20 = alpha_plus_beta_10*alpha_plus_beta_10;
-  double alpha_plus_beta_25 = alpha_plus_beta_10*alpha_plus_beta_15;
-
-  double beta_2 = beta*beta;
-
-  double DenRePhiSb         = beta*C[3]*alpha_plus_beta_25/4.0;
-  double dDenRePhiSb_dr     = beta*(6.0*C[2]*alpha_plus_beta_25*dC1_dr + C[3]*5.0*alpha_plus_beta_15*dalpha_dr)/8.0;
-  double dDenRePhiSb_dtheta = beta*(6.0*C[2]*alpha_plus_beta_25*dC1_dtheta + C[3]*5.0*alpha_plus_beta_15*dalpha_dtheta)/8.0;
-  double dDenRePhiSb_dt     = (alpha_plus_beta_15*C[2]*(6*dC1_dt*beta*alpha_plus_beta_10 + 5*(dalpha_dt + dbetadt)*beta*C1 + 2*dbetadt*alpha_plus_beta_10*C1))/8.0;
-  double d2DenRePhiSb_dr2   = beta*C1*alpha_plus_beta_05*(24*alpha_plus_beta_20*dC1_dr*dC1_dr + 60.0*C1*(alpha+beta)*dalpha_dr*dC1_dr + C1*(12.0*alpha_plus_beta_20*d2C1_dr2 + 5.0*C1*(3.0*dalpha_dr*dalpha_dr + 2.0*(alpha+beta)*d2alpha_dr2)))/16.0;
-  double d2DenRePhiSb_dtheta2  = beta*C1*alpha_plus_beta_05*(24*alpha_plus_beta_20*dC1_dtheta*dC1_dtheta + 60.0*C1*(alpha+beta)*dalpha_dtheta*dC1_dtheta + C1*(12.0*alpha_plus_beta_20*d2C1_dtheta2 + 5.0*C1*(3.0*dalpha_dtheta*dalpha_dtheta + 2.0*(alpha+beta)*d2alpha_dtheta2)))/16.0;
-  double d2DenRePhiSb_dt2   = (alpha_plus_beta_05*C1*(4*alpha_plus_beta_20*C[2]*d2betadt2 + 10*beta*alpha_plus_beta_10*C[2]*(d2alpha_dt2 + d2betadt2) + 12*beta*alpha_plus_beta_20*C1*d2C1_dt2 + 20*alpha_plus_beta_10*C[2]*dbetadt*(dalpha_dt + dbetadt) + 15*beta*C[2]*(dalpha_dt + dbetadt)*(dalpha_dt + dbetadt) + 24*alpha_plus_beta_20*C1*dbetadt*dC1_dt + 60*beta*alpha_plus_beta_10*C1*(dalpha_dt + dbetadt)*dC1_dt + 24*beta*alpha_plus_beta_20*dC1_dt*dC1_dt))/16.0;
-
-  double DenImPhiSb           = -(beta_2*C[2]*alpha_plus_beta_15)/32.0;
-  double dDenImPhiSb_dr       = -(beta_2*C1*alpha_plus_beta_05*(4.0*alpha_plus_beta_10*dC1_dr + 3*C1*dalpha_dr))/64.;
-  double dDenImPhiSb_dtheta   = -(beta_2*C1*alpha_plus_beta_05*(4.0*alpha_plus_beta_10*dC1_dtheta + 3*C1*dalpha_dtheta))/64.;
-  double dDenImPhiSb_dt       = (beta*alpha_plus_beta_05*C1*(-4*dC1_dt*beta*alpha_plus_beta_10 - 3*(dalpha_dt + dbetadt)*beta*C1 - 4*dbetadt*alpha_plus_beta_10*C1))/64.0;
-  double d2DenImPhiSb_dr2     = -(beta_2*(C1*(8*alpha_plus_beta_20*d2C1_dr2 + 3.0*C1*(2.0*alpha_plus_beta_10*d2alpha_dr2 + dalpha_dr*dalpha_dr)) + 24.0*alpha_plus_beta_10*C1*dalpha_dr*dC1_dr + 8.0*alpha_plus_beta_20*dC1_dr*dC1_dr))/(128.*alpha_plus_beta_05);
-  double d2DenImPhiSb_dtheta2 = -(beta_2*(C1*(8*alpha_plus_beta_20*d2C1_dtheta2 + 3.0*C1*(2.0*alpha_plus_beta_10*d2alpha_dtheta2 + dalpha_dtheta*dalpha_dtheta)) + 24.0*alpha_plus_beta_10*C1*dalpha_dtheta*dC1_dtheta + 8.0*alpha_plus_beta_20*dC1_dtheta*dC1_dtheta))/(128.*alpha_plus_beta_05);
-  double d2DenImPhiSb_dt2     = (-3*beta_2*C[2]*dalpha_dt*dalpha_dt - (8*alpha*alpha + 40*alpha*beta + 35*beta_2)*C[2]*dbetadt*dbetadt - 8*beta*alpha_plus_beta_10*(4*alpha + 7*beta)*C1*dbetadt*dC1_dt - 6*beta*C1*dalpha_dt*((4*alpha + 5*beta)*C1*dbetadt + 4*beta*alpha_plus_beta_10*dC1_dt) + 2*beta*alpha_plus_beta_10*(C1*(-(C1*(3*beta*d2alpha_dt2 + (4*alpha + 7*beta)*d2betadt2)) - 4*beta*alpha_plus_beta_10*d2C1_dt2) - 4*beta*alpha_plus_beta_10*dC1_dt*dC1_dt))/(128*alpha_plus_beta_05);
+  const double NumRePhiSb           = NumRe[0], NumImPhiSb           = NumIm[0];
+  const double dNumRePhiSb_dr       = NumRe[1], dNumImPhiSb_dr       = NumIm[1];
+  const double d2NumRePhiSb_dr2     = NumRe[2], d2NumImPhiSb_dr2     = NumIm[2];
+  const double dNumRePhiSb_dtheta   = NumRe[3], dNumImPhiSb_dtheta   = NumIm[3];
+  const double d2NumRePhiSb_dtheta2 = NumRe[4], d2NumImPhiSb_dtheta2 = NumIm[4];
+  const double dNumRePhiSb_dt       = NumRe[5], dNumImPhiSb_dt       = NumIm[5];
+  const double d2NumRePhiSb_dt2     = NumRe[6], d2NumImPhiSb_dt2     = NumIm[6];
 
   /* m-modes for the rotated phi coordinate */
   double RePhiSb = NumRePhiSb/DenRePhiSb;
   double ImPhiSb = NumImPhiSb/DenImPhiSb;
 
   /* m-modes for the regular Boyer-Lindquist phi coordinate */
-  double sincmdr = sin(c*m*dr);
-  double coscmdr = cos(c*m*dr);
   double RePhiS = RePhiSb*coscmdr + ImPhiSb*sincmdr;
   double ImPhiS = ImPhiSb*coscmdr - RePhiSb*sincmdr;
 
@@ -1095,10 +1060,6 @@ void effsource_calc_m(int m, struct coordinate * x,
   double Im_d2PhiS_dthph = NAN;
 
   /* Box[PhiS] */
-  double sinth  = sin(theta);
-  double sinth2 = sinth*sinth;
-  double sin2th = sin(2.0*theta);
-  double cos2th = cos(2.0*theta);
   double r2 = r*r;
   double r3 = r2*r;
   double r4 = r2*r2;
@@ -1125,42 +1086,1188 @@ void effsource_calc_m(int m, struct coordinate * x,
 
   /* Store calculated quantities into the arrays provided by the caller,
      including the phase factor exp(-i*m*phi_p) */
-  double cosmph = cos(m*xp.phi);
-  double sinmph = sin(m*xp.phi);
+  PhiS[0]      = RePhiS*cosmph + ImPhiS*sinmph;
+  PhiS[stride] = ImPhiS*cosmph - RePhiS*sinmph;
+
+  dPhiS_dx[0]        = Re_dPhiS_dt*cosmph + Im_dPhiS_dt*sinmph;
+  dPhiS_dx[stride]   = Im_dPhiS_dt*cosmph - Re_dPhiS_dt*sinmph;
+  dPhiS_dx[2*stride] = Re_dPhiS_dr*cosmph + Im_dPhiS_dr*sinmph;
+  dPhiS_dx[3*stride] = Im_dPhiS_dr*cosmph - Re_dPhiS_dr*sinmph;
+  dPhiS_dx[4*stride] = Re_dPhiS_dth*cosmph + Im_dPhiS_dth*sinmph;
+  dPhiS_dx[5*stride] = Im_dPhiS_dth*cosmph - Re_dPhiS_dth*sinmph;
+  dPhiS_dx[6*stride] = Re_dPhiS_dph*cosmph + Im_dPhiS_dph*sinmph;
+  dPhiS_dx[7*stride] = Im_dPhiS_dph*cosmph - Re_dPhiS_dph*sinmph;
+
+  d2PhiS_dx2[0]         = Re_d2PhiS_dt2*cosmph + Im_d2PhiS_dt2*sinmph;
+  d2PhiS_dx2[stride]    = Im_d2PhiS_dt2*cosmph - Re_d2PhiS_dt2*sinmph;
+  d2PhiS_dx2[2*stride]  = Re_d2PhiS_dtr*cosmph + Im_d2PhiS_dtr*sinmph;
+  d2PhiS_dx2[3*stride]  = Im_d2PhiS_dtr*cosmph - Re_d2PhiS_dtr*sinmph;
+  d2PhiS_dx2[4*stride]  = Re_d2PhiS_dtth*cosmph + Im_d2PhiS_dtth*sinmph;
+  d2PhiS_dx2[5*stride]  = Im_d2PhiS_dtth*cosmph - Re_d2PhiS_dtth*sinmph;
+  d2PhiS_dx2[6*stride]  = Re_d2PhiS_dtph*cosmph + Im_d2PhiS_dtph*sinmph;
+  d2PhiS_dx2[7*stride]  = Im_d2PhiS_dtph*cosmph - Re_d2PhiS_dtph*sinmph;
+  d2PhiS_dx2[8*stride]  = Re_d2PhiS_dr2*cosmph + Im_d2PhiS_dr2*sinmph;
+  d2PhiS_dx2[9*stride]  = Im_d2PhiS_dr2*cosmph - Re_d2PhiS_dr2*sinmph;
+  d2PhiS_dx2[10*stride] = Re_d2PhiS_drth*cosmph + Im_d2PhiS_drth*sinmph;
+  d2PhiS_dx2[11*stride] = Im_d2PhiS_drth*cosmph - Re_d2PhiS_drth*sinmph;
+  d2PhiS_dx2[12*stride] = Re_d2PhiS_drph*cosmph + Im_d2PhiS_drph*sinmph;
+  d2PhiS_dx2[13*stride] = Im_d2PhiS_drph*cosmph - Re_d2PhiS_drph*sinmph;
+  d2PhiS_dx2[14*stride] = Re_d2PhiS_dth2*cosmph + Im_d2PhiS_dth2*sinmph;
+  d2PhiS_dx2[15*stride] = Im_d2PhiS_dth2*cosmph - Re_d2PhiS_dth2*sinmph;
+  d2PhiS_dx2[16*stride] = Re_d2PhiS_dthph*cosmph + Im_d2PhiS_dthph*sinmph;
+  d2PhiS_dx2[17*stride] = Im_d2PhiS_dthph*cosmph - Re_d2PhiS_dthph*sinmph;
+  d2PhiS_dx2[18*stride] = Re_d2PhiS_dph2*cosmph + Im_d2PhiS_dph2*sinmph;
+  d2PhiS_dx2[19*stride] = Im_d2PhiS_dph2*cosmph - Re_d2PhiS_dph2*sinmph;
+
+  src[0]      = Re_box_PhiS*cosmph + Im_box_PhiS*sinmph;
+  src[stride] = Im_box_PhiS*cosmph - Re_box_PhiS*sinmph;
+}
 
-  PhiS[0] = RePhiS*cosmph + ImPhiS*sinmph;
-  PhiS[1] = ImPhiS*cosmph - RePhiS*sinmph;
+/* Compute the m-mode at a single point (r, theta) given the phase factor
+   exp(-i*m*phi_p). Component k of each output is stored at index k*stride. */
+static inline void calc_m_point(const struct effsource_ctx * ctx, int m,
+  double cosmph, double sinmph, double r, double theta, int stride,
+  double * restrict PhiS, double * restrict dPhiS_dx, double * restrict d2PhiS_dx2,
+  double * restrict src)
+{
+  struct mode_point p;
+  double ellK, ellE;
+  mode_point_init(ctx, r, theta, &p);
+  effsource_ellint_KE(1, &p.C1, &ellK, &ellE);
+  mode_point_ellip(&p, ellK, ellE);
+
+  calc_m_mode(ctx, &p, m, cosmph, sinmph, cos(ctx->c*m*p.dr), sin(ctx->c*m*p.dr), NULL, NULL,
+    stride, PhiS, dPhiS_dx, d2PhiS_dx2, src);
+}
+
+/* Compute the 2D singular field, its derivatives and its d'Alembertian */
+void effsource_calc_m_ctx(struct effsource_ctx * ctx, int m, struct coordinate * x,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  if(!mode_supported(m))
+    return;
+  particle_dt_require(ctx);
+
+  calc_m_point(ctx, m, cos(m*ctx->xp.phi), sin(m*ctx->xp.phi), x->r, x->theta, 1,
+    PhiS, dPhiS_dx, d2PhiS_dx2, src);
+}
+
+/* Compute the m-mode at nb <= MODE_POINT_BLOCK points (r[b], theta[b]), with
+   component k for point b stored at index k*stride+b. The elliptic integrals
+   for all points are computed together. */
+static void calc_m_block(const struct effsource_ctx * ctx, int m, double cosmph,
+  double sinmph, int nb, const double * r, const double * theta, int stride,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  struct mode_point p[MODE_POINT_BLOCK];
+  double C1[MODE_POINT_BLOCK], ellK[MODE_POINT_BLOCK], ellE[MODE_POINT_BLOCK];
+
+  for(int b=0; b<nb; b++)
+  {
+    mode_point_init(ctx, r[b], theta[b], &p[b]);
+    C1[b] = p[b].C1;
+  }
+
+  effsource_ellint_KE(nb, C1, ellK, ellE);
+
+  for(int b=0; b<nb; b++)
+  {
+    mode_point_ellip(&p[b], ellK[b], ellE[b]);
+    calc_m_mode(ctx, &p[b], m, cosmph, sinmph, cos(ctx->c*m*p[b].dr), sin(ctx->c*m*p[b].dr),
+      NULL, NULL,
+      stride, PhiS+b, dPhiS_dx+b, d2PhiS_dx2+b, src+b);
+  }
+}
 
-  dPhiS_dx[0] = Re_dPhiS_dt*cosmph + Im_dPhiS_dt*sinmph;
-  dPhiS_dx[1] = Im_dPhiS_dt*cosmph - Re_dPhiS_dt*sinmph;
-  dPhiS_dx[2] = Re_dPhiS_dr*cosmph + Im_dPhiS_dr*sinmph;
-  dPhiS_dx[3] = Im_dPhiS_dr*cosmph - Re_dPhiS_dr*sinmph;
-  dPhiS_dx[4] = Re_dPhiS_dth*cosmph + Im_dPhiS_dth*sinmph;
-  dPhiS_dx[5] = Im_dPhiS_dth*cosmph - Re_dPhiS_dth*sinmph;
-  dPhiS_dx[6] = Re_dPhiS_dph*cosmph + Im_dPhiS_dph*sinmph;
-  dPhiS_dx[7] = Im_dPhiS_dph*cosmph - Re_dPhiS_dph*sinmph;
-
-  d2PhiS_dx2[0]  = Re_d2PhiS_dt2*cosmph + Im_d2PhiS_dt2*sinmph;
-  d2PhiS_dx2[1]  = Im_d2PhiS_dt2*cosmph - Re_d2PhiS_dt2*sinmph;
-  d2PhiS_dx2[2]  = Re_d2PhiS_dtr*cosmph + Im_d2PhiS_dtr*sinmph;
-  d2PhiS_dx2[3]  = Im_d2PhiS_dtr*cosmph - Re_d2PhiS_dtr*sinmph;
-  d2PhiS_dx2[4]  = Re_d2PhiS_dtth*cosmph + Im_d2PhiS_dtth*sinmph;
-  d2PhiS_dx2[5]  = Im_d2PhiS_dtth*cosmph - Re_d2PhiS_dtth*sinmph;
-  d2PhiS_dx2[6]  = Re_d2PhiS_dtph*cosmph + Im_d2PhiS_dtph*sinmph;
-  d2PhiS_dx2[7]  = Im_d2PhiS_dtph*cosmph - Re_d2PhiS_dtph*sinmph;
-  d2PhiS_dx2[8]  = Re_d2PhiS_dr2*cosmph + Im_d2PhiS_dr2*sinmph;
-  d2PhiS_dx2[9]  = Im_d2PhiS_dr2*cosmph - Re_d2PhiS_dr2*sinmph;
-  d2PhiS_dx2[10] = Re_d2PhiS_drth*cosmph + Im_d2PhiS_drth*sinmph;
-  d2PhiS_dx2[11] = Im_d2PhiS_drth*cosmph - Re_d2PhiS_drth*sinmph;
-  d2PhiS_dx2[12] = Re_d2PhiS_drph*cosmph + Im_d2PhiS_drph*sinmph;
-  d2PhiS_dx2[13] = Im_d2PhiS_drph*cosmph - Re_d2PhiS_drph*sinmph;
-  d2PhiS_dx2[14] = Re_d2PhiS_dth2*cosmph + Im_d2PhiS_dth2*sinmph;
-  d2PhiS_dx2[15] = Im_d2PhiS_dth2*cosmph - Re_d2PhiS_dth2*sinmph;
-  d2PhiS_dx2[16] = Re_d2PhiS_dthph*cosmph + Im_d2PhiS_dthph*sinmph;
-  d2PhiS_dx2[17] = Im_d2PhiS_dthph*cosmph - Re_d2PhiS_dthph*sinmph;
-  d2PhiS_dx2[18] = Re_d2PhiS_dph2*cosmph + Im_d2PhiS_dph2*sinmph;
-  d2PhiS_dx2[19] = Im_d2PhiS_dph2*cosmph - Re_d2PhiS_dph2*sinmph;
-
-  src[0] = Re_box_PhiS*cosmph + Im_box_PhiS*sinmph;
-  src[1] = Im_box_PhiS*cosmph - Re_box_PhiS*sinmph;
+/* Compute the m-mode at n points with coordinates (r[i], theta[i]). The outputs
+   are stored component-major: component k for point i is at index k*stride+i,
+   so stride must be at least n. Everything which depends only on the particle
+   and on m is computed once for the whole batch. */
+void effsource_calc_m_batch_ctx(struct effsource_ctx * ctx, int m, int n,
+  const double * r, const double * theta, int stride,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  if(!mode_supported(m))
+    return;
+  particle_dt_require(ctx);
+
+  const double cosmph = cos(m*ctx->xp.phi);
+  const double sinmph = sin(m*ctx->xp.phi);
+
+  for(int i0=0; i0<n; i0+=MODE_POINT_BLOCK)
+  {
+    const int nb = n-i0 < MODE_POINT_BLOCK ? n-i0 : MODE_POINT_BLOCK;
+    calc_m_block(ctx, m, cosmph, sinmph, nb, r+i0, theta+i0, stride,
+      PhiS+i0, dPhiS_dx+i0, d2PhiS_dx2+i0, src+i0);
+  }
+}
+
+/* As effsource_calc_m_batch_ctx, but passing each block of points to kernel
+   instead of storing the outputs */
+void effsource_calc_m_batch_fn_ctx(struct effsource_ctx * ctx, int m, int n,
+  const double * r, const double * theta, effsource_m_kernel kernel, void * data)
+{
+  if(!mode_supported(m))
+    return;
+  particle_dt_require(ctx);
+
+  const double cosmph = cos(m*ctx->xp.phi);
+  const double sinmph = sin(m*ctx->xp.phi);
+
+  struct effsource_m_lanes lanes;
+  for(int i0=0; i0<n; i0+=EFFSOURCE_LANES)
+  {
+    lanes.n = n-i0 < EFFSOURCE_LANES ? n-i0 : EFFSOURCE_LANES;
+    for(int b=0; b<lanes.n; b++)
+    {
+      lanes.index[b] = i0+b;
+      lanes.r[b]     = r[i0+b];
+      lanes.theta[b] = theta[i0+b];
+    }
+    calc_m_block(ctx, m, cosmph, sinmph, lanes.n, lanes.r, lanes.theta, EFFSOURCE_LANES,
+      lanes.PhiS, lanes.dPhiS_dx, lanes.d2PhiS_dx2, lanes.src);
+    kernel(&lanes, data);
+  }
+}
+
+/* Quantities on a grid row of constant r. A[ri][d][j][b] is the coefficient of
+   dtheta^(2b) in the real (ri=0) or imaginary (ri=1) part of A[j] or in its
+   partial r, (r,r), t, (t,r) or (t,t) derivative at fixed dr for d = 0, ..., 5. */
+struct mode_grid_row {
+  double r, dr;
+  double A[2][6][5][5];
+};
+
+/* Quantities on a grid column of constant theta. w[d][b] is the d-th theta
+   derivative of dtheta^(2b). */
+struct mode_grid_col {
+  double theta, dtheta;
+  double w[3][5];
+  double sinth2, sin2th, cos2th;
+};
+
+static void mode_grid_row_init(const struct effsource_ctx * ctx, double r,
+  struct mode_grid_row * row)
+{
+  row->r  = r;
+  row->dr = r - ctx->xp.r;
+
+  numerator_dr(ctx, row->dr, 1, row->A);
+}
+
+static void mode_grid_col_init(const struct effsource_ctx * ctx, double theta,
+  struct mode_grid_col * col)
+{
+  const double dtheta = theta - ctx->xp.theta;
+
+  col->theta  = theta;
+  col->dtheta = dtheta;
+
+  numerator_dtheta(dtheta, col->w);
+
+  /* Angular factors appearing in Box[PhiS] */
+  const double sinth = sin(theta);
+  col->sinth2 = sinth*sinth;
+  col->sin2th = sin(2.0*theta);
+  col->cos2th = cos(2.0*theta);
+}
+
+/* Equivalent of mode_point_init at the intersection of a grid row and column */
+static void mode_point_grid(const struct effsource_ctx * ctx, struct mode_grid_row * row,
+  struct mode_grid_col * col, struct mode_point * p)
+{
+  /* r and t derivatives come from the row, theta derivatives from the column */
+  double N[2][8][5];
+  numerator_contract(row->A, col->w, 1, N);
+  mode_point_numerator(ctx, N, p);
+
+  mode_point_denom(ctx, row->dr, col->dtheta, p);
+
+  p->sinth2 = col->sinth2;
+  p->sin2th = col->sin2th;
+  p->cos2th = col->cos2th;
+
+  p->r  = row->r;
+  p->dr = row->dr;
+}
+
+/* Compute the m-mode at nb <= MODE_POINT_BLOCK points of a grid row, with the
+   columns col[b], storing component k for point b at index k*stride+b */
+static void calc_m_grid_block(const struct effsource_ctx * ctx, int m, double cosmph,
+  double sinmph, double coscmdr, double sincmdr,
+  struct mode_grid_row * row, struct mode_grid_col * col, int nb,
+  int stride, double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  struct mode_point p[MODE_POINT_BLOCK];
+  double C1[MODE_POINT_BLOCK], ellK[MODE_POINT_BLOCK], ellE[MODE_POINT_BLOCK];
+
+  for(int b=0; b<nb; b++)
+  {
+    mode_point_grid(ctx, row, &col[b], &p[b]);
+    C1[b] = p[b].C1;
+  }
+
+  effsource_ellint_KE(nb, C1, ellK, ellE);
+
+  for(int b=0; b<nb; b++)
+  {
+    mode_point_ellip(&p[b], ellK[b], ellE[b]);
+    calc_m_mode(ctx, &p[b], m, cosmph, sinmph, coscmdr, sincmdr, NULL, NULL, stride,
+      PhiS+b, dPhiS_dx+b, d2PhiS_dx2+b, src+b);
+  }
+}
+
+/* Compute the m-mode on the tensor-product grid of points (r[i], theta[j]).
+   Component k for point (i, j) is stored at index k*stride+i*ntheta+j, so
+   stride must be at least nr*ntheta. The numerator polynomials are evaluated
+   by sum factorisation: the r dependence is evaluated once per row and the
+   theta dependence once per column, leaving a short dot product per point. */
+void effsource_calc_m_grid_ctx(struct effsource_ctx * ctx, int m, int nr, const double * r,
+  int ntheta, const double * theta, int stride,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  if(!mode_supported(m))
+    return;
+  particle_dt_require(ctx);
+
+  const double cosmph = cos(m*ctx->xp.phi);
+  const double sinmph = sin(m*ctx->xp.phi);
+
+  struct mode_grid_col * col = malloc(ntheta*sizeof(struct mode_grid_col));
+  assert(col != NULL);
+
+  for(int j=0; j<ntheta; j++)
+    mode_grid_col_init(ctx, theta[j], &col[j]);
+
+  /* Each row is processed in blocks of columns so that the elliptic integrals
+     for all points in a block can be computed together */
+  for(int i=0; i<nr; i++)
+  {
+    struct mode_grid_row row;
+    mode_grid_row_init(ctx, r[i], &row);
+
+    const double coscmdr = cos(ctx->c*m*row.dr);
+    const double sincmdr = sin(ctx->c*m*row.dr);
+
+    for(int j0=0; j0<ntheta; j0+=MODE_POINT_BLOCK)
+    {
+      const int nb = ntheta-j0 < MODE_POINT_BLOCK ? ntheta-j0 : MODE_POINT_BLOCK;
+      const int k = i*ntheta+j0;
+      calc_m_grid_block(ctx, m, cosmph, sinmph, coscmdr, sincmdr, &row, &col[j0], nb, stride,
+        PhiS+k, dPhiS_dx+k, d2PhiS_dx2+k, src+k);
+    }
+  }
+
+  free(col);
+}
+
+/* As effsource_calc_m_grid_ctx, but passing each block of points of a grid row
+   to kernel instead of storing the outputs. The index of point (i, j) is
+   i*ntheta+j. */
+void effsource_calc_m_grid_fn_ctx(struct effsource_ctx * ctx, int m, int nr,
+  const double * r, int ntheta, const double * theta, effsource_m_kernel kernel,
+  void * data)
+{
+  if(!mode_supported(m))
+    return;
+  particle_dt_require(ctx);
+
+  const double cosmph = cos(m*ctx->xp.phi);
+  const double sinmph = sin(m*ctx->xp.phi);
+
+  struct mode_grid_col * col = malloc(ntheta*sizeof(struct mode_grid_col));
+  assert(col != NULL);
+
+  for(int j=0; j<ntheta; j++)
+    mode_grid_col_init(ctx, theta[j], &col[j]);
+
+  struct effsource_m_lanes lanes;
+  for(int i=0; i<nr; i++)
+  {
+    struct mode_grid_row row;
+    mode_grid_row_init(ctx, r[i], &row);
+
+    const double coscmdr = cos(ctx->c*m*row.dr);
+    const double sincmdr = sin(ctx->c*m*row.dr);
+
+    for(int j0=0; j0<ntheta; j0+=EFFSOURCE_LANES)
+    {
+      lanes.n = ntheta-j0 < EFFSOURCE_LANES ? ntheta-j0 : EFFSOURCE_LANES;
+      for(int b=0; b<lanes.n; b++)
+      {
+        lanes.index[b] = i*ntheta+j0+b;
+        lanes.r[b]     = r[i];
+        lanes.theta[b] = theta[j0+b];
+      }
+      calc_m_grid_block(ctx, m, cosmph, sinmph, coscmdr, sincmdr, &row, &col[j0], lanes.n,
+        EFFSOURCE_LANES, lanes.PhiS, lanes.dPhiS_dx, lanes.d2PhiS_dx2, lanes.src);
+      kernel(&lanes, data);
+    }
+  }
+
+  free(col);
+}
+
+/* Number of points processed together by effsource_calc_grid_ctx and
+   effsource_calc_batch_ctx */
+#define CALC_BLOCK 32
+
+/* Compute the singular field, its derivatives and its d'Alembertian on the grid
+   of points (r[i], theta[j], phi0+l*dphi). Component k of each output for the
+   point (i, j, l) is stored at index k*stride+(i*ntheta+j)*nphi+l, so stride
+   must be at least nr*ntheta*nphi. The numerator is a polynomial in
+   Q = sin(dphib/2) plus R = sin(dphib) times another; the coefficients are
+   computed once for each (r, theta) line and Q and its phi derivative are
+   generated by recurrence along each row, so the only transcendental function
+   needed per point is a square root. */
+void effsource_calc_grid_ctx(struct effsource_ctx * ctx, int nr, const double * r,
+  int ntheta, const double * theta, int nphi, double phi0, double dphi, int stride,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  particle_dt_require(ctx);
+
+  const double alpha20 = ctx->alpha20, alpha02 = ctx->alpha02, beta = ctx->beta;
+
+  struct mode_grid_col * col = malloc(ntheta*sizeof(struct mode_grid_col));
+  double * buf = malloc(4*nphi*sizeof(double));
+  assert(col != NULL && buf != NULL);
+  double * restrict Q = buf, * restrict dQ = buf+nphi, * restrict s2 = buf+2*nphi,
+         * restrict sqrts2 = buf+3*nphi;
+
+  for(int j=0; j<ntheta; j++)
+    mode_grid_col_init(ctx, theta[j], &col[j]);
+
+  for(int i=0; i<nr; i++)
+  {
+    struct mode_grid_row row;
+    mode_grid_row_init(ctx, r[i], &row);
+
+    /* Q = sin(dphib/2) and dQ/dphi depend on r through dphib = dphi - c dr */
+    effsource_angles(nphi, 0.5*(phi0 - ctx->xp.phi - ctx->c*row.dr), 0.5*dphi, Q, dQ);
+
+    for(int j=0; j<ntheta; j++)
+    {
+      struct mode_grid_col * cj = &col[j];
+      const int k0 = (i*ntheta+j)*nphi;
+
+      double P[2][8][5];
+      numerator_contract(row.A, cj->w, 1, P);
+
+      const double alpha = alpha20*row.dr*row.dr + alpha02*cj->dtheta*cj->dtheta;
+      for(int l=0; l<nphi; l++)
+        s2[l] = alpha + beta*Q[l]*Q[l];
+      effsource_sqrt(nphi, s2, sqrts2);
+
+      /* The line is evaluated in blocks with the results for each block first
+         stored contiguously, so the loop over points in a block vectorises */
+      for(int l0=0; l0<nphi; l0+=CALC_BLOCK)
+      {
+        const int nb = nphi-l0 < CALC_BLOCK ? nphi-l0 : CALC_BLOCK;
+        double out[16][CALC_BLOCK];
+
+        for(int l=l0; l<l0+nb; l++)
+        {
+          const double R = 4.0*Q[l]*dQ[l], dR_dph = 1.0 - 2.0*Q[l]*Q[l];
+          struct calc_partials p;
+          calc_partials_eval(P, Q[l], R, &p);
+
+          calc_finish(ctx, row.r, row.dr, cj->dtheta, Q[l], dQ[l], R, dR_dph, cj->sinth2,
+            cj->sin2th, cj->cos2th, &p, s2[l], sqrts2[l], CALC_BLOCK,
+            &out[0][l-l0], &out[1][l-l0], &out[5][l-l0], &out[15][l-l0]);
+        }
+
+        const int k = k0+l0;
+        memcpy(PhiS+k, out[0], nb*sizeof(double));
+        for(int d=0; d<4; d++)
+          memcpy(dPhiS_dx+d*stride+k, out[1+d], nb*sizeof(double));
+        for(int d=0; d<10; d++)
+          memcpy(d2PhiS_dx2+d*stride+k, out[5+d], nb*sizeof(double));
+        memcpy(src+k, out[15], nb*sizeof(double));
+      }
+    }
+  }
+
+  free(buf);
+  free(col);
+}
+
+/* Compute the singular field, its derivatives and its d'Alembertian at the n
+   points (r[i], theta[i], phi[i]). Component k of each output for point i is
+   stored at index k*stride+i, so stride must be at least n. The sines, cosines
+   and square roots for a block of points are computed first by vectorised
+   kernels, after which the rest of the evaluation vectorises across points. */
+void effsource_calc_batch_ctx(struct effsource_ctx * ctx, int n, const double * r,
+  const double * theta, const double * phi, int stride,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  particle_dt_require(ctx);
+
+  const double rp = ctx->xp.r, thetap = ctx->xp.theta, phip = ctx->xp.phi, c = ctx->c;
+  const double alpha20 = ctx->alpha20, alpha02 = ctx->alpha02, beta = ctx->beta;
+
+  for(int i0=0; i0<n; i0+=CALC_BLOCK)
+  {
+    const int nb = n-i0 < CALC_BLOCK ? n-i0 : CALC_BLOCK;
+    double h[CALC_BLOCK], Q[CALC_BLOCK], cosh[CALC_BLOCK], sinth[CALC_BLOCK], costh[CALC_BLOCK];
+    double s2[CALC_BLOCK], sqrts2[CALC_BLOCK];
+    double out[16][CALC_BLOCK];
+
+    for(int l=0; l<nb; l++)
+      h[l] = 0.5*(phi[i0+l] - phip - c*(r[i0+l] - rp));
+    effsource_sincos(nb, h, Q, cosh);
+    effsource_sincos(nb, theta+i0, sinth, costh);
+
+    for(int l=0; l<nb; l++)
+    {
+      const double dr = r[i0+l] - rp, dtheta = theta[i0+l] - thetap;
+      s2[l] = alpha20*(dr*dr) + alpha02*(dtheta*dtheta) + beta*(Q[l]*Q[l]);
+    }
+    effsource_sqrt(nb, s2, sqrts2);
+
+    /* Results are first stored contiguously for the block, as in
+       effsource_calc_grid_ctx */
+    for(int l=0; l<nb; l++)
+    {
+      const double dr = r[i0+l] - rp, dtheta = theta[i0+l] - thetap;
+      const double R = 2.0*Q[l]*cosh[l], dR_dph = (cosh[l] - Q[l])*(cosh[l] + Q[l]);
+      struct calc_partials p;
+      calc_partials_init(ctx, dr, dtheta, Q[l], R, &p);
+
+      calc_finish(ctx, r[i0+l], dr, dtheta, Q[l], 0.5*cosh[l], R, dR_dph, sinth[l]*sinth[l],
+        2.0*sinth[l]*costh[l], (costh[l] - sinth[l])*(costh[l] + sinth[l]), &p, s2[l],
+        sqrts2[l], CALC_BLOCK, &out[0][l], &out[1][l], &out[5][l], &out[15][l]);
+    }
+
+    memcpy(PhiS+i0, out[0], nb*sizeof(double));
+    for(int d=0; d<4; d++)
+      memcpy(dPhiS_dx+d*stride+i0, out[1+d], nb*sizeof(double));
+    for(int d=0; d<10; d++)
+      memcpy(d2PhiS_dx2+d*stride+i0, out[5+d], nb*sizeof(double));
+    memcpy(src+i0, out[15], nb*sizeof(double));
+  }
+}
+
+/* Compute all m-modes 0 <= m <= m_max at a single point. The results for mode m
+   are stored at PhiS+2*m, dPhiS_dx+8*m, d2PhiS_dx2+20*m and src+2*m. The
+   m-independent quantities are computed once and the phase factors are
+   generated by recurrence in m, as are the values from effsource_mode_values
+   for the modes which need them. */
+void effsource_calc_allm_ctx(struct effsource_ctx * ctx, int m_max, struct coordinate * x,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  if(!mode_supported(m_max))
+    return;
+  particle_dt_require(ctx);
+
+  struct mode_point p;
+  double ellK, ellE;
+  mode_point_init(ctx, x->r, x->theta, &p);
+  effsource_ellint_KE(1, &p.C1, &ellK, &ellE);
+  mode_point_ellip(&p, ellK, ellE);
+
+  const double cosph  = cos(ctx->xp.phi);
+  const double sinph  = sin(ctx->xp.phi);
+  const double coscdr = cos(ctx->c*p.dr);
+  const double sincdr = sin(ctx->c*p.dr);
+
+  /* The values from effsource_mode_values are computed from m_values on, a
+     block of EFFSOURCE_M_INIT+1 modes at a time, starting at m_block */
+  int m_values = 0, m_block = 0;
+  while(m_values <= m_max && effsource_mode_poly(m_values, p.C1))
+    m_values++;
+  double F_re[EFFSOURCE_M_INIT+1][5][3], F_im[EFFSOURCE_M_INIT+1][5][3];
+
+  double cosmph = 1, sinmph = 0, coscmdr = 1, sincmdr = 0;
+  for(int m=0; m<=m_max; m++)
+  {
+    if(m == m_values || (m > m_values && m % (EFFSOURCE_M_INIT+1) == 0))
+    {
+      const int m1 = m - m % (EFFSOURCE_M_INIT+1) + EFFSOURCE_M_INIT;
+      m_block = m;
+      effsource_mode_values(m, m1 < m_max ? m1 : m_max, p.C1, ellK, ellE, F_re, F_im);
+    }
+
+    calc_m_mode(ctx, &p, m, cosmph, sinmph, coscmdr, sincmdr,
+      m >= m_values ? F_re[m-m_block] : NULL, m >= m_values ? F_im[m-m_block] : NULL, 1,
+      PhiS+2*m, dPhiS_dx+8*m, d2PhiS_dx2+20*m, src+2*m);
+
+    const double cosmph_next  = cosmph*cosph - sinmph*sinph;
+    const double coscmdr_next = coscmdr*coscdr - sincmdr*sincdr;
+    sinmph  = sinmph*cosph + cosmph*sinph;
+    sincmdr = sincmdr*coscdr + coscmdr*sincdr;
+    cosmph  = cosmph_next;
+    coscmdr = coscmdr_next;
+  }
+}
+
+/* Step x(t) to x(t+dt) along with its first and second derivatives, given
+   the constant third derivative */
+static inline void taylor_step(double * x, double * dxdt, double * d2xdt2, double d3xdt3,
+  double dt)
+{
+  *x += (*dxdt + (0.5*(*d2xdt2) + d3xdt3*dt/6.0)*dt)*dt;
+  *dxdt += (*d2xdt2 + 0.5*d3xdt3*dt)*dt;
+  *d2xdt2 += d3xdt3*dt;
+}
+
+/* The points at a distance M from the particle along each coordinate
+   direction, at which effsource_advance_ctx estimates its error */
+static void advance_probes(const struct effsource_ctx * ctx,
+  struct coordinate x[EFFSOURCE_ADVANCE_PROBES])
+{
+  for(int i = 0; i < EFFSOURCE_ADVANCE_PROBES; i++)
+  {
+    const double h = (i % 2 ? -1.0 : 1.0)*(i < 2 ? ctx->M : ctx->M/ctx->xp.r);
+    x[i] = ctx->xp;
+    if(i < 2)
+      x[i].r += h;
+    else if(i < 4)
+      x[i].theta += h;
+    else
+      x[i].phi += h;
+  }
+}
+
+/* Compute the response of the source at the probe points to the fourth time
+   derivatives of the coefficients A, alpha, beta and c, added in turn to
+   their values, first and second derivatives. It is linear in A and nearly
+   so in the others, and is found by a forward difference using the change the
+   fourth derivatives make over a time of half a radian of the orbit. Returns
+   -1 if no scratch context could be allocated. */
+static int advance_set_response(struct effsource_ctx * ctx)
+{
+  struct effsource_ctx * tmp = effsource_ctx_alloc();
+  if(tmp == NULL)
+    return -1;
+  tmp->xp = ctx->xp;
+  tmp->M = ctx->M;
+  tmp->a = ctx->a;
+  tmp->dt_set = 1;
+
+  struct coordinate x[EFFSOURCE_ADVANCE_PROBES];
+  advance_probes(ctx, x);
+
+  double PhiS, dPhiS[4], d2PhiS[10], src, src0[EFFSOURCE_ADVANCE_PROBES];
+  ctx->advance_scale = 0.0;
+  for(int i = 0; i < EFFSOURCE_ADVANCE_PROBES; i++)
+  {
+    effsource_calc_ctx(ctx, &x[i], &PhiS, dPhiS, d2PhiS, &src0[i]);
+    ctx->advance_scale = fmax(ctx->advance_scale, fabs(src0[i]));
+  }
+
+  const double T = 0.5*sqrt(ctx->xp.r*ctx->xp.r*ctx->xp.r/ctx->M);
+  const double w[3] = {T*T*T*T/24.0, T*T*T/6.0, T*T/2.0};
+  double * const A[3] = {tmp->A, tmp->dAdt, tmp->d2Adt2};
+  double * const q[3][4] = {
+    {&tmp->alpha20, &tmp->alpha02, &tmp->beta, &tmp->c},
+    {&tmp->dalphadt20, &tmp->dalphadt02, &tmp->dbetadt, &tmp->dcdt},
+    {&tmp->d2alphadt220, &tmp->d2alphadt202, &tmp->d2betadt2, &tmp->d2cdt2}};
+  const double d4q[4] = {ctx->d4alphadt420, ctx->d4alphadt402, ctx->d4betadt4, ctx->d4cdt4};
+  for(int k = 0; k < 3; k++)
+  {
+    memcpy(EFFSOURCE_BLOCK(tmp), EFFSOURCE_BLOCK(ctx), EFFSOURCE_BLOCK_SIZE*sizeof(double));
+    for(int n = 0; n < EFFSOURCE_NUM_COEFFS; n++)
+      A[k][n] += w[k]*ctx->d4Adt4[n];
+    for(int n = 0; n < 4; n++)
+      *q[k][n] += w[k]*d4q[n];
+    effsource_set_particle_dC1(tmp);
+
+    for(int i = 0; i < EFFSOURCE_ADVANCE_PROBES; i++)
+    {
+      effsource_calc_ctx(tmp, &x[i], &PhiS, dPhiS, d2PhiS, &src);
+      ctx->advance_response[k][i] = (src - src0[i])/w[k];
+    }
+  }
+
+  effsource_ctx_free(tmp);
+  ctx->advance_set = 1;
+  return 0;
+}
+
+/* Advance the particle by dt in t using the Taylor series of its position and
+   of the coefficients to third order. The velocity and acceleration of the
+   particle at the new position are cheap to compute exactly, and ur is put
+   back on the orbit. Since the third time derivatives are held fixed from the
+   last call to effsource_set_particle_ctx, at time t_set, the error of the
+   extrapolation after a time T = t - t_set is dominated by the fourth
+   derivatives, which change the values, first and second derivatives by
+   T^4/24, T^3/6 and T^2/2 times d4. The change this makes in the source at
+   the probe points, relative to its largest magnitude there, is the estimated
+   error; if it exceeds tol all coefficients are recomputed at the new
+   position instead. Returns 0 if the Taylor series were used and 1 if the
+   coefficients were recomputed. */
+int effsource_advance_ctx(struct effsource_ctx * ctx, double dt, double tol)
+{
+  particle_dt_require(ctx);
+
+  struct coordinate xp = ctx->xp;
+  xp.t += dt;
+  xp.r += (ctx->rt + (0.5*ctx->rtt + ctx->rttt*dt/6.0)*dt)*dt;
+  xp.phi += (ctx->phit + (0.5*ctx->phitt + ctx->phittt*dt/6.0)*dt)*dt;
+  const double ur = effsource_orbit_ur(ctx, xp.r,
+    ctx->ur + (ctx->urt + (0.5*ctx->urtt + ctx->urttt*dt/6.0)*dt)*dt);
+
+  const double T = xp.t - ctx->t_set;
+  const double w[3] = {T*T*T*T/24.0, T*T*T/6.0, T*T/2.0};
+  double err = INFINITY;
+  if(ctx->advance_set || advance_set_response(ctx) == 0)
+  {
+    err = 0.0;
+    for(int i = 0; i < EFFSOURCE_ADVANCE_PROBES; i++)
+      err = fmax(err, fabs(w[0]*ctx->advance_response[0][i] + w[1]*ctx->advance_response[1][i]
+                           + w[2]*ctx->advance_response[2][i]));
+  }
+  if(!(err <= tol*ctx->advance_scale))
+  {
+    effsource_set_particle_ctx(ctx, &xp, ctx->E, ctx->L, ur);
+    return 1;
+  }
+
+  effsource_set_particle_kinematics(ctx, xp.r, ur);
+  for(int i = 0; i < EFFSOURCE_NUM_COEFFS; i++)
+    taylor_step(&ctx->A[i], &ctx->dAdt[i], &ctx->d2Adt2[i], ctx->d3Adt3[i], dt);
+  taylor_step(&ctx->alpha20, &ctx->dalphadt20, &ctx->d2alphadt220, ctx->d3alphadt320, dt);
+  taylor_step(&ctx->alpha02, &ctx->dalphadt02, &ctx->d2alphadt202, ctx->d3alphadt302, dt);
+  taylor_step(&ctx->beta, &ctx->dbetadt, &ctx->d2betadt2, ctx->d3betadt3, dt);
+  taylor_step(&ctx->c, &ctx->dcdt, &ctx->d2cdt2, ctx->d3cdt3, dt);
+  ctx->xp = xp;
+  ctx->ur = ur;
+  effsource_set_particle_dC1(ctx);
+
+  if(ctx->share != NULL && ctx->share->leader)
+    effsource_share_write(ctx);
+
+  return 0;
+}
+
+/* Layout of the shared memory object. The leader makes seq odd while it
+   writes and even again once the particle's state and block are complete, so
+   a follower's copy is consistent if seq was even and unchanged across it. */
+enum { SHARE_VERSION = 1 };
+
+struct effsource_share_segment {
+  uint64_t seq;
+  uint32_t version, block_size;
+  double M, a, E, L, ur, t_set;
+  struct coordinate xp;
+  double block[EFFSOURCE_BLOCK_SIZE];
+};
+
+/* Map the segment created by the leader, if it exists yet */
+static int share_attach(struct effsource_share * share)
+{
+  const int fd = shm_open(share->name, O_RDONLY, 0);
+  if(fd < 0)
+    return -1;
+  struct stat st;
+  void * map = MAP_FAILED;
+  if(fstat(fd, &st) == 0 && (size_t) st.st_size == sizeof(struct effsource_share_segment))
+    map = mmap(NULL, sizeof(struct effsource_share_segment), PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(map == MAP_FAILED)
+    return -1;
+  __atomic_store_n(&share->segment, map, __ATOMIC_RELEASE);
+  return 0;
+}
+
+static double share_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+/* Copy the block published by the leader for this particle's state into ctx,
+   waiting for the leader to create the segment and publish the block. Returns
+   -1 if the segment does not appear or the block is not published within
+   share->timeout. */
+int effsource_share_read(struct effsource_ctx * ctx, const struct coordinate * x_p,
+  double E, double L, double ur)
+{
+  struct effsource_share * share = ctx->share;
+  const struct effsource_share_segment * segment =
+    __atomic_load_n(&share->segment, __ATOMIC_ACQUIRE);
+
+  struct effsource_share_segment copy;
+  double deadline = 0.0;
+  for(;;)
+  {
+    if(segment == NULL)
+    {
+      pthread_mutex_lock(&share->lock);
+      if(share->segment == NULL)
+        share_attach(share);
+      segment = share->segment;
+      pthread_mutex_unlock(&share->lock);
+    }
+
+    if(segment != NULL)
+    {
+      const uint64_t seq = __atomic_load_n(&segment->seq, __ATOMIC_ACQUIRE);
+      if(seq != 0 && seq % 2 == 0)
+      {
+        memcpy(&copy, segment, sizeof(copy));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if(__atomic_load_n(&segment->seq, __ATOMIC_RELAXED) == seq &&
+           copy.version == SHARE_VERSION && copy.block_size == EFFSOURCE_BLOCK_SIZE &&
+           copy.M == ctx->M && copy.a == ctx->a && copy.E == E && copy.L == L &&
+           copy.ur == ur && copy.xp.r == x_p->r && copy.xp.theta == x_p->theta &&
+           copy.xp.phi == x_p->phi && copy.xp.t == x_p->t)
+          break;
+      }
+    }
+
+    const double now = share_time();
+    if(deadline == 0.0)
+      deadline = now + share->timeout;
+    else if(share->timeout >= 0.0 && now > deadline)
+      return -1;
+    sched_yield();
+  }
+
+  ctx->xp = *x_p;
+  ctx->ur = ur;
+  ctx->E = E;
+  ctx->L = L;
+  ctx->t_set = copy.t_set;
+  ctx->advance_set = 0;
+  memcpy(EFFSOURCE_BLOCK(ctx), copy.block, sizeof(copy.block));
+  ctx->dt_set = 1;
+  return 0;
+}
+
+/* Publish the block of ctx, including the time derivatives. Contexts
+   referencing the same share publish one at a time. */
+void effsource_share_write(struct effsource_ctx * ctx)
+{
+  particle_dt_require(ctx);
+
+  struct effsource_share * share = ctx->share;
+  pthread_mutex_lock(&share->lock);
+  struct effsource_share_segment * segment = share->segment;
+  const uint64_t seq = segment->seq;
+  __atomic_store_n(&segment->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  segment->version = SHARE_VERSION;
+  segment->block_size = EFFSOURCE_BLOCK_SIZE;
+  segment->M = ctx->M;
+  segment->a = ctx->a;
+  segment->E = ctx->E;
+  segment->L = ctx->L;
+  segment->ur = ctx->ur;
+  segment->t_set = ctx->t_set;
+  segment->xp = ctx->xp;
+  memcpy(segment->block, EFFSOURCE_BLOCK(ctx), sizeof(segment->block));
+
+  __atomic_store_n(&segment->seq, seq + 2, __ATOMIC_RELEASE);
+  pthread_mutex_unlock(&share->lock);
+}
+
+/* Share the coefficients with other processes through the POSIX shared memory
+   object name. The leader creates it; followers map it on first use. */
+int effsource_share_ctx(struct effsource_ctx * ctx, const char * name, int leader,
+  double timeout)
+{
+  effsource_unshare_ctx(ctx);
+
+  struct effsource_share * share = calloc(1, sizeof(struct effsource_share));
+  if(share == NULL)
+    return -1;
+  share->name = strdup(name);
+  share->leader = leader;
+  share->timeout = timeout;
+  share->refs = 1;
+  if(share->name == NULL)
+  {
+    free(share);
+    return -1;
+  }
+
+  if(leader)
+  {
+    const int fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+    void * map = MAP_FAILED;
+    if(fd >= 0)
+    {
+      if(ftruncate(fd, sizeof(struct effsource_share_segment)) == 0)
+        map = mmap(NULL, sizeof(struct effsource_share_segment), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, fd, 0);
+      close(fd);
+    }
+    if(map == MAP_FAILED)
+    {
+      free(share->name);
+      free(share);
+      return -1;
+    }
+    share->segment = map;
+  }
+
+  pthread_mutex_init(&share->lock, NULL);
+  ctx->share = share;
+  return 0;
+}
+
+/* Release the reference of ctx to its share, unmapping the segment with the
+   last one */
+void effsource_unshare_ctx(struct effsource_ctx * ctx)
+{
+  struct effsource_share * share = ctx->share;
+  if(share == NULL)
+    return;
+  ctx->share = NULL;
+  if(__atomic_sub_fetch(&share->refs, 1, __ATOMIC_ACQ_REL) > 0)
+    return;
+  if(share->segment != NULL)
+    munmap(share->segment, sizeof(struct effsource_share_segment));
+  if(share->leader)
+    shm_unlink(share->name);
+  pthread_mutex_destroy(&share->lock);
+  free(share->name);
+  free(share);
+}
+
+int effsource_share_served_ctx(struct effsource_ctx * ctx)
+{
+  return ctx->share_served;
+}
+
+/* Allocate a new context. It must be initialized with effsource_init_ctx and
+   effsource_set_particle_ctx before use. */
+struct effsource_ctx * effsource_ctx_alloc(void)
+{
+  /* The coefficient arrays are aligned for vector loads */
+  void * ctx;
+  if(posix_memalign(&ctx, 64, sizeof(struct effsource_ctx)) != 0)
+    return NULL;
+  memset(ctx, 0, sizeof(struct effsource_ctx));
+  pthread_mutex_init(&((struct effsource_ctx *) ctx)->dt_lock, NULL);
+  return ctx;
+}
+
+void effsource_ctx_free(struct effsource_ctx * ctx)
+{
+  effsource_fit_free(ctx);
+  effsource_unshare_ctx(ctx);
+  pthread_mutex_destroy(&ctx->dt_lock);
+  free(ctx);
+}
+
+void effsource_support_ctx(struct effsource_ctx * ctx, double W,
+  struct effsource_box * box)
+{
+  effsource_support_box(&ctx->xp, ctx->alpha20, ctx->alpha02, ctx->beta, ctx->c, W,
+    box);
+}
+
+void effsource_support_cartesian_ctx(struct effsource_ctx * ctx, double W,
+  struct effsource_box * box)
+{
+  struct effsource_box sph;
+  effsource_support_ctx(ctx, W, &sph);
+  effsource_box_cartesian(ctx->a, &sph, box);
+}
+
+int effsource_box_intersects_ctx(struct effsource_ctx * ctx, double W,
+  const struct effsource_box * box)
+{
+  return effsource_support_intersects(&ctx->xp, ctx->alpha20, ctx->alpha02, ctx->beta,
+    ctx->c, W, box);
+}
+
+/* A copy of the particle's state, including its time derivatives, for
+   asynchronous jobs. It shares neither the orbit fit nor the shared memory
+   segment of ctx. */
+static struct effsource_ctx * ctx_snapshot(struct effsource_ctx * ctx)
+{
+  particle_dt_require(ctx);
+
+  struct effsource_ctx * snapshot = effsource_ctx_alloc();
+  if(snapshot == NULL)
+    return NULL;
+  pthread_mutex_destroy(&snapshot->dt_lock);
+  memcpy(snapshot, ctx, sizeof(struct effsource_ctx));
+  pthread_mutex_init(&snapshot->dt_lock, NULL);
+  snapshot->fit = NULL;
+  snapshot->share = NULL;
+  return snapshot;
+}
+
+int effsource_calc_patches_ctx(struct effsource_ctx * ctx, int npatches,
+  const struct effsource_patch * patches, double window, int nthreads)
+{
+  particle_dt_require(ctx);
+
+  return effsource_patches_eval(ctx, -1, npatches, patches, window, nthreads);
+}
+
+int effsource_calc_m_patches_ctx(struct effsource_ctx * ctx, int m, int npatches,
+  const struct effsource_patch * patches, double window, int nthreads)
+{
+  if(!mode_supported(m))
+    return -1;
+  particle_dt_require(ctx);
+
+  return effsource_patches_eval(ctx, m, npatches, patches, window, nthreads);
+}
+
+effsource_job * effsource_calc_patches_async_ctx(struct effsource_ctx * ctx,
+  int npatches, const struct effsource_patch * patches, double window, int nthreads)
+{
+  struct effsource_ctx * snapshot = ctx_snapshot(ctx);
+  if(snapshot == NULL)
+    return NULL;
+  return effsource_patches_submit(snapshot, -1, npatches, patches, window, nthreads);
+}
+
+effsource_job * effsource_calc_m_patches_async_ctx(struct effsource_ctx * ctx, int m,
+  int npatches, const struct effsource_patch * patches, double window, int nthreads)
+{
+  if(!mode_supported(m))
+    return NULL;
+  struct effsource_ctx * snapshot = ctx_snapshot(ctx);
+  if(snapshot == NULL)
+    return NULL;
+  return effsource_patches_submit(snapshot, m, npatches, patches, window, nthreads);
+}
+
+int effsource_job_test(effsource_job * job)
+{
+  return effsource_job_finished(job);
+}
+
+int effsource_job_wait(effsource_job * job)
+{
+  return effsource_job_complete(job);
+}
+
+void effsource_pool_free(void)
+{
+  effsource_pool_free_threads();
+}
+
+/* Contexts used by the non-reentrant interface. The evaluation functions use
+   the current slot, while effsource_set_particle_next prepares the other one,
+   which effsource_swap then makes current. */
+static struct effsource_ctx default_ctx[2] = {
+  {.dt_lock = PTHREAD_MUTEX_INITIALIZER}, {.dt_lock = PTHREAD_MUTEX_INITIALIZER}};
+static struct effsource_ctx * current_ctx = &default_ctx[0];
+
+/* Whether the next slot has been prepared since the last swap */
+static int next_prepared;
+
+static inline struct effsource_ctx * current_slot(void)
+{
+  return __atomic_load_n(&current_ctx, __ATOMIC_ACQUIRE);
+}
+
+static inline struct effsource_ctx * next_slot(void)
+{
+  return current_slot() == &default_ctx[0] ? &default_ctx[1] : &default_ctx[0];
+}
+
+void effsource_init(double mass, double spin)
+{
+  effsource_init_ctx(&default_ctx[0], mass, spin);
+  effsource_init_ctx(&default_ctx[1], mass, spin);
+  __atomic_store_n(&next_prepared, 0, __ATOMIC_RELEASE);
+}
+
+void effsource_set_particle(struct coordinate * x_p, double E, double L, double ur)
+{
+  effsource_set_particle_ctx(current_slot(), x_p, E, L, ur);
+}
+
+void effsource_set_particle_next(struct coordinate * x_p, double E, double L, double ur)
+{
+  struct effsource_ctx * ctx = next_slot();
+  effsource_set_particle_ctx(ctx, x_p, E, L, ur);
+
+  /* Compute the time derivatives now so that evaluations after the swap do
+     not wait for them */
+  particle_dt_require(ctx);
+  __atomic_store_n(&next_prepared, 1, __ATOMIC_RELEASE);
+}
+
+void effsource_swap(void)
+{
+  if(!__atomic_exchange_n(&next_prepared, 0, __ATOMIC_ACQ_REL))
+    return;
+  __atomic_store_n(&current_ctx, next_slot(), __ATOMIC_RELEASE);
+}
+
+/* Both slots reference the fit and the share of the first one */
+static void slots_share_fit(void)
+{
+  struct effsource_fit * fit = default_ctx[0].fit;
+  effsource_fit_free(&default_ctx[1]);
+  if(fit == NULL)
+    return;
+  __atomic_add_fetch(&fit->refs, 1, __ATOMIC_RELAXED);
+  default_ctx[1].fit = fit;
+}
+
+static void slots_share_share(void)
+{
+  struct effsource_share * share = default_ctx[0].share;
+  effsource_unshare_ctx(&default_ctx[1]);
+  if(share == NULL)
+    return;
+  __atomic_add_fetch(&share->refs, 1, __ATOMIC_RELAXED);
+  default_ctx[1].share = share;
+}
+
+int effsource_fit_orbit(double E, double L, double r_min, double r_max, double tol)
+{
+  const int status = effsource_fit_orbit_ctx(&default_ctx[0], E, L, r_min, r_max, tol);
+  slots_share_fit();
+  return status;
+}
+
+int effsource_advance(double dt, double tol)
+{
+  return effsource_advance_ctx(current_slot(), dt, tol);
+}
+
+int effsource_share(const char * name, int leader, double timeout)
+{
+  const int status = effsource_share_ctx(&default_ctx[0], name, leader, timeout);
+  slots_share_share();
+  return status;
+}
+
+void effsource_unshare(void)
+{
+  effsource_unshare_ctx(&default_ctx[0]);
+  effsource_unshare_ctx(&default_ctx[1]);
+}
+
+int effsource_share_served(void)
+{
+  return effsource_share_served_ctx(current_slot());
+}
+
+int effsource_fit_save(const char * filename)
+{
+  return effsource_fit_save_ctx(current_slot(), filename);
+}
+
+int effsource_fit_load(const char * filename)
+{
+  const int status = effsource_fit_load_ctx(&default_ctx[0], filename);
+  slots_share_fit();
+  return status;
+}
+
+void effsource_support(double W, struct effsource_box * box)
+{
+  effsource_support_ctx(current_slot(), W, box);
+}
+
+void effsource_support_cartesian(double W, struct effsource_box * box)
+{
+  effsource_support_cartesian_ctx(current_slot(), W, box);
+}
+
+int effsource_box_intersects(double W, const struct effsource_box * box)
+{
+  return effsource_box_intersects_ctx(current_slot(), W, box);
+}
+
+void effsource_calc_m_batch(int m, int n, const double * r, const double * theta,
+  int stride, double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src)
+{
+  effsource_calc_m_batch_ctx(current_slot(), m, n, r, theta, stride,
+    PhiS, dPhiS_dx, d2PhiS_dx2, src);
+}
+
+void effsource_calc_m_grid(int m, int nr, const double * r, int ntheta,
+  const double * theta, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src)
+{
+  effsource_calc_m_grid_ctx(current_slot(), m, nr, r, ntheta, theta, stride,
+    PhiS, dPhiS_dx, d2PhiS_dx2, src);
+}
+
+void effsource_calc_grid(int nr, const double * r, int ntheta, const double * theta,
+  int nphi, double phi0, double dphi, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src)
+{
+  effsource_calc_grid_ctx(current_slot(), nr, r, ntheta, theta, nphi, phi0, dphi,
+    stride, PhiS, dPhiS_dx, d2PhiS_dx2, src);
+}
+
+void effsource_calc_batch(int n, const double * r, const double * theta,
+  const double * phi, int stride,
+  double * PhiS, double * dPhiS_dx, double * d2PhiS_dx2, double * src)
+{
+  effsource_calc_batch_ctx(current_slot(), n, r, theta, phi, stride,
+    PhiS, dPhiS_dx, d2PhiS_dx2, src);
+}
+
+void effsource_calc_m_batch_fn(int m, int n, const double * r, const double * theta,
+  effsource_m_kernel kernel, void * data)
+{
+  effsource_calc_m_batch_fn_ctx(current_slot(), m, n, r, theta, kernel, data);
+}
+
+void effsource_calc_m_grid_fn(int m, int nr, const double * r, int ntheta,
+  const double * theta, effsource_m_kernel kernel, void * data)
+{
+  effsource_calc_m_grid_fn_ctx(current_slot(), m, nr, r, ntheta, theta, kernel, data);
+}
+
+int effsource_calc_patches(int npatches, const struct effsource_patch * patches,
+  double window, int nthreads)
+{
+  return effsource_calc_patches_ctx(current_slot(), npatches, patches, window, nthreads);
+}
+
+int effsource_calc_m_patches(int m, int npatches, const struct effsource_patch * patches,
+  double window, int nthreads)
+{
+  return effsource_calc_m_patches_ctx(current_slot(), m, npatches, patches, window, nthreads);
+}
+
+effsource_job * effsource_calc_patches_async(int npatches,
+  const struct effsource_patch * patches, double window, int nthreads)
+{
+  return effsource_calc_patches_async_ctx(current_slot(), npatches, patches, window,
+    nthreads);
+}
+
+effsource_job * effsource_calc_m_patches_async(int m, int npatches,
+  const struct effsource_patch * patches, double window, int nthreads)
+{
+  return effsource_calc_m_patches_async_ctx(current_slot(), m, npatches, patches,
+    window, nthreads);
+}
+
+void effsource_PhiS(struct coordinate * x, double * PhiS)
+{
+  effsource_PhiS_ctx(current_slot(), x, PhiS);
+}
+
+void effsource_PhiS_m(int m, struct coordinate * x, double * PhiS)
+{
+  effsource_PhiS_m_ctx(current_slot(), m, x, PhiS);
+}
+
+void effsource_calc(struct coordinate * x,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  effsource_calc_ctx(current_slot(), x, PhiS, dPhiS_dx, d2PhiS_dx2, src);
+}
+
+void effsource_calc_m(int m, struct coordinate * x,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  effsource_calc_m_ctx(current_slot(), m, x, PhiS, dPhiS_dx, d2PhiS_dx2, src);
+}
+
+void effsource_calc_allm(int m_max, struct coordinate * x,
+  double *PhiS, double *dPhiS_dx, double *d2PhiS_dx2, double *src)
+{
+  effsource_calc_allm_ctx(current_slot(), m_max, x, PhiS, dPhiS_dx, d2PhiS_dx2, src);
 }
@@ -0,0 +1,577 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Barry Wardell
+ ******************************************************************************/
+
+/* Internal state shared between kerr-equatorial.c and
+   kerr-equatorial-coeffs.c. This must be included after effsource.h. */
+
+#include <stddef.h>
+#include <pthread.h>
+
+/* The numerator of the singular field is a sum of terms
+   dr^a dtheta^(2b) Q^(2j) R^ri with Q = sin(dphib/2), R = sin(dphib) and
+   ri = 0 or 1. The non-zero terms are those with j+b <= 4 and
+   max(6-2(j+b), 0) <= a <= 9-ri-2(j+b). For each (ri, j, b) the coefficients
+   of these powers of dr are stored contiguously in increasing order of a,
+   starting at index effsource_num_offset[ri][j][b] and ordered by ri, then j,
+   then b. */
+#define EFFSOURCE_NUM_COEFFS 85
+
+/* Number of coefficients of powers of r_p and ur in the tabulated numerators
+   of kerr-equatorial-coeffs.c */
+#define EFFSOURCE_ORBIT_COEFFS 4803
+
+static const int effsource_num_offset[2][5][5] =
+ {{{ 0,  4,  8, 12, 16}, {18, 22, 26, 30, -1}, {32, 36, 40, -1, -1}, {42, 46, -1, -1, -1}, {48, -1, -1, -1, -1}},
+  {{50, 53, 56, 59, 62}, {63, 66, 69, 72, -1}, {73, 76, 79, -1, -1}, {80, 83, -1, -1, -1}, {84, -1, -1, -1, -1}}};
+
+/* Number of points at which effsource_advance_ctx estimates its error */
+#define EFFSOURCE_ADVANCE_PROBES 6
+
+struct effsource_ctx {
+  /* The particle's coordinate location and 4-velocity */
+  struct coordinate xp;
+
+  /* Mass and spin of the Kerr black hole */
+  double M, a;
+
+  /* Coefficients of the series expansions and their time derivatives, stored
+     packed by exponent as described above. The third and fourth derivatives
+     are only used by effsource_advance_ctx. */
+  double A[EFFSOURCE_NUM_COEFFS] __attribute__ ((aligned (64)));
+  double dAdt[EFFSOURCE_NUM_COEFFS] __attribute__ ((aligned (64)));
+  double d2Adt2[EFFSOURCE_NUM_COEFFS] __attribute__ ((aligned (64)));
+  double d3Adt3[EFFSOURCE_NUM_COEFFS] __attribute__ ((aligned (64)));
+  double d4Adt4[EFFSOURCE_NUM_COEFFS] __attribute__ ((aligned (64)));
+
+  /* Coefficients of the denominator and of the twisted phi coordinate */
+  double alpha20, alpha02, beta, c;
+  double dalphadt20, dalphadt02, dbetadt, dcdt;
+  double d2alphadt220, d2alphadt202, d2betadt2, d2cdt2;
+  double d3alphadt320, d3alphadt302, d3betadt3, d3cdt3;
+  double d4alphadt420, d4alphadt402, d4betadt4, d4cdt4;
+
+  /* Time derivatives of the particle's position and velocity */
+  double rt, urt, rtt, urtt, phit, phitt;
+  double rttt, urttt, phittt;
+
+  /* Coefficients of the time derivatives of C1 = alpha/beta */
+  double dC1_dt02, dC1_dt10, dC1_dt20;
+  double d2C1_dt200, d2C1_dt202, d2C1_dt210, d2C1_dt220;
+
+  /* Radial component of the particle's 4-velocity and its constants of
+     motion */
+  double ur, E, L;
+
+  /* The time derivatives of the coefficients are computed on first use after
+     effsource_set_particle_ctx, when dt_set is zero */
+  int dt_set;
+  pthread_mutex_t dt_lock;
+
+  /* The time of the particle when the coefficients were last computed by
+     effsource_set_particle_ctx rather than extrapolated by
+     effsource_advance_ctx */
+  double t_set;
+
+  /* The response of the effective source at the probe points of
+     effsource_advance_ctx to the fourth time derivatives in the values, first
+     and second derivatives of the coefficients, and the largest magnitude of
+     the source there, valid if advance_set is non-zero */
+  int advance_set;
+  double advance_scale;
+  double advance_response[3][EFFSOURCE_ADVANCE_PROBES];
+
+  /* Coefficients of the powers of r_p and ur in the numerators above for the
+     constants of motion orbit_E and orbit_L, valid if orbit_set is non-zero */
+  double orbit_E, orbit_L;
+  int orbit_set;
+  double orbit_coeffs[EFFSOURCE_ORBIT_COEFFS];
+
+  /* Fits of the coefficients along the orbit, or NULL */
+  struct effsource_fit * fit;
+
+  /* Shared memory through which the block is exchanged with other processes,
+     or NULL, and whether the last call to effsource_set_particle_ctx copied
+     the block from it */
+  struct effsource_share * share;
+  int share_served;
+};
+
+/* Everything computed from the particle's state, from A up to d2C1_dt220, is
+   stored in one block of EFFSOURCE_BLOCK_SIZE doubles starting at A */
+#define EFFSOURCE_BLOCK_SIZE ((offsetof(struct effsource_ctx, d2C1_dt220) + sizeof(double) \
+  - offsetof(struct effsource_ctx, A))/sizeof(double))
+#define EFFSOURCE_BLOCK(ctx) ((double *) ((char *) (ctx) + offsetof(struct effsource_ctx, A)))
+
+/* Piecewise Chebyshev fits of the block in r_p along an orbit with constants
+   of motion E and L. On the piece r[i] <= r_p <= r[i+1] element k of the
+   block is
+     sum_n T_n(x) (coeffs[i][n][0][k] + ur coeffs[i][n][1][k])
+   where x maps the piece to [-1, 1] and 0 <= n < EFFSOURCE_FIT_ORDER. If the
+   fit was loaded from a file, r and coeffs point into a read-only mapping of
+   map_size bytes at map; otherwise map is NULL. A fit may be referenced by
+   several contexts, refs of them, and is freed with the last one. */
+#define EFFSOURCE_FIT_ORDER 16
+
+struct effsource_fit {
+  double E, L;
+  int npieces;
+  double * r;
+  double (* coeffs)[EFFSOURCE_FIT_ORDER][2][EFFSOURCE_BLOCK_SIZE];
+  void * map;
+  size_t map_size;
+  int refs;
+};
+
+/* A context sharing the block through the POSIX shared memory object name.
+   The leader publishes the block computed by each call to
+   effsource_set_particle_ctx to segment; followers map segment read-only,
+   once the leader has created it, and copy the block from it if it is
+   published within timeout seconds (or at all, if timeout < 0). It may be
+   referenced by several contexts, refs of them, whose writes to segment and
+   attachment of it are serialized by lock. */
+struct effsource_share {
+  char * name;
+  int leader;
+  double timeout;
+  struct effsource_share_segment * segment;
+  int refs;
+  pthread_mutex_t lock;
+};
+
+/* The tables in kerr-equatorial-coeffs.c refer to the coefficients by name.
+   The digits give the powers of dr, dtheta and Q and of R. */
+#define A0060 A[42]
+#define A0061 A[80]
+#define A0080 A[48]
+#define A0081 A[84]
+#define A0240 A[36]
+#define A0241 A[76]
+#define A0260 A[46]
+#define A0261 A[83]
+#define A0420 A[26]
+#define A0421 A[69]
+#define A0440 A[40]
+#define A0441 A[79]
+#define A0600 A[12]
+#define A0601 A[59]
+#define A0620 A[30]
+#define A0621 A[72]
+#define A0800 A[16]
+#define A0801 A[62]
+#define A1060 A[43]
+#define A1061 A[81]
+#define A1080 A[49]
+#define A1240 A[37]
+#define A1241 A[77]
+#define A1260 A[47]
+#define A1420 A[27]
+#define A1421 A[70]
+#define A1440 A[41]
+#define A1600 A[13]
+#define A1601 A[60]
+#define A1620 A[31]
+#define A1800 A[17]
+#define A2040 A[32]
+#define A2041 A[73]
+#define A2060 A[44]
+#define A2061 A[82]
+#define A2220 A[22]
+#define A2221 A[66]
+#define A2240 A[38]
+#define A2241 A[78]
+#define A2400 A[8]
+#define A2401 A[56]
+#define A2420 A[28]
+#define A2421 A[71]
+#define A2600 A[14]
+#define A2601 A[61]
+#define A3040 A[33]
+#define A3041 A[74]
+#define A3060 A[45]
+#define A3220 A[23]
+#define A3221 A[67]
+#define A3240 A[39]
+#define A3400 A[9]
+#define A3401 A[57]
+#define A3420 A[29]
+#define A3600 A[15]
+#define A4020 A[18]
+#define A4021 A[63]
+#define A4040 A[34]
+#define A4041 A[75]
+#define A4200 A[4]
+#define A4201 A[53]
+#define A4220 A[24]
+#define A4221 A[68]
+#define A4400 A[10]
+#define A4401 A[58]
+#define A5020 A[19]
+#define A5021 A[64]
+#define A5040 A[35]
+#define A5200 A[5]
+#define A5201 A[54]
+#define A5220 A[25]
+#define A5400 A[11]
+#define A6000 A[0]
+#define A6001 A[50]
+#define A6020 A[20]
+#define A6021 A[65]
+#define A6200 A[6]
+#define A6201 A[55]
+#define A7000 A[1]
+#define A7001 A[51]
+#define A7020 A[21]
+#define A7200 A[7]
+#define A8000 A[2]
+#define A8001 A[52]
+#define A9000 A[3]
+#define dAdt0060 dAdt[42]
+#define dAdt0061 dAdt[80]
+#define dAdt0080 dAdt[48]
+#define dAdt0081 dAdt[84]
+#define dAdt0240 dAdt[36]
+#define dAdt0241 dAdt[76]
+#define dAdt0260 dAdt[46]
+#define dAdt0261 dAdt[83]
+#define dAdt0420 dAdt[26]
+#define dAdt0421 dAdt[69]
+#define dAdt0440 dAdt[40]
+#define dAdt0441 dAdt[79]
+#define dAdt0600 dAdt[12]
+#define dAdt0601 dAdt[59]
+#define dAdt0620 dAdt[30]
+#define dAdt0621 dAdt[72]
+#define dAdt0800 dAdt[16]
+#define dAdt0801 dAdt[62]
+#define dAdt1060 dAdt[43]
+#define dAdt1061 dAdt[81]
+#define dAdt1080 dAdt[49]
+#define dAdt1240 dAdt[37]
+#define dAdt1241 dAdt[77]
+#define dAdt1260 dAdt[47]
+#define dAdt1420 dAdt[27]
+#define dAdt1421 dAdt[70]
+#define dAdt1440 dAdt[41]
+#define dAdt1600 dAdt[13]
+#define dAdt1601 dAdt[60]
+#define dAdt1620 dAdt[31]
+#define dAdt1800 dAdt[17]
+#define dAdt2040 dAdt[32]
+#define dAdt2041 dAdt[73]
+#define dAdt2060 dAdt[44]
+#define dAdt2061 dAdt[82]
+#define dAdt2220 dAdt[22]
+#define dAdt2221 dAdt[66]
+#define dAdt2240 dAdt[38]
+#define dAdt2241 dAdt[78]
+#define dAdt2400 dAdt[8]
+#define dAdt2401 dAdt[56]
+#define dAdt2420 dAdt[28]
+#define dAdt2421 dAdt[71]
+#define dAdt2600 dAdt[14]
+#define dAdt2601 dAdt[61]
+#define dAdt3040 dAdt[33]
+#define dAdt3041 dAdt[74]
+#define dAdt3060 dAdt[45]
+#define dAdt3220 dAdt[23]
+#define dAdt3221 dAdt[67]
+#define dAdt3240 dAdt[39]
+#define dAdt3400 dAdt[9]
+#define dAdt3401 dAdt[57]
+#define dAdt3420 dAdt[29]
+#define dAdt3600 dAdt[15]
+#define dAdt4020 dAdt[18]
+#define dAdt4021 dAdt[63]
+#define dAdt4040 dAdt[34]
+#define dAdt4041 dAdt[75]
+#define dAdt4200 dAdt[4]
+#define dAdt4201 dAdt[53]
+#define dAdt4220 dAdt[24]
+#define dAdt4221 dAdt[68]
+#define dAdt4400 dAdt[10]
+#define dAdt4401 dAdt[58]
+#define dAdt5020 dAdt[19]
+#define dAdt5021 dAdt[64]
+#define dAdt5040 dAdt[35]
+#define dAdt5200 dAdt[5]
+#define dAdt5201 dAdt[54]
+#define dAdt5220 dAdt[25]
+#define dAdt5400 dAdt[11]
+#define dAdt6000 dAdt[0]
+#define dAdt6001 dAdt[50]
+#define dAdt6020 dAdt[20]
+#define dAdt6021 dAdt[65]
+#define dAdt6200 dAdt[6]
+#define dAdt6201 dAdt[55]
+#define dAdt7000 dAdt[1]
+#define dAdt7001 dAdt[51]
+#define dAdt7020 dAdt[21]
+#define dAdt7200 dAdt[7]
+#define dAdt8000 dAdt[2]
+#define dAdt8001 dAdt[52]
+#define dAdt9000 dAdt[3]
+#define d2Adt20060 d2Adt2[42]
+#define d2Adt20061 d2Adt2[80]
+#define d2Adt20080 d2Adt2[48]
+#define d2Adt20081 d2Adt2[84]
+#define d2Adt20240 d2Adt2[36]
+#define d2Adt20241 d2Adt2[76]
+#define d2Adt20260 d2Adt2[46]
+#define d2Adt20261 d2Adt2[83]
+#define d2Adt20420 d2Adt2[26]
+#define d2Adt20421 d2Adt2[69]
+#define d2Adt20440 d2Adt2[40]
+#define d2Adt20441 d2Adt2[79]
+#define d2Adt20600 d2Adt2[12]
+#define d2Adt20601 d2Adt2[59]
+#define d2Adt20620 d2Adt2[30]
+#define d2Adt20621 d2Adt2[72]
+#define d2Adt20800 d2Adt2[16]
+#define d2Adt20801 d2Adt2[62]
+#define d2Adt21060 d2Adt2[43]
+#define d2Adt21061 d2Adt2[81]
+#define d2Adt21080 d2Adt2[49]
+#define d2Adt21240 d2Adt2[37]
+#define d2Adt21241 d2Adt2[77]
+#define d2Adt21260 d2Adt2[47]
+#define d2Adt21420 d2Adt2[27]
+#define d2Adt21421 d2Adt2[70]
+#define d2Adt21440 d2Adt2[41]
+#define d2Adt21600 d2Adt2[13]
+#define d2Adt21601 d2Adt2[60]
+#define d2Adt21620 d2Adt2[31]
+#define d2Adt21800 d2Adt2[17]
+#define d2Adt22040 d2Adt2[32]
+#define d2Adt22041 d2Adt2[73]
+#define d2Adt22060 d2Adt2[44]
+#define d2Adt22061 d2Adt2[82]
+#define d2Adt22220 d2Adt2[22]
+#define d2Adt22221 d2Adt2[66]
+#define d2Adt22240 d2Adt2[38]
+#define d2Adt22241 d2Adt2[78]
+#define d2Adt22400 d2Adt2[8]
+#define d2Adt22401 d2Adt2[56]
+#define d2Adt22420 d2Adt2[28]
+#define d2Adt22421 d2Adt2[71]
+#define d2Adt22600 d2Adt2[14]
+#define d2Adt22601 d2Adt2[61]
+#define d2Adt23040 d2Adt2[33]
+#define d2Adt23041 d2Adt2[74]
+#define d2Adt23060 d2Adt2[45]
+#define d2Adt23220 d2Adt2[23]
+#define d2Adt23221 d2Adt2[67]
+#define d2Adt23240 d2Adt2[39]
+#define d2Adt23400 d2Adt2[9]
+#define d2Adt23401 d2Adt2[57]
+#define d2Adt23420 d2Adt2[29]
+#define d2Adt23600 d2Adt2[15]
+#define d2Adt24020 d2Adt2[18]
+#define d2Adt24021 d2Adt2[63]
+#define d2Adt24040 d2Adt2[34]
+#define d2Adt24041 d2Adt2[75]
+#define d2Adt24200 d2Adt2[4]
+#define d2Adt24201 d2Adt2[53]
+#define d2Adt24220 d2Adt2[24]
+#define d2Adt24221 d2Adt2[68]
+#define d2Adt24400 d2Adt2[10]
+#define d2Adt24401 d2Adt2[58]
+#define d2Adt25020 d2Adt2[19]
+#define d2Adt25021 d2Adt2[64]
+#define d2Adt25040 d2Adt2[35]
+#define d2Adt25200 d2Adt2[5]
+#define d2Adt25201 d2Adt2[54]
+#define d2Adt25220 d2Adt2[25]
+#define d2Adt25400 d2Adt2[11]
+#define d2Adt26000 d2Adt2[0]
+#define d2Adt26001 d2Adt2[50]
+#define d2Adt26020 d2Adt2[20]
+#define d2Adt26021 d2Adt2[65]
+#define d2Adt26200 d2Adt2[6]
+#define d2Adt26201 d2Adt2[55]
+#define d2Adt27000 d2Adt2[1]
+#define d2Adt27001 d2Adt2[51]
+#define d2Adt27020 d2Adt2[21]
+#define d2Adt27200 d2Adt2[7]
+#define d2Adt28000 d2Adt2[2]
+#define d2Adt28001 d2Adt2[52]
+#define d2Adt29000 d2Adt2[3]
+#define d3Adt30060 d3Adt3[42]
+#define d3Adt30061 d3Adt3[80]
+#define d3Adt30080 d3Adt3[48]
+#define d3Adt30081 d3Adt3[84]
+#define d3Adt30240 d3Adt3[36]
+#define d3Adt30241 d3Adt3[76]
+#define d3Adt30260 d3Adt3[46]
+#define d3Adt30261 d3Adt3[83]
+#define d3Adt30420 d3Adt3[26]
+#define d3Adt30421 d3Adt3[69]
+#define d3Adt30440 d3Adt3[40]
+#define d3Adt30441 d3Adt3[79]
+#define d3Adt30600 d3Adt3[12]
+#define d3Adt30601 d3Adt3[59]
+#define d3Adt30620 d3Adt3[30]
+#define d3Adt30621 d3Adt3[72]
+#define d3Adt30800 d3Adt3[16]
+#define d3Adt30801 d3Adt3[62]
+#define d3Adt31060 d3Adt3[43]
+#define d3Adt31061 d3Adt3[81]
+#define d3Adt31080 d3Adt3[49]
+#define d3Adt31240 d3Adt3[37]
+#define d3Adt31241 d3Adt3[77]
+#define d3Adt31260 d3Adt3[47]
+#define d3Adt31420 d3Adt3[27]
+#define d3Adt31421 d3Adt3[70]
+#define d3Adt31440 d3Adt3[41]
+#define d3Adt31600 d3Adt3[13]
+#define d3Adt31601 d3Adt3[60]
+#define d3Adt31620 d3Adt3[31]
+#define d3Adt31800 d3Adt3[17]
+#define d3Adt32040 d3Adt3[32]
+#define d3Adt32041 d3Adt3[73]
+#define d3Adt32060 d3Adt3[44]
+#define d3Adt32061 d3Adt3[82]
+#define d3Adt32220 d3Adt3[22]
+#define d3Adt32221 d3Adt3[66]
+#define d3Adt32240 d3Adt3[38]
+#define d3Adt32241 d3Adt3[78]
+#define d3Adt32400 d3Adt3[8]
+#define d3Adt32401 d3Adt3[56]
+#define d3Adt32420 d3Adt3[28]
+#define d3Adt32421 d3Adt3[71]
+#define d3Adt32600 d3Adt3[14]
+#define d3Adt32601 d3Adt3[61]
+#define d3Adt33040 d3Adt3[33]
+#define d3Adt33041 d3Adt3[74]
+#define d3Adt33060 d3Adt3[45]
+#define d3Adt33220 d3Adt3[23]
+#define d3Adt33221 d3Adt3[67]
+#define d3Adt33240 d3Adt3[39]
+#define d3Adt33400 d3Adt3[9]
+#define d3Adt33401 d3Adt3[57]
+#define d3Adt33420 d3Adt3[29]
+#define d3Adt33600 d3Adt3[15]
+#define d3Adt34020 d3Adt3[18]
+#define d3Adt34021 d3Adt3[63]
+#define d3Adt34040 d3Adt3[34]
+#define d3Adt34041 d3Adt3[75]
+#define d3Adt34200 d3Adt3[4]
+#define d3Adt34201 d3Adt3[53]
+#define d3Adt34220 d3Adt3[24]
+#define d3Adt34221 d3Adt3[68]
+#define d3Adt34400 d3Adt3[10]
+#define d3Adt34401 d3Adt3[58]
+#define d3Adt35020 d3Adt3[19]
+#define d3Adt35021 d3Adt3[64]
+#define d3Adt35040 d3Adt3[35]
+#define d3Adt35200 d3Adt3[5]
+#define d3Adt35201 d3Adt3[54]
+#define d3Adt35220 d3Adt3[25]
+#define d3Adt35400 d3Adt3[11]
+#define d3Adt36000 d3Adt3[0]
+#define d3Adt36001 d3Adt3[50]
+#define d3Adt36020 d3Adt3[20]
+#define d3Adt36021 d3Adt3[65]
+#define d3Adt36200 d3Adt3[6]
+#define d3Adt36201 d3Adt3[55]
+#define d3Adt37000 d3Adt3[1]
+#define d3Adt37001 d3Adt3[51]
+#define d3Adt37020 d3Adt3[21]
+#define d3Adt37200 d3Adt3[7]
+#define d3Adt38000 d3Adt3[2]
+#define d3Adt38001 d3Adt3[52]
+#define d3Adt39000 d3Adt3[3]
+#define d4Adt40060 d4Adt4[42]
+#define d4Adt40061 d4Adt4[80]
+#define d4Adt40080 d4Adt4[48]
+#define d4Adt40081 d4Adt4[84]
+#define d4Adt40240 d4Adt4[36]
+#define d4Adt40241 d4Adt4[76]
+#define d4Adt40260 d4Adt4[46]
+#define d4Adt40261 d4Adt4[83]
+#define d4Adt40420 d4Adt4[26]
+#define d4Adt40421 d4Adt4[69]
+#define d4Adt40440 d4Adt4[40]
+#define d4Adt40441 d4Adt4[79]
+#define d4Adt40600 d4Adt4[12]
+#define d4Adt40601 d4Adt4[59]
+#define d4Adt40620 d4Adt4[30]
+#define d4Adt40621 d4Adt4[72]
+#define d4Adt40800 d4Adt4[16]
+#define d4Adt40801 d4Adt4[62]
+#define d4Adt41060 d4Adt4[43]
+#define d4Adt41061 d4Adt4[81]
+#define d4Adt41080 d4Adt4[49]
+#define d4Adt41240 d4Adt4[37]
+#define d4Adt41241 d4Adt4[77]
+#define d4Adt41260 d4Adt4[47]
+#define d4Adt41420 d4Adt4[27]
+#define d4Adt41421 d4Adt4[70]
+#define d4Adt41440 d4Adt4[41]
+#define d4Adt41600 d4Adt4[13]
+#define d4Adt41601 d4Adt4[60]
+#define d4Adt41620 d4Adt4[31]
+#define d4Adt41800 d4Adt4[17]
+#define d4Adt42040 d4Adt4[32]
+#define d4Adt42041 d4Adt4[73]
+#define d4Adt42060 d4Adt4[44]
+#define d4Adt42061 d4Adt4[82]
+#define d4Adt42220 d4Adt4[22]
+#define d4Adt42221 d4Adt4[66]
+#define d4Adt42240 d4Adt4[38]
+#define d4Adt42241 d4Adt4[78]
+#define d4Adt42400 d4Adt4[8]
+#define d4Adt42401 d4Adt4[56]
+#define d4Adt42420 d4Adt4[28]
+#define d4Adt42421 d4Adt4[71]
+#define d4Adt42600 d4Adt4[14]
+#define d4Adt42601 d4Adt4[61]
+#define d4Adt43040 d4Adt4[33]
+#define d4Adt43041 d4Adt4[74]
+#define d4Adt43060 d4Adt4[45]
+#define d4Adt43220 d4Adt4[23]
+#define d4Adt43221 d4Adt4[67]
+#define d4Adt43240 d4Adt4[39]
+#define d4Adt43400 d4Adt4[9]
+#define d4Adt43401 d4Adt4[57]
+#define d4Adt43420 d4Adt4[29]
+#define d4Adt43600 d4Adt4[15]
+#define d4Adt44020 d4Adt4[18]
+#define d4Adt44021 d4Adt4[63]
+#define d4Adt44040 d4Adt4[34]
+#define d4Adt44041 d4Adt4[75]
+#define d4Adt44200 d4Adt4[4]
+#define d4Adt44201 d4Adt4[53]
+#define d4Adt44220 d4Adt4[24]
+#define d4Adt44221 d4Adt4[68]
+#define d4Adt44400 d4Adt4[10]
+#define d4Adt44401 d4Adt4[58]
+#define d4Adt45020 d4Adt4[19]
+#define d4Adt45021 d4Adt4[64]
+#define d4Adt45040 d4Adt4[35]
+#define d4Adt45200 d4Adt4[5]
+#define d4Adt45201 d4Adt4[54]
+#define d4Adt45220 d4Adt4[25]
+#define d4Adt45400 d4Adt4[11]
+#define d4Adt46000 d4Adt4[0]
+#define d4Adt46001 d4Adt4[50]
+#define d4Adt46020 d4Adt4[20]
+#define d4Adt46021 d4Adt4[65]
+#define d4Adt46200 d4Adt4[6]
+#define d4Adt46201 d4Adt4[55]
+#define d4Adt47000 d4Adt4[1]
+#define d4Adt47001 d4Adt4[51]
+#define d4Adt47020 d4Adt4[21]
+#define d4Adt47200 d4Adt4[7]
+#define d4Adt48000 d4Adt4[2]
+#define d4Adt48001 d4Adt4[52]
+#define d4Adt49000 d4Adt4[3]
+
+void effsource_set_particle_dt(struct effsource_ctx * ctx);
+void effsource_set_particle_dC1(struct effsource_ctx * ctx);
+void effsource_set_particle_kinematics(struct effsource_ctx * ctx, double r, double ur);
+double effsource_orbit_ur(struct effsource_ctx * ctx, double r, double ur);
+void effsource_fit_free(struct effsource_ctx * ctx);
+int effsource_share_read(struct effsource_ctx * ctx, const struct coordinate * x_p,
+  double E, double L, double ur);
+void effsource_share_write(struct effsource_ctx * ctx);
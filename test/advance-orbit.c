@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "effsource.h"
+
+/* Mass and spin of the central black hole and the constants of motion of an
+   elliptic equatorial orbit between r=9 and r=11 (M=1) */
+static const double M = 1.0;
+static const double a = 0.5;
+static double e, l;
+
+/* The radial potential R(r) of the orbit, with ur = sqrt(R)/r^2 */
+static double R_calc(double r)
+{
+  const double Delta = r*r - 2.0*M*r + a*a;
+  const double P = e*(r*r + a*a) - a*l;
+  return P*P - Delta*(r*r + (l - a*e)*(l - a*e));
+}
+
+/* Time derivatives of y = (r_p, ur, phi_p) along the geodesic */
+static void geodesic_rhs(const double y[3], double dydt[3])
+{
+  const double r = y[0];
+  const double Delta = r*r - 2.0*M*r + a*a;
+  const double P = e*(r*r + a*a) - a*l;
+  const double ut = (-a*(a*e - l) + (r*r + a*a)*P/Delta)/(r*r);
+  const double uphi = (-(a*e - l) + a*P/Delta)/(r*r);
+
+  /* dur/dtau = V'(r)/2 with V = R/r^4 */
+  const double dR = 4.0*e*r*P - (2.0*r - 2.0*M)*(r*r + (l - a*e)*(l - a*e)) - 2.0*r*Delta;
+  const double dV = dR/(r*r*r*r) - 4.0*R_calc(r)/(r*r*r*r*r);
+
+  dydt[0] = y[1]/ut;
+  dydt[1] = 0.5*dV/ut;
+  dydt[2] = uphi/ut;
+}
+
+/* Integrate the geodesic by dt with n fourth order Runge-Kutta steps */
+static void geodesic_step(double y[3], double dt, int n)
+{
+  const double h = dt/n;
+  for(int i = 0; i < n; i++)
+  {
+    double k1[3], k2[3], k3[3], k4[3], yt[3];
+    geodesic_rhs(y, k1);
+    for(int j = 0; j < 3; j++)
+      yt[j] = y[j] + 0.5*h*k1[j];
+    geodesic_rhs(yt, k2);
+    for(int j = 0; j < 3; j++)
+      yt[j] = y[j] + 0.5*h*k2[j];
+    geodesic_rhs(yt, k3);
+    for(int j = 0; j < 3; j++)
+      yt[j] = y[j] + h*k3[j];
+    geodesic_rhs(yt, k4);
+    for(int j = 0; j < 3; j++)
+      y[j] += h/6.0*(k1[j] + 2.0*k2[j] + 2.0*k3[j] + k4[j]);
+  }
+}
+
+/* The largest difference between the effective source after
+   effsource_advance and the one computed at the particle's position on the
+   geodesic, at the points a distance M from the particle in 26 directions,
+   relative to the largest magnitude of the latter there */
+static double src_error(effsource_ctx * ref, const struct coordinate * xp)
+{
+  double err = 0.0, scale = 0.0;
+  for(int i = -1; i <= 1; i++)
+    for(int j = -1; j <= 1; j++)
+      for(int k = -1; k <= 1; k++)
+      {
+        if(i == 0 && j == 0 && k == 0)
+          continue;
+        const double h = M/sqrt(i*i + j*j + k*k);
+        struct coordinate x = {xp->r + i*h, xp->theta + j*h/xp->r, xp->phi + k*h/xp->r, xp->t};
+
+        double PhiS, dPhiS_dx[4], d2PhiS_dx2[10], src, src_ref;
+        effsource_calc(&x, &PhiS, dPhiS_dx, d2PhiS_dx2, &src);
+        effsource_calc_ctx(ref, &x, &PhiS, dPhiS_dx, d2PhiS_dx2, &src_ref);
+        err = fmax(err, fabs(src - src_ref));
+        scale = fmax(scale, fabs(src_ref));
+      }
+  return err/scale;
+}
+
+/* Move the particle along the orbit with effsource_advance and compare the
+   effective source with the one computed from scratch on the geodesic. Fails
+   if the error exceeds twice tol, allowing for roundoff. */
+int main(int argc, char* argv[])
+{
+  if(argc != 5)
+  {
+    printf( "usage: %s r_p dt tol nsteps\n", argv[0] );
+    return(1);
+  }
+
+  const double r_p = atof(argv[1]);
+  const double dt = atof(argv[2]);
+  const double tol = atof(argv[3]);
+  const int nsteps = atoi(argv[4]);
+
+  e = sqrt((-434070 + 2471*a*a + 6*sqrt(110)*a*sqrt(6237 + 162*a*a + a*a*a*a))/(-474721 + 3960*a*a));
+  l = ((261*a + a*a*a - 3*sqrt(110)*sqrt(6237 + 162*a*a + a*a*a*a))*e)/(-630 + a*a);
+  if(r_p < 9.0 || r_p > 11.0)
+  {
+    fprintf(stderr, "%s: r_p must lie between the turning points 9 and 11\n", argv[0]);
+    return(1);
+  }
+
+  double y[3] = {r_p, -sqrt(R_calc(r_p))/(r_p*r_p), 0.0};
+  struct coordinate xp = {r_p, M_PI_2, 0.0, 0.0};
+
+  effsource_init(M, a);
+  effsource_set_particle(&xp, e, l, y[1]);
+
+  effsource_ctx * ref = effsource_ctx_alloc();
+  effsource_init_ctx(ref, M, a);
+
+  int nrecomputed = 0, status = 0;
+  for(int n = 1; n <= nsteps; n++)
+  {
+    nrecomputed += effsource_advance(dt, tol);
+
+    geodesic_step(y, dt, 200);
+    xp.t += dt;
+    xp.r = y[0];
+    xp.phi = y[2];
+    const double ur = copysign(sqrt(fmax(R_calc(y[0]), 0.0))/(y[0]*y[0]), y[1]);
+    effsource_set_particle_ctx(ref, &xp, e, l, ur);
+
+    const double err = src_error(ref, &xp);
+    printf("%d %.10f %+.10f %.3e %d\n", n, xp.r, ur, err, nrecomputed);
+    if(err > 2.0*tol + 1e-7)
+      status = 1;
+  }
+
+  effsource_ctx_free(ref);
+
+  if(status != 0)
+    fprintf(stderr, "%s: the error of effsource_advance exceeded tol\n", argv[0]);
+
+  return(status);
+}
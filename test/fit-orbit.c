@@ -0,0 +1,39 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "effsource.h"
+
+/* Fit the coefficients along an orbit and save the fits to a file, which
+   later runs can load with effsource_fit_load */
+int main(int argc, char* argv[])
+{
+  if(argc != 9)
+  {
+    printf( "usage: %s M a e l r_min r_max tol file\n", argv[0] );
+    return(1);
+  }
+
+  const double M = atof(argv[1]);
+  const double a = atof(argv[2]);
+  const double e = atof(argv[3]);
+  const double l = atof(argv[4]);
+  const double r_min = atof(argv[5]);
+  const double r_max = atof(argv[6]);
+  const double tol = atof(argv[7]);
+  const char * file = argv[8];
+
+  effsource_init(M, a);
+
+  if(effsource_fit_orbit(e, l, r_min, r_max, tol) != 0)
+  {
+    fprintf(stderr, "%s: could not fit the orbit to a tolerance of %g\n", argv[0], tol);
+    return(1);
+  }
+
+  if(effsource_fit_save(file) != 0)
+  {
+    fprintf(stderr, "%s: could not write %s\n", argv[0], file);
+    return(1);
+  }
+
+  return(0);
+}